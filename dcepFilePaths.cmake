@@ -8,7 +8,19 @@
 # DCEP library source files.
 set( DCEP_SOURCES
      "${CMAKE_CURRENT_LIST_DIR}/source/dcep_api.c"
-     "${CMAKE_CURRENT_LIST_DIR}/source/dcep_endianness.c" )
+     "${CMAKE_CURRENT_LIST_DIR}/source/dcep_endianness.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/dcep_simd.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/dcep_profiling.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/dcep_descriptors.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/dcep_utf8.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/dcep_channel_registry.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/dcep_state_machine.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/dcep_stream_id_allocator.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/dcep_arena.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/dcep_channel_pool.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/dcep_protocol_table.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/dcep_timer_wheel.c"
+     "${CMAKE_CURRENT_LIST_DIR}/source/dcep_reliability_policy.c" )
 
 # DCEP library public include directories.
 set( DCEP_INCLUDE_PUBLIC_DIRS
@@ -16,4 +28,19 @@ set( DCEP_INCLUDE_PUBLIC_DIRS
 
 # DCEP library public include header files.
 set( DCEP_INCLUDE_PUBLIC_FILES
-     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_api.h" )
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_api.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_data_types.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_endianness.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_simd.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_utf8.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_profiling.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_descriptors.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_channel_open_view.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_channel_registry.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_state_machine.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_stream_id_allocator.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_arena.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_channel_pool.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_protocol_table.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_timer_wheel.h"
+     "${CMAKE_CURRENT_LIST_DIR}/source/include/dcep_reliability_policy.h" )
@@ -8,282 +8,1421 @@
 
 /*
  * Helper macros.
+ *
+ * When DCEP_HOST_ENDIANNESS is defined, the byte order is fixed at compile
+ * time and the inline accessors from dcep_endianness.h are used directly.
+ * Otherwise, the functions selected at runtime in Dcep_Init are used.
  */
-#define DCEP_WRITE_UINT16   ( pCtx->readWriteFunctions.writeUint16Fn )
-#define DCEP_WRITE_UINT32   ( pCtx->readWriteFunctions.writeUint32Fn )
-#define DCEP_READ_UINT16    ( pCtx->readWriteFunctions.readUint16Fn )
-#define DCEP_READ_UINT32    ( pCtx->readWriteFunctions.readUint32Fn )
+#if defined( DCEP_HOST_ENDIANNESS )
+    #define DCEP_WRITE_UINT16   Dcep_WriteUint16
+    #define DCEP_WRITE_UINT32   Dcep_WriteUint32
+    #define DCEP_READ_UINT16    Dcep_ReadUint16
+    #define DCEP_READ_UINT32    Dcep_ReadUint32
+#else
+    #define DCEP_WRITE_UINT16   ( pCtx->readWriteFunctions.writeUint16Fn )
+    #define DCEP_WRITE_UINT32   ( pCtx->readWriteFunctions.writeUint32Fn )
+    #define DCEP_READ_UINT16    ( pCtx->readWriteFunctions.readUint16Fn )
+    #define DCEP_READ_UINT32    ( pCtx->readWriteFunctions.readUint32Fn )
+#endif
+
+/* Hint the CPU to start fetching the next message while the current one is
+ * being parsed. */
+#if defined( __GNUC__ )
+    #define DCEP_PREFETCH( pAddress )    __builtin_prefetch( pAddress )
+#else
+    #define DCEP_PREFETCH( pAddress )
+#endif
+
+/* Time each public function into the latency histograms of the context. The
+ * start timestamp is declared by DCEP_PROFILING_START, so it must follow the
+ * other declarations of the function. */
+#if defined( DCEP_ENABLE_PROFILING )
+    #define DCEP_PROFILING_START( startTimestamp ) \
+        uint64_t startTimestamp = DCEP_PROFILING_TIMESTAMP()
+    #define DCEP_PROFILING_STOP( pCtx, function, startTimestamp ) \
+        RecordLatency( ( pCtx ), ( function ), ( startTimestamp ) )
+#else
+    #define DCEP_PROFILING_START( startTimestamp )
+    #define DCEP_PROFILING_STOP( pCtx, function, startTimestamp )
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* Longest DATA_CHANNEL_OPEN message that can be described by the header. */
+#define DCEP_CHANNEL_OPEN_MESSAGE_MAX_LENGTH    ( DCEP_HEADER_LENGTH + UINT16_MAX + UINT16_MAX )
+
+/* Payload classification table. Rows are PPIDs from DCEP_PPID_DCEP onwards,
+ * with one extra row for every other PPID. Columns tell apart payloads that
+ * are empty, start with a DCEP ACK or OPEN message type, or start with any
+ * other byte. */
+#define DCEP_PPID_TABLE_ROWS                    9
+#define DCEP_PPID_TABLE_INVALID_ROW             ( DCEP_PPID_TABLE_ROWS - 1 )
+
+#define DCEP_PAYLOAD_COLUMN_EMPTY               0
+#define DCEP_PAYLOAD_COLUMN_ACK                 1
+#define DCEP_PAYLOAD_COLUMN_OPEN                2
+#define DCEP_PAYLOAD_COLUMN_OTHER               3
+#define DCEP_PAYLOAD_COLUMNS                    4
+
+/* First bytes mapped to their own column, larger bytes use the last entry. */
+#define DCEP_MESSAGE_TYPE_TABLE_LENGTH          ( DCEP_MESSAGE_DATA_CHANNEL_OPEN + 2 )
+
+/*-----------------------------------------------------------*/
+
+static const uint8_t messageTypeColumns[ DCEP_MESSAGE_TYPE_TABLE_LENGTH ] =
+{
+    DCEP_PAYLOAD_COLUMN_OTHER,
+    DCEP_PAYLOAD_COLUMN_OTHER,
+    DCEP_PAYLOAD_COLUMN_ACK,  /* DCEP_MESSAGE_DATA_CHANNEL_ACK */
+    DCEP_PAYLOAD_COLUMN_OPEN, /* DCEP_MESSAGE_DATA_CHANNEL_OPEN */
+    DCEP_PAYLOAD_COLUMN_OTHER
+};
+
+static const uint8_t payloadClasses[ DCEP_PPID_TABLE_ROWS ][ DCEP_PAYLOAD_COLUMNS ] =
+{
+    /* 50: DCEP. */
+    { DCEP_PAYLOAD_CLASS_INVALID,      DCEP_PAYLOAD_CLASS_DATA_CHANNEL_ACK, DCEP_PAYLOAD_CLASS_DATA_CHANNEL_OPEN, DCEP_PAYLOAD_CLASS_INVALID      },
+    /* 51: String. */
+    { DCEP_PAYLOAD_CLASS_INVALID,      DCEP_PAYLOAD_CLASS_STRING,           DCEP_PAYLOAD_CLASS_STRING,            DCEP_PAYLOAD_CLASS_STRING       },
+    /* 52: Partial string, deprecated. */
+    { DCEP_PAYLOAD_CLASS_INVALID,      DCEP_PAYLOAD_CLASS_INVALID,          DCEP_PAYLOAD_CLASS_INVALID,           DCEP_PAYLOAD_CLASS_INVALID      },
+    /* 53: Binary. */
+    { DCEP_PAYLOAD_CLASS_INVALID,      DCEP_PAYLOAD_CLASS_BINARY,           DCEP_PAYLOAD_CLASS_BINARY,            DCEP_PAYLOAD_CLASS_BINARY       },
+    /* 54: Partial binary, deprecated. */
+    { DCEP_PAYLOAD_CLASS_INVALID,      DCEP_PAYLOAD_CLASS_INVALID,          DCEP_PAYLOAD_CLASS_INVALID,           DCEP_PAYLOAD_CLASS_INVALID      },
+    /* 55: Unassigned. */
+    { DCEP_PAYLOAD_CLASS_INVALID,      DCEP_PAYLOAD_CLASS_INVALID,          DCEP_PAYLOAD_CLASS_INVALID,           DCEP_PAYLOAD_CLASS_INVALID      },
+    /* 56: String empty. */
+    { DCEP_PAYLOAD_CLASS_STRING_EMPTY, DCEP_PAYLOAD_CLASS_STRING_EMPTY,     DCEP_PAYLOAD_CLASS_STRING_EMPTY,      DCEP_PAYLOAD_CLASS_STRING_EMPTY },
+    /* 57: Binary empty. */
+    { DCEP_PAYLOAD_CLASS_BINARY_EMPTY, DCEP_PAYLOAD_CLASS_BINARY_EMPTY,     DCEP_PAYLOAD_CLASS_BINARY_EMPTY,      DCEP_PAYLOAD_CLASS_BINARY_EMPTY },
+    /* Any other PPID. */
+    { DCEP_PAYLOAD_CLASS_INVALID,      DCEP_PAYLOAD_CLASS_INVALID,          DCEP_PAYLOAD_CLASS_INVALID,           DCEP_PAYLOAD_CLASS_INVALID      }
+};
+
+#if defined( DCEP_ENABLE_PROFILING )
+
+static void RecordLatency( DcepContext_t * pCtx,
+                           DcepProfiledFunction_t function,
+                           uint64_t startTimestamp )
+{
+    uint64_t stopTimestamp = DCEP_PROFILING_TIMESTAMP();
+
+    /* Calls rejected for a NULL context have nowhere to be recorded. */
+    if( pCtx != NULL )
+    {
+        Dcep_LatencyHistogramRecord( &( pCtx->profile.histograms[ function ] ),
+                                     stopTimestamp - startTimestamp );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_ENABLE_PROFILING */
+
+static size_t CalculateChannelOpenMessageLength( const DcepChannelOpenMessage_t * pChannelOpenMessage )
+{
+    return ( size_t ) DCEP_HEADER_LENGTH +
+           ( size_t ) pChannelOpenMessage->channelNameLength +
+           ( size_t ) pChannelOpenMessage->protocolLength;
+}
+
+/*-----------------------------------------------------------*/
+
+static void SerializeChannelOpenHeader( DcepContext_t * pCtx,
+                                        const DcepChannelOpenMessage_t * pChannelOpenMessage,
+                                        uint8_t * pBuffer )
+{
+    uint32_t reliabilityValue = 0;
+    uint8_t descriptor = DCEP_GET_DESCRIPTOR( pChannelOpenMessage->channelType );
+
+    #if defined( DCEP_HOST_ENDIANNESS )
+        ( void ) pCtx;
+    #endif
+
+    pBuffer[ DCEP_MESSAGE_TYPE_OFFSET ] = DCEP_MESSAGE_DATA_CHANNEL_OPEN;
+    pBuffer[ DCEP_CHANNEL_TYPE_OFFSET ] = pChannelOpenMessage->channelType;
+
+    DCEP_WRITE_UINT16( &( pBuffer[ DCEP_PRIORITY_OFFSET ] ),
+                       pChannelOpenMessage->priority );
+
+    /* Reliable and unknown channel types carry 0. */
+    reliabilityValue = ( pChannelOpenMessage->numRetransmissions & DCEP_DESCRIPTOR_MASK( descriptor, DCEP_DESCRIPTOR_REXMIT ) ) |
+                       ( pChannelOpenMessage->maxLifetimeInMilliseconds & DCEP_DESCRIPTOR_MASK( descriptor, DCEP_DESCRIPTOR_TIMED ) );
+
+    DCEP_WRITE_UINT32( &( pBuffer[ DCEP_RELIABILITY_PARAMETER_OFFSET ] ),
+                       reliabilityValue );
+
+    DCEP_WRITE_UINT16( &( pBuffer[ DCEP_LABEL_LENGTH_OFFSET ] ),
+                       pChannelOpenMessage->channelNameLength );
+
+    DCEP_WRITE_UINT16( &( pBuffer[ DCEP_PROTOCOL_LENGTH_OFFSET ] ),
+                       pChannelOpenMessage->protocolLength );
+}
+
+/*-----------------------------------------------------------*/
+
+static DcepResult_t DecodeChannelOpenHeader( DcepContext_t * pCtx,
+                                             const uint8_t * pDcepMessage,
+                                             DcepChannelOpenMessage_t * pChannelOpenMessage )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    uint32_t reliabilityValue = 0;
+    uint8_t descriptor;
+
+    #if defined( DCEP_HOST_ENDIANNESS )
+        ( void ) pCtx;
+    #endif
+
+    pChannelOpenMessage->channelType = pDcepMessage[ DCEP_CHANNEL_TYPE_OFFSET ];
+    pChannelOpenMessage->priority = DCEP_READ_UINT16( &( pDcepMessage[ DCEP_PRIORITY_OFFSET ] ) );
+
+    reliabilityValue = DCEP_READ_UINT32( &( pDcepMessage[ DCEP_RELIABILITY_PARAMETER_OFFSET ] ) );
+
+    pChannelOpenMessage->channelNameLength = DCEP_READ_UINT16( &( pDcepMessage[ DCEP_LABEL_LENGTH_OFFSET ] ) );
+    pChannelOpenMessage->protocolLength = DCEP_READ_UINT16( &( pDcepMessage[ DCEP_PROTOCOL_LENGTH_OFFSET ] ) );
+
+    /* The parameter that does not apply to the channel type is set to 0. */
+    descriptor = DCEP_GET_DESCRIPTOR( pChannelOpenMessage->channelType );
+    pChannelOpenMessage->numRetransmissions = reliabilityValue & DCEP_DESCRIPTOR_MASK( descriptor, DCEP_DESCRIPTOR_REXMIT );
+    pChannelOpenMessage->maxLifetimeInMilliseconds = reliabilityValue & DCEP_DESCRIPTOR_MASK( descriptor, DCEP_DESCRIPTOR_TIMED );
+
+    if( ( descriptor & DCEP_DESCRIPTOR_CHANNEL_TYPE_VALID ) == 0U )
+    {
+        DCEP_METRICS_INCREMENT( pCtx, malformedChannelType );
+        result = DCEP_RESULT_MALFORMED_MESSAGE;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+#if defined( DCEP_ENABLE_STRICT_UTF8 )
+
+/* The label and protocol are validated separately so that a character can
+ * not start in one and end in the other. */
+static DcepResult_t ValidateFieldsUtf8( const DcepContext_t * pCtx,
+                                        const uint8_t * pDcepMessage,
+                                        size_t channelNameLength,
+                                        size_t protocolLength )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( ( pCtx->validateUtf8Fn( DCEP_UTF8_ACCEPT,
+                                &( pDcepMessage[ DCEP_HEADER_LENGTH ] ),
+                                channelNameLength ) != DCEP_UTF8_ACCEPT ) ||
+        ( pCtx->validateUtf8Fn( DCEP_UTF8_ACCEPT,
+                                &( pDcepMessage[ DCEP_HEADER_LENGTH + channelNameLength ] ),
+                                protocolLength ) != DCEP_UTF8_ACCEPT ) )
+    {
+        result = DCEP_RESULT_MALFORMED_MESSAGE;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint16_t ValidateHeaderBlockUtf8( const DcepContext_t * pCtx,
+                                         const DcepHeaderBlock_t * pBlock,
+                                         const DcepBatchEntry_t * pEntries,
+                                         size_t numEntries,
+                                         uint16_t validMask )
+{
+    size_t i;
+
+    for( i = 0; i < numEntries; i++ )
+    {
+        if( ( ( validMask & ( 1U << i ) ) != 0 ) &&
+            ( ValidateFieldsUtf8( pCtx,
+                                  pEntries[ i ].pDcepMessage,
+                                  pBlock->labelLength[ i ],
+                                  pBlock->protocolLength[ i ] ) != DCEP_RESULT_OK ) )
+        {
+            validMask &= ( uint16_t ) ~( 1U << i );
+        }
+    }
+
+    return validMask;
+}
+
+/*-----------------------------------------------------------*/
+
+static DcepResult_t ValidateFieldSegmentUtf8( DcepContext_t * pCtx,
+                                              DcepStreamingParser_t * pParser,
+                                              const DcepIoVec_t * pSegment )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    pParser->utf8State = pCtx->validateUtf8Fn( pParser->utf8State,
+                                               pSegment->pBase,
+                                               pSegment->length );
+
+    /* A field must also end on a character boundary. */
+    if( ( pParser->utf8State == DCEP_UTF8_REJECT ) ||
+        ( ( pParser->remainingFieldLength == 0 ) &&
+          ( pParser->utf8State != DCEP_UTF8_ACCEPT ) ) )
+    {
+        DCEP_METRICS_INCREMENT( pCtx, malformedUtf8 );
+        result = DCEP_RESULT_MALFORMED_MESSAGE;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_ENABLE_STRICT_UTF8 */
+
+static DcepResult_t DeserializeChannelOpenMessage( DcepContext_t * pCtx,
+                                                   const uint8_t * pDcepMessage,
+                                                   size_t dcepMessageLength,
+                                                   DcepChannelOpenMessage_t * pChannelOpenMessage )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t consumedLength = 0;
+
+    result = DecodeChannelOpenHeader( pCtx,
+                                      pDcepMessage,
+                                      pChannelOpenMessage );
+
+    consumedLength += DCEP_HEADER_LENGTH;
+
+    if( result == DCEP_RESULT_OK )
+    {
+        if( pChannelOpenMessage->channelNameLength > 0 )
+        {
+            if( dcepMessageLength < ( consumedLength + pChannelOpenMessage->channelNameLength ) )
+            {
+                DCEP_METRICS_INCREMENT( pCtx, malformedLabelOverrun );
+                result = DCEP_RESULT_MALFORMED_MESSAGE;
+            }
+            else
+            {
+                pChannelOpenMessage->pChannelName = &( pDcepMessage[ consumedLength ] );
+                consumedLength += pChannelOpenMessage->channelNameLength;
+            }
+        }
+        else
+        {
+            pChannelOpenMessage->pChannelName = NULL;
+        }
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        if( pChannelOpenMessage->protocolLength > 0 )
+        {
+            if( dcepMessageLength < ( consumedLength + pChannelOpenMessage->protocolLength ) )
+            {
+                DCEP_METRICS_INCREMENT( pCtx, malformedProtocolOverrun );
+                result = DCEP_RESULT_MALFORMED_MESSAGE;
+            }
+            else
+            {
+                pChannelOpenMessage->pProtocol = &( pDcepMessage[ consumedLength ] );
+                consumedLength += pChannelOpenMessage->protocolLength;
+            }
+        }
+        else
+        {
+            pChannelOpenMessage->pProtocol = NULL;
+        }
+    }
+
+    #if defined( DCEP_ENABLE_STRICT_UTF8 )
+        if( ( result == DCEP_RESULT_OK ) &&
+            ( ValidateFieldsUtf8( pCtx,
+                                  pDcepMessage,
+                                  pChannelOpenMessage->channelNameLength,
+                                  pChannelOpenMessage->protocolLength ) != DCEP_RESULT_OK ) )
+        {
+            DCEP_METRICS_INCREMENT( pCtx, malformedUtf8 );
+            result = DCEP_RESULT_MALFORMED_MESSAGE;
+        }
+    #endif
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static void LoadHeaderBlock( const DcepBatchEntry_t * pEntries,
+                             size_t numEntries,
+                             DcepHeaderBlock_t * pBlock )
+{
+    const uint8_t * pDcepMessage;
+    size_t dcepMessageLength;
+    size_t i;
+
+    memset( pBlock, 0, sizeof( DcepHeaderBlock_t ) );
+
+    for( i = 0; i < numEntries; i++ )
+    {
+        if( ( i + 1 ) < numEntries )
+        {
+            DCEP_PREFETCH( pEntries[ i + 1 ].pDcepMessage );
+        }
+
+        pDcepMessage = pEntries[ i ].pDcepMessage;
+        dcepMessageLength = pEntries[ i ].dcepMessageLength;
+
+        /* Slots left zero are rejected by the kernel. */
+        if( ( pDcepMessage != NULL ) &&
+            ( dcepMessageLength >= DCEP_HEADER_LENGTH ) )
+        {
+            pBlock->messageType[ i ] = pDcepMessage[ DCEP_MESSAGE_TYPE_OFFSET ];
+            pBlock->channelType[ i ] = pDcepMessage[ DCEP_CHANNEL_TYPE_OFFSET ];
+
+            /* Copied in network byte order, the kernel converts them. */
+            memcpy( &( pBlock->priority[ i ] ),
+                    &( pDcepMessage[ DCEP_PRIORITY_OFFSET ] ),
+                    sizeof( uint16_t ) );
+            memcpy( &( pBlock->reliabilityParameter[ i ] ),
+                    &( pDcepMessage[ DCEP_RELIABILITY_PARAMETER_OFFSET ] ),
+                    sizeof( uint32_t ) );
+            memcpy( &( pBlock->labelLength[ i ] ),
+                    &( pDcepMessage[ DCEP_LABEL_LENGTH_OFFSET ] ),
+                    sizeof( uint16_t ) );
+            memcpy( &( pBlock->protocolLength[ i ] ),
+                    &( pDcepMessage[ DCEP_PROTOCOL_LENGTH_OFFSET ] ),
+                    sizeof( uint16_t ) );
+
+            if( dcepMessageLength > DCEP_CHANNEL_OPEN_MESSAGE_MAX_LENGTH )
+            {
+                pBlock->messageLength[ i ] = DCEP_CHANNEL_OPEN_MESSAGE_MAX_LENGTH;
+            }
+            else
+            {
+                pBlock->messageLength[ i ] = ( uint32_t ) dcepMessageLength;
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void DecodeHeaderBlockEntry( const DcepHeaderBlock_t * pBlock,
+                                    size_t index,
+                                    const uint8_t * pDcepMessage,
+                                    DcepChannelOpenMessage_t * pChannelOpenMessage )
+{
+    uint8_t descriptor;
+
+    pChannelOpenMessage->channelType = pBlock->channelType[ index ];
+    pChannelOpenMessage->priority = pBlock->priority[ index ];
+    pChannelOpenMessage->channelNameLength = pBlock->labelLength[ index ];
+    pChannelOpenMessage->protocolLength = pBlock->protocolLength[ index ];
+
+    descriptor = DCEP_GET_DESCRIPTOR( pChannelOpenMessage->channelType );
+    pChannelOpenMessage->numRetransmissions = pBlock->reliabilityParameter[ index ] &
+                                              DCEP_DESCRIPTOR_MASK( descriptor, DCEP_DESCRIPTOR_REXMIT );
+    pChannelOpenMessage->maxLifetimeInMilliseconds = pBlock->reliabilityParameter[ index ] &
+                                                     DCEP_DESCRIPTOR_MASK( descriptor, DCEP_DESCRIPTOR_TIMED );
+
+    if( pChannelOpenMessage->channelNameLength > 0 )
+    {
+        pChannelOpenMessage->pChannelName = &( pDcepMessage[ DCEP_HEADER_LENGTH ] );
+    }
+    else
+    {
+        pChannelOpenMessage->pChannelName = NULL;
+    }
+
+    if( pChannelOpenMessage->protocolLength > 0 )
+    {
+        pChannelOpenMessage->pProtocol = &( pDcepMessage[ DCEP_HEADER_LENGTH + pChannelOpenMessage->channelNameLength ] );
+    }
+    else
+    {
+        pChannelOpenMessage->pProtocol = NULL;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void DeserializeBatchEntry( DcepContext_t * pCtx,
+                                   const DcepBatchEntry_t * pEntry,
+                                   DcepBatchResult_t * pEntryResult )
+{
+    if( ( pEntry->pDcepMessage == NULL ) ||
+        ( pEntry->dcepMessageLength == 0 ) )
+    {
+        pEntryResult->result = DCEP_RESULT_BAD_PARAM;
+    }
+    else if( pEntry->pDcepMessage[ DCEP_MESSAGE_TYPE_OFFSET ] == DCEP_MESSAGE_DATA_CHANNEL_ACK )
+    {
+        pEntryResult->messageType = DCEP_MESSAGE_DATA_CHANNEL_ACK;
+        pEntryResult->result = DCEP_RESULT_OK;
+
+        DCEP_METRICS_INCREMENT( pCtx, channelAckMessagesDeserialized );
+        DCEP_METRICS_ADD( pCtx, bytesDeserialized, pEntry->dcepMessageLength );
+    }
+    else if( pEntry->pDcepMessage[ DCEP_MESSAGE_TYPE_OFFSET ] == DCEP_MESSAGE_DATA_CHANNEL_OPEN )
+    {
+        pEntryResult->messageType = DCEP_MESSAGE_DATA_CHANNEL_OPEN;
+
+        if( pEntry->dcepMessageLength < DCEP_HEADER_LENGTH )
+        {
+            DCEP_METRICS_INCREMENT( pCtx, malformedTruncatedHeader );
+            pEntryResult->result = DCEP_RESULT_MALFORMED_MESSAGE;
+        }
+        else
+        {
+            pEntryResult->result = DeserializeChannelOpenMessage( pCtx,
+                                                                  pEntry->pDcepMessage,
+                                                                  pEntry->dcepMessageLength,
+                                                                  &( pEntryResult->channelOpenMessage ) );
+
+            if( pEntryResult->result == DCEP_RESULT_OK )
+            {
+                DCEP_METRICS_INCREMENT( pCtx, channelOpenMessagesDeserialized );
+                DCEP_METRICS_ADD( pCtx, bytesDeserialized, pEntry->dcepMessageLength );
+            }
+        }
+    }
+    else
+    {
+        DCEP_METRICS_INCREMENT( pCtx, malformedMessageType );
+        pEntryResult->result = DCEP_RESULT_MALFORMED_MESSAGE;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_Init( DcepContext_t * pCtx )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( pCtx == NULL )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        Dcep_InitReadWriteFunctions( &( pCtx->readWriteFunctions ) );
+        pCtx->validateHeaderBlockFn = Dcep_SelectValidateHeaderBlockFunction();
+        pCtx->validateUtf8Fn = Dcep_SelectValidateUtf8Function();
+
+        #if defined( DCEP_ENABLE_METRICS )
+            memset( &( pCtx->metrics ), 0, sizeof( DcepMetrics_t ) );
+        #endif
+
+        #if defined( DCEP_ENABLE_PROFILING )
+            memset( &( pCtx->profile ), 0, sizeof( DcepProfile_t ) );
+        #endif
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static DcepResult_t SerializeChannelOpenMessage( DcepContext_t * pCtx,
+                                                 const DcepChannelOpenMessage_t * pChannelOpenMessage,
+                                                 uint8_t * pBuffer,
+                                                 size_t * pBufferLength )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t serializedMessageLength = 0;
+    size_t offset = 0;
+
+    /* Check the buffer size before writing anything so that a failed call
+     * leaves the buffer untouched. */
+    serializedMessageLength = CalculateChannelOpenMessageLength( pChannelOpenMessage );
+
+    if( *pBufferLength < serializedMessageLength )
+    {
+        DCEP_METRICS_INCREMENT( pCtx, outOfMemory );
+        result = DCEP_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        SerializeChannelOpenHeader( pCtx,
+                                    pChannelOpenMessage,
+                                    pBuffer );
+
+        offset += DCEP_HEADER_LENGTH;
+
+        if( pChannelOpenMessage->channelNameLength > 0 )
+        {
+            memcpy( &( pBuffer[ offset ] ),
+                    pChannelOpenMessage->pChannelName,
+                    pChannelOpenMessage->channelNameLength );
+
+            offset += pChannelOpenMessage->channelNameLength;
+        }
+
+        if( pChannelOpenMessage->protocolLength > 0 )
+        {
+            memcpy( &( pBuffer[ offset ] ),
+                    pChannelOpenMessage->pProtocol,
+                    pChannelOpenMessage->protocolLength );
+        }
+
+        *pBufferLength = serializedMessageLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_SerializeChannelOpenMessage( DcepContext_t * pCtx,
+                                               const DcepChannelOpenMessage_t * pChannelOpenMessage,
+                                               uint8_t * pBuffer,
+                                               size_t * pBufferLength )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    DCEP_PROFILING_START( profilingStart );
+
+    if( ( pCtx == NULL ) ||
+        ( pChannelOpenMessage == NULL ) ||
+        ( pBuffer == NULL ) ||
+        ( pBufferLength == NULL ) ||
+        ( *pBufferLength < DCEP_HEADER_LENGTH ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = SerializeChannelOpenMessage( pCtx,
+                                              pChannelOpenMessage,
+                                              pBuffer,
+                                              pBufferLength );
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        DCEP_METRICS_INCREMENT( pCtx, channelOpenMessagesSerialized );
+        DCEP_METRICS_ADD( pCtx, bytesSerialized, *pBufferLength );
+    }
+
+    DCEP_PROFILING_STOP( pCtx, DCEP_PROFILED_FUNCTION_SERIALIZE_CHANNEL_OPEN_MESSAGE, profilingStart );
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_GetChannelOpenMessageLength( DcepContext_t * pCtx,
+                                               const DcepChannelOpenMessage_t * pChannelOpenMessage,
+                                               size_t * pMessageLength )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    DCEP_PROFILING_START( profilingStart );
+
+    if( ( pCtx == NULL ) ||
+        ( pChannelOpenMessage == NULL ) ||
+        ( pMessageLength == NULL ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        *pMessageLength = CalculateChannelOpenMessageLength( pChannelOpenMessage );
+    }
+
+    DCEP_PROFILING_STOP( pCtx, DCEP_PROFILED_FUNCTION_GET_CHANNEL_OPEN_MESSAGE_LENGTH, profilingStart );
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_SerializeChannelOpenMessageIoVec( DcepContext_t * pCtx,
+                                                    const DcepChannelOpenMessage_t * pChannelOpenMessage,
+                                                    uint8_t * pHeaderBuffer,
+                                                    size_t headerBufferLength,
+                                                    DcepIoVec_t * pIoVecs,
+                                                    size_t * pIoVecCount )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t ioVecCount = 0;
+
+    DCEP_PROFILING_START( profilingStart );
+
+    if( ( pCtx == NULL ) ||
+        ( pChannelOpenMessage == NULL ) ||
+        ( pHeaderBuffer == NULL ) ||
+        ( headerBufferLength < DCEP_HEADER_LENGTH ) ||
+        ( pIoVecs == NULL ) ||
+        ( pIoVecCount == NULL ) ||
+        ( *pIoVecCount < DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        SerializeChannelOpenHeader( pCtx,
+                                    pChannelOpenMessage,
+                                    pHeaderBuffer );
+
+        pIoVecs[ ioVecCount ].pBase = pHeaderBuffer;
+        pIoVecs[ ioVecCount ].length = DCEP_HEADER_LENGTH;
+        ioVecCount++;
+
+        /* Label and protocol are referenced in place, not copied. */
+        if( pChannelOpenMessage->channelNameLength > 0 )
+        {
+            pIoVecs[ ioVecCount ].pBase = pChannelOpenMessage->pChannelName;
+            pIoVecs[ ioVecCount ].length = pChannelOpenMessage->channelNameLength;
+            ioVecCount++;
+        }
+
+        if( pChannelOpenMessage->protocolLength > 0 )
+        {
+            pIoVecs[ ioVecCount ].pBase = pChannelOpenMessage->pProtocol;
+            pIoVecs[ ioVecCount ].length = pChannelOpenMessage->protocolLength;
+            ioVecCount++;
+        }
+
+        *pIoVecCount = ioVecCount;
+
+        DCEP_METRICS_INCREMENT( pCtx, channelOpenMessagesSerialized );
+        DCEP_METRICS_ADD( pCtx, bytesSerialized, CalculateChannelOpenMessageLength( pChannelOpenMessage ) );
+    }
+
+    DCEP_PROFILING_STOP( pCtx, DCEP_PROFILED_FUNCTION_SERIALIZE_CHANNEL_OPEN_MESSAGE_IOVEC, profilingStart );
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_PrepareChannelOpenMessage( DcepContext_t * pCtx,
+                                             const DcepChannelOpenMessage_t * pChannelOpenMessage,
+                                             uint8_t * pTemplateBuffer,
+                                             size_t templateBufferLength,
+                                             DcepPreparedChannelOpenMessage_t * pPreparedMessage )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t templateLength = templateBufferLength;
+
+    DCEP_PROFILING_START( profilingStart );
+
+    if( ( pCtx == NULL ) ||
+        ( pChannelOpenMessage == NULL ) ||
+        ( pTemplateBuffer == NULL ) ||
+        ( templateBufferLength < DCEP_HEADER_LENGTH ) ||
+        ( pPreparedMessage == NULL ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    /* Templates are not counted as serialized messages, only the messages
+     * produced from them are. */
+    if( result == DCEP_RESULT_OK )
+    {
+        result = SerializeChannelOpenMessage( pCtx,
+                                              pChannelOpenMessage,
+                                              pTemplateBuffer,
+                                              &( templateLength ) );
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        pPreparedMessage->pTemplate = pTemplateBuffer;
+        pPreparedMessage->templateLength = templateLength;
+
+        pPreparedMessage->hasReliabilityParameter = ( uint8_t ) ( ( DCEP_GET_DESCRIPTOR( pChannelOpenMessage->channelType ) &
+                                                                    DCEP_DESCRIPTOR_PARTIAL_RELIABLE ) != 0U );
+    }
+
+    DCEP_PROFILING_STOP( pCtx, DCEP_PROFILED_FUNCTION_PREPARE_CHANNEL_OPEN_MESSAGE, profilingStart );
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_SerializePreparedChannelOpenMessage( DcepContext_t * pCtx,
+                                                       const DcepPreparedChannelOpenMessage_t * pPreparedMessage,
+                                                       uint16_t priority,
+                                                       uint32_t reliabilityParameter,
+                                                       uint8_t * pBuffer,
+                                                       size_t * pBufferLength )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    DCEP_PROFILING_START( profilingStart );
+
+    if( ( pCtx == NULL ) ||
+        ( pPreparedMessage == NULL ) ||
+        ( pPreparedMessage->pTemplate == NULL ) ||
+        ( pPreparedMessage->templateLength < DCEP_HEADER_LENGTH ) ||
+        ( pBuffer == NULL ) ||
+        ( pBufferLength == NULL ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        if( *pBufferLength < pPreparedMessage->templateLength )
+        {
+            DCEP_METRICS_INCREMENT( pCtx, outOfMemory );
+            result = DCEP_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        memcpy( pBuffer,
+                pPreparedMessage->pTemplate,
+                pPreparedMessage->templateLength );
+
+        DCEP_WRITE_UINT16( &( pBuffer[ DCEP_PRIORITY_OFFSET ] ),
+                           priority );
+
+        /* The template already carries 0 for reliable channels. */
+        if( pPreparedMessage->hasReliabilityParameter != 0 )
+        {
+            DCEP_WRITE_UINT32( &( pBuffer[ DCEP_RELIABILITY_PARAMETER_OFFSET ] ),
+                               reliabilityParameter );
+        }
+
+        *pBufferLength = pPreparedMessage->templateLength;
+
+        DCEP_METRICS_INCREMENT( pCtx, channelOpenMessagesSerialized );
+        DCEP_METRICS_ADD( pCtx, bytesSerialized, pPreparedMessage->templateLength );
+    }
+
+    DCEP_PROFILING_STOP( pCtx, DCEP_PROFILED_FUNCTION_SERIALIZE_PREPARED_CHANNEL_OPEN_MESSAGE, profilingStart );
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_SerializeChannelAckMessage( DcepContext_t * pCtx,
+                                              uint8_t * pBuffer,
+                                              size_t * pBufferLength )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    DCEP_PROFILING_START( profilingStart );
+
+    if( ( pCtx == NULL ) ||
+        ( pBuffer == NULL ) ||
+        ( pBufferLength == NULL ) ||
+        ( *pBufferLength < DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        pBuffer[ DCEP_MESSAGE_TYPE_OFFSET ] = DCEP_MESSAGE_DATA_CHANNEL_ACK;
+        *pBufferLength = DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH;
+
+        DCEP_METRICS_INCREMENT( pCtx, channelAckMessagesSerialized );
+        DCEP_METRICS_ADD( pCtx, bytesSerialized, DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH );
+    }
+
+    DCEP_PROFILING_STOP( pCtx, DCEP_PROFILED_FUNCTION_SERIALIZE_CHANNEL_ACK_MESSAGE, profilingStart );
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_SerializeChannelAckBatch( DcepContext_t * pCtx,
+                                            const uint16_t * pStreamIds,
+                                            size_t numStreamIds,
+                                            uint8_t * pBuffer,
+                                            size_t * pBufferLength,
+                                            DcepAckBatchEntry_t * pEntries )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t i;
+
+    DCEP_PROFILING_START( profilingStart );
+
+    if( ( pCtx == NULL ) ||
+        ( pStreamIds == NULL ) ||
+        ( numStreamIds == 0 ) ||
+        ( pBuffer == NULL ) ||
+        ( pBufferLength == NULL ) ||
+        ( pEntries == NULL ) ||
+        ( *pBufferLength / DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH < numStreamIds ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        /* Every ACK is the same single byte, so the payloads are written in
+         * one go. */
+        memset( pBuffer, DCEP_MESSAGE_DATA_CHANNEL_ACK, numStreamIds * DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH );
+
+        for( i = 0; i < numStreamIds; i++ )
+        {
+            pEntries[ i ].streamId = pStreamIds[ i ];
+            pEntries[ i ].payload.pBase = &( pBuffer[ i * DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH ] );
+            pEntries[ i ].payload.length = DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH;
+        }
+
+        *pBufferLength = numStreamIds * DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH;
+
+        DCEP_METRICS_ADD( pCtx, channelAckMessagesSerialized, numStreamIds );
+        DCEP_METRICS_ADD( pCtx, bytesSerialized, numStreamIds * DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH );
+    }
+
+    DCEP_PROFILING_STOP( pCtx, DCEP_PROFILED_FUNCTION_SERIALIZE_CHANNEL_ACK_BATCH, profilingStart );
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_DeserializeChannelOpenMessage( DcepContext_t * pCtx,
+                                                 const uint8_t * pDcepMessage,
+                                                 size_t dcepMessageLength,
+                                                 DcepChannelOpenMessage_t * pChannelOpenMessage )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    DCEP_PROFILING_START( profilingStart );
+
+    if( ( pCtx == NULL ) ||
+        ( pDcepMessage == NULL ) ||
+        ( pChannelOpenMessage == NULL ) ||
+        ( dcepMessageLength < DCEP_HEADER_LENGTH ) ||
+        ( pDcepMessage[ DCEP_MESSAGE_TYPE_OFFSET ] != DCEP_MESSAGE_DATA_CHANNEL_OPEN ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = DeserializeChannelOpenMessage( pCtx,
+                                                pDcepMessage,
+                                                dcepMessageLength,
+                                                pChannelOpenMessage );
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        DCEP_METRICS_INCREMENT( pCtx, channelOpenMessagesDeserialized );
+        DCEP_METRICS_ADD( pCtx, bytesDeserialized, dcepMessageLength );
+    }
+
+    DCEP_PROFILING_STOP( pCtx, DCEP_PROFILED_FUNCTION_DESERIALIZE_CHANNEL_OPEN_MESSAGE, profilingStart );
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_DeserializeAndRouteChannelOpenMessage( DcepContext_t * pCtx,
+                                                         const DcepProtocolTable_t * pProtocolTable,
+                                                         const uint8_t * pDcepMessage,
+                                                         size_t dcepMessageLength,
+                                                         DcepChannelOpenMessage_t * pChannelOpenMessage,
+                                                         uint16_t * pHandlerId )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    DCEP_PROFILING_START( profilingStart );
+
+    if( ( pCtx == NULL ) ||
+        ( pProtocolTable == NULL ) ||
+        ( pDcepMessage == NULL ) ||
+        ( pChannelOpenMessage == NULL ) ||
+        ( pHandlerId == NULL ) ||
+        ( dcepMessageLength < DCEP_HEADER_LENGTH ) ||
+        ( pDcepMessage[ DCEP_MESSAGE_TYPE_OFFSET ] != DCEP_MESSAGE_DATA_CHANNEL_OPEN ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = DeserializeChannelOpenMessage( pCtx,
+                                                pDcepMessage,
+                                                dcepMessageLength,
+                                                pChannelOpenMessage );
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        /* An unregistered protocol is not an error; the application decides
+         * what to do with the channel. */
+        if( Dcep_ProtocolTableLookup( pProtocolTable,
+                                      pChannelOpenMessage->pProtocol,
+                                      pChannelOpenMessage->protocolLength,
+                                      pHandlerId ) != DCEP_RESULT_OK )
+        {
+            *pHandlerId = DCEP_PROTOCOL_TABLE_NO_HANDLER;
+        }
+
+        DCEP_METRICS_INCREMENT( pCtx, channelOpenMessagesDeserialized );
+        DCEP_METRICS_ADD( pCtx, bytesDeserialized, dcepMessageLength );
+    }
+
+    DCEP_PROFILING_STOP( pCtx, DCEP_PROFILED_FUNCTION_DESERIALIZE_AND_ROUTE_CHANNEL_OPEN_MESSAGE, profilingStart );
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_InitChannelOpenView( DcepContext_t * pCtx,
+                                       const uint8_t * pDcepMessage,
+                                       size_t dcepMessageLength,
+                                       DcepChannelOpenView_t * pView )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t channelNameLength, protocolLength;
+
+    DCEP_PROFILING_START( profilingStart );
+
+    if( ( pCtx == NULL ) ||
+        ( pDcepMessage == NULL ) ||
+        ( pView == NULL ) ||
+        ( dcepMessageLength < DCEP_HEADER_LENGTH ) ||
+        ( pDcepMessage[ DCEP_MESSAGE_TYPE_OFFSET ] != DCEP_MESSAGE_DATA_CHANNEL_OPEN ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    /* Only the fields needed to bound the label and protocol are decoded. */
+    if( result == DCEP_RESULT_OK )
+    {
+        channelNameLength = DCEP_READ_UINT16( &( pDcepMessage[ DCEP_LABEL_LENGTH_OFFSET ] ) );
+        protocolLength = DCEP_READ_UINT16( &( pDcepMessage[ DCEP_PROTOCOL_LENGTH_OFFSET ] ) );
 
-/*-----------------------------------------------------------*/
+        if( ( DCEP_GET_DESCRIPTOR( pDcepMessage[ DCEP_CHANNEL_TYPE_OFFSET ] ) & DCEP_DESCRIPTOR_CHANNEL_TYPE_VALID ) == 0U )
+        {
+            DCEP_METRICS_INCREMENT( pCtx, malformedChannelType );
+            result = DCEP_RESULT_MALFORMED_MESSAGE;
+        }
+        else if( dcepMessageLength < ( DCEP_HEADER_LENGTH + channelNameLength ) )
+        {
+            DCEP_METRICS_INCREMENT( pCtx, malformedLabelOverrun );
+            result = DCEP_RESULT_MALFORMED_MESSAGE;
+        }
+        else if( dcepMessageLength < ( DCEP_HEADER_LENGTH + channelNameLength + protocolLength ) )
+        {
+            DCEP_METRICS_INCREMENT( pCtx, malformedProtocolOverrun );
+            result = DCEP_RESULT_MALFORMED_MESSAGE;
+        }
+        #if defined( DCEP_ENABLE_STRICT_UTF8 )
+            else if( ValidateFieldsUtf8( pCtx,
+                                         pDcepMessage,
+                                         channelNameLength,
+                                         protocolLength ) != DCEP_RESULT_OK )
+            {
+                DCEP_METRICS_INCREMENT( pCtx, malformedUtf8 );
+                result = DCEP_RESULT_MALFORMED_MESSAGE;
+            }
+        #endif
+        else
+        {
+            pView->pDcepMessage = pDcepMessage;
 
-/* DCEP Header:
- *
- *  0                   1                   2                   3
- *  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
- * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
- * |  Message Type |  Channel Type |            Priority           |
- * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
- * |                    Reliability Parameter                      |
- * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
- * |         Label Length          |       Protocol Length         |
- * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
- */
-#define DCEP_MESSAGE_TYPE_OFFSET                0
-#define DCEP_MESSAGE_TYPE_LENGTH                1
-#define DCEP_CHANNEL_TYPE_OFFSET                1
-#define DCEP_PRIORITY_OFFSET                    2
-#define DCEP_RELIABILITY_PARAMETER_OFFSET       4
-#define DCEP_LABEL_LENGTH_OFFSET                8
-#define DCEP_PROTOCOL_LENGTH_OFFSET             10
-
-/* DCEP DATA_CHANNEL_ACK Message:
- *
- * RFC - https://datatracker.ietf.org/doc/html/draft-ietf-rtcweb-data-protocol-09#section-5.2
- *
- *  0                   1                   2                   3
- *  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
- * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
- * |  Message Type |
- * +-+-+-+-+-+-+-+-+
- */
-#define DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH    1
+            DCEP_METRICS_INCREMENT( pCtx, channelOpenMessagesDeserialized );
+            DCEP_METRICS_ADD( pCtx, bytesDeserialized, dcepMessageLength );
+        }
+    }
+
+    DCEP_PROFILING_STOP( pCtx, DCEP_PROFILED_FUNCTION_INIT_CHANNEL_OPEN_VIEW, profilingStart );
+
+    return result;
+}
 
 /*-----------------------------------------------------------*/
 
-DcepResult_t Dcep_Init( DcepContext_t * pCtx )
+DcepResult_t Dcep_StreamingParserInit( DcepContext_t * pCtx,
+                                       DcepStreamingParser_t * pParser )
 {
     DcepResult_t result = DCEP_RESULT_OK;
 
-    if( pCtx == NULL )
+    DCEP_PROFILING_START( profilingStart );
+
+    if( ( pCtx == NULL ) ||
+        ( pParser == NULL ) )
     {
         result = DCEP_RESULT_BAD_PARAM;
     }
 
     if( result == DCEP_RESULT_OK )
     {
-        Dcep_InitReadWriteFunctions( &( pCtx->readWriteFunctions ) );
+        memset( pParser, 0, sizeof( DcepStreamingParser_t ) );
+        pParser->state = DCEP_STREAMING_PARSER_STATE_HEADER;
     }
 
+    DCEP_PROFILING_STOP( pCtx, DCEP_PROFILED_FUNCTION_STREAMING_PARSER_INIT, profilingStart );
+
     return result;
 }
 
 /*-----------------------------------------------------------*/
 
-DcepResult_t Dcep_SerializeChannelOpenMessage( DcepContext_t * pCtx,
-                                               const DcepChannelOpenMessage_t * pChannelOpenMessage,
-                                               uint8_t * pBuffer,
-                                               size_t * pBufferLength )
+static void ConsumeFieldSegment( DcepStreamingParser_t * pParser,
+                                 const uint8_t * pChunk,
+                                 size_t chunkLength,
+                                 size_t * pOffset,
+                                 DcepIoVec_t * pSegment )
+{
+    size_t segmentLength = chunkLength - *pOffset;
+
+    if( segmentLength > pParser->remainingFieldLength )
+    {
+        segmentLength = pParser->remainingFieldLength;
+    }
+
+    if( segmentLength > 0 )
+    {
+        pSegment->pBase = &( pChunk[ *pOffset ] );
+        pSegment->length = segmentLength;
+
+        *pOffset += segmentLength;
+        pParser->remainingFieldLength -= segmentLength;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_StreamingParserFeed( DcepContext_t * pCtx,
+                                       DcepStreamingParser_t * pParser,
+                                       const uint8_t * pChunk,
+                                       size_t chunkLength,
+                                       DcepStreamingParserOutput_t * pOutput )
 {
     DcepResult_t result = DCEP_RESULT_OK;
-    uint32_t reliabilityValue = 0;
-    size_t serializedMessageLength = 0;
+    size_t offset = 0;
+    size_t copyLength;
+
+    DCEP_PROFILING_START( profilingStart );
 
     if( ( pCtx == NULL ) ||
-        ( pChannelOpenMessage == NULL ) ||
-        ( pBuffer == NULL ) ||
-        ( pBufferLength == NULL ) ||
-        ( *pBufferLength < DCEP_HEADER_LENGTH ) )
+        ( pParser == NULL ) ||
+        ( pChunk == NULL ) ||
+        ( pOutput == NULL ) ||
+        ( pParser->state == DCEP_STREAMING_PARSER_STATE_COMPLETE ) ||
+        ( pParser->state == DCEP_STREAMING_PARSER_STATE_ERROR ) )
     {
         result = DCEP_RESULT_BAD_PARAM;
     }
 
     if( result == DCEP_RESULT_OK )
     {
-        pBuffer[ DCEP_MESSAGE_TYPE_OFFSET ] = DCEP_MESSAGE_DATA_CHANNEL_OPEN;
-        pBuffer[ DCEP_CHANNEL_TYPE_OFFSET ] = pChannelOpenMessage->channelType;
+        memset( pOutput, 0, sizeof( DcepStreamingParserOutput_t ) );
+    }
 
-        DCEP_WRITE_UINT16( &( pBuffer[ DCEP_PRIORITY_OFFSET ] ),
-                           pChannelOpenMessage->priority );
+    /* Buffer the header until all of it has arrived, then decode it. */
+    if( ( result == DCEP_RESULT_OK ) &&
+        ( pParser->state == DCEP_STREAMING_PARSER_STATE_HEADER ) )
+    {
+        copyLength = DCEP_HEADER_LENGTH - pParser->headerLength;
 
-        if( ( pChannelOpenMessage->channelType == DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT ) ||
-            ( pChannelOpenMessage->channelType == DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED ) )
-        {
-            reliabilityValue = pChannelOpenMessage->numRetransmissions;
-        }
-        else if( ( pChannelOpenMessage->channelType == DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED ) ||
-                 ( pChannelOpenMessage->channelType == DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED ) )
-        {
-            reliabilityValue = pChannelOpenMessage->maxLifetimeInMilliseconds;
-        }
-        else
+        if( copyLength > chunkLength )
         {
-            reliabilityValue = 0;
+            copyLength = chunkLength;
         }
 
-        DCEP_WRITE_UINT32( &( pBuffer[ DCEP_RELIABILITY_PARAMETER_OFFSET ] ),
-                           reliabilityValue );
-
-        DCEP_WRITE_UINT16( &( pBuffer[ DCEP_LABEL_LENGTH_OFFSET ] ),
-                           pChannelOpenMessage->channelNameLength );
+        memcpy( &( pParser->header[ pParser->headerLength ] ),
+                pChunk,
+                copyLength );
 
-        DCEP_WRITE_UINT16( &( pBuffer[ DCEP_PROTOCOL_LENGTH_OFFSET ] ),
-                           pChannelOpenMessage->protocolLength );
-
-        serializedMessageLength += DCEP_HEADER_LENGTH;
-    }
+        pParser->headerLength += copyLength;
+        offset += copyLength;
 
-    if( result == DCEP_RESULT_OK )
-    {
-        if( pChannelOpenMessage->channelNameLength > 0 )
+        if( pParser->headerLength == DCEP_HEADER_LENGTH )
         {
-            if( *pBufferLength < ( serializedMessageLength + pChannelOpenMessage->channelNameLength ) )
+            if( pParser->header[ DCEP_MESSAGE_TYPE_OFFSET ] != DCEP_MESSAGE_DATA_CHANNEL_OPEN )
             {
-                result = DCEP_RESULT_OUT_OF_MEMORY;
+                DCEP_METRICS_INCREMENT( pCtx, malformedMessageType );
+                result = DCEP_RESULT_MALFORMED_MESSAGE;
             }
             else
             {
-                memcpy( &( pBuffer[ serializedMessageLength ] ),
-                        pChannelOpenMessage->pChannelName,
-                        pChannelOpenMessage->channelNameLength );
+                result = DecodeChannelOpenHeader( pCtx,
+                                                  &( pParser->header[ 0 ] ),
+                                                  &( pParser->channelOpenMessage ) );
+            }
+
+            if( result == DCEP_RESULT_OK )
+            {
+                pParser->channelOpenMessage.pChannelName = NULL;
+                pParser->channelOpenMessage.pProtocol = NULL;
+                pParser->remainingFieldLength = pParser->channelOpenMessage.channelNameLength;
+                pParser->state = DCEP_STREAMING_PARSER_STATE_LABEL;
+
+                #if defined( DCEP_ENABLE_STRICT_UTF8 )
+                    pParser->utf8State = DCEP_UTF8_ACCEPT;
+                #endif
 
-                serializedMessageLength += pChannelOpenMessage->channelNameLength;
+                pOutput->headerDecoded = 1;
+            }
+            else
+            {
+                pParser->state = DCEP_STREAMING_PARSER_STATE_ERROR;
             }
         }
     }
 
-    if( result == DCEP_RESULT_OK )
+    if( ( result == DCEP_RESULT_OK ) &&
+        ( pParser->state == DCEP_STREAMING_PARSER_STATE_LABEL ) )
     {
-        if( pChannelOpenMessage->protocolLength > 0 )
+        ConsumeFieldSegment( pParser,
+                             pChunk,
+                             chunkLength,
+                             &( offset ),
+                             &( pOutput->labelSegment ) );
+
+        #if defined( DCEP_ENABLE_STRICT_UTF8 )
+            result = ValidateFieldSegmentUtf8( pCtx,
+                                               pParser,
+                                               &( pOutput->labelSegment ) );
+        #endif
+
+        if( result != DCEP_RESULT_OK )
         {
-            if( *pBufferLength < ( serializedMessageLength + pChannelOpenMessage->protocolLength ) )
-            {
-                result = DCEP_RESULT_OUT_OF_MEMORY;
-            }
-            else
-            {
-                memcpy( &( pBuffer[ serializedMessageLength ] ),
-                        pChannelOpenMessage->pProtocol,
-                        pChannelOpenMessage->protocolLength );
+            pParser->state = DCEP_STREAMING_PARSER_STATE_ERROR;
+        }
+        else if( pParser->remainingFieldLength == 0 )
+        {
+            pParser->remainingFieldLength = pParser->channelOpenMessage.protocolLength;
+            pParser->state = DCEP_STREAMING_PARSER_STATE_PROTOCOL;
 
-                serializedMessageLength += pChannelOpenMessage->protocolLength;
-            }
+            #if defined( DCEP_ENABLE_STRICT_UTF8 )
+                pParser->utf8State = DCEP_UTF8_ACCEPT;
+            #endif
+        }
+    }
+
+    if( ( result == DCEP_RESULT_OK ) &&
+        ( pParser->state == DCEP_STREAMING_PARSER_STATE_PROTOCOL ) )
+    {
+        ConsumeFieldSegment( pParser,
+                             pChunk,
+                             chunkLength,
+                             &( offset ),
+                             &( pOutput->protocolSegment ) );
+
+        #if defined( DCEP_ENABLE_STRICT_UTF8 )
+            result = ValidateFieldSegmentUtf8( pCtx,
+                                               pParser,
+                                               &( pOutput->protocolSegment ) );
+        #endif
+
+        if( result != DCEP_RESULT_OK )
+        {
+            pParser->state = DCEP_STREAMING_PARSER_STATE_ERROR;
+        }
+        else if( pParser->remainingFieldLength == 0 )
+        {
+            pParser->state = DCEP_STREAMING_PARSER_STATE_COMPLETE;
+            pOutput->messageComplete = 1;
+
+            DCEP_METRICS_INCREMENT( pCtx, channelOpenMessagesDeserialized );
+            DCEP_METRICS_ADD( pCtx,
+                              bytesDeserialized,
+                              DCEP_HEADER_LENGTH +
+                              pParser->channelOpenMessage.channelNameLength +
+                              pParser->channelOpenMessage.protocolLength );
         }
     }
 
     if( result == DCEP_RESULT_OK )
     {
-        *pBufferLength = serializedMessageLength;
+        pOutput->consumedLength = offset;
     }
 
+    DCEP_PROFILING_STOP( pCtx, DCEP_PROFILED_FUNCTION_STREAMING_PARSER_FEED, profilingStart );
+
     return result;
 }
 
 /*-----------------------------------------------------------*/
 
-DcepResult_t Dcep_SerializeChannelAckMessage( DcepContext_t * pCtx,
-                                              uint8_t * pBuffer,
-                                              size_t * pBufferLength )
+DcepResult_t Dcep_GetMessageType( DcepContext_t * pCtx,
+                                  const uint8_t * pDcepMessage,
+                                  size_t dcepMessageLength,
+                                  DcepMessageType_t * pDcepMessageType )
 {
     DcepResult_t result = DCEP_RESULT_OK;
 
+    DCEP_PROFILING_START( profilingStart );
+
     if( ( pCtx == NULL ) ||
-        ( pBuffer == NULL ) ||
-        ( pBufferLength == NULL ) ||
-        ( *pBufferLength < DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH ) )
+        ( pDcepMessage == NULL ) ||
+        ( dcepMessageLength == 0 ) ||
+        ( pDcepMessageType == NULL ) )
     {
         result = DCEP_RESULT_BAD_PARAM;
     }
 
     if( result == DCEP_RESULT_OK )
     {
-        pBuffer[ DCEP_MESSAGE_TYPE_OFFSET ] = DCEP_MESSAGE_DATA_CHANNEL_ACK;
-        *pBufferLength = DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH;
+        if( ( DCEP_GET_DESCRIPTOR( pDcepMessage[ DCEP_MESSAGE_TYPE_OFFSET ] ) & DCEP_DESCRIPTOR_MESSAGE_TYPE_VALID ) != 0U )
+        {
+            *pDcepMessageType = ( DcepMessageType_t ) pDcepMessage[ DCEP_MESSAGE_TYPE_OFFSET ];
+
+            #if defined( DCEP_ENABLE_METRICS )
+                /* An ACK carries nothing to deserialize, so it is counted here. */
+                if( *pDcepMessageType == DCEP_MESSAGE_DATA_CHANNEL_ACK )
+                {
+                    DCEP_METRICS_INCREMENT( pCtx, channelAckMessagesDeserialized );
+                    DCEP_METRICS_ADD( pCtx, bytesDeserialized, dcepMessageLength );
+                }
+            #endif
+        }
+        else
+        {
+            DCEP_METRICS_INCREMENT( pCtx, malformedMessageType );
+            result = DCEP_RESULT_MALFORMED_MESSAGE;
+        }
     }
 
+    DCEP_PROFILING_STOP( pCtx, DCEP_PROFILED_FUNCTION_GET_MESSAGE_TYPE, profilingStart );
+
     return result;
 }
 
 /*-----------------------------------------------------------*/
 
-DcepResult_t Dcep_DeserializeChannelOpenMessage( DcepContext_t * pCtx,
-                                                 const uint8_t * pDcepMessage,
-                                                 size_t dcepMessageLength,
-                                                 DcepChannelOpenMessage_t * pChannelOpenMessage )
+DcepPayloadClass_t Dcep_ClassifyPayload( uint32_t ppid,
+                                         const uint8_t * pPayload,
+                                         size_t payloadLength )
+{
+    static const uint8_t emptyPayload = 0;
+    const uint8_t * pFirstByte;
+    uint32_t row, column, hasPayload;
+
+    /* The PPID and first byte are clamped into the tables instead of being
+     * compared against each value, so the classification is two table
+     * lookups. PPIDs below DCEP_PPID_DCEP wrap around to large rows. An empty
+     * payload reads a zero byte instead and selects the empty column. */
+    row = ppid - ( uint32_t ) DCEP_PPID_DCEP;
+    row = ( row < DCEP_PPID_TABLE_INVALID_ROW ) ? row : DCEP_PPID_TABLE_INVALID_ROW;
+
+    hasPayload = ( uint32_t ) ( pPayload != NULL ) & ( uint32_t ) ( payloadLength != 0 );
+    pFirstByte = ( hasPayload != 0 ) ? pPayload : &( emptyPayload );
+
+    column = *pFirstByte;
+    column = ( column < DCEP_MESSAGE_TYPE_TABLE_LENGTH ) ? column : ( DCEP_MESSAGE_TYPE_TABLE_LENGTH - 1 );
+    column = messageTypeColumns[ column ] * hasPayload;
+
+    return ( DcepPayloadClass_t ) payloadClasses[ row ][ column ];
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_DeserializeBatch( DcepContext_t * pCtx,
+                                    const DcepBatchEntry_t * pEntries,
+                                    size_t numEntries,
+                                    DcepBatchResult_t * pResults )
 {
     DcepResult_t result = DCEP_RESULT_OK;
-    uint32_t reliabilityValue = 0;
-    size_t consumedLength = 0;
+    DcepHeaderBlock_t headerBlock;
+    const DcepBatchEntry_t * pEntry;
+    DcepBatchResult_t * pEntryResult;
+    size_t blockStart, blockLength, i;
+    uint16_t validMask;
+
+    DCEP_PROFILING_START( profilingStart );
 
     if( ( pCtx == NULL ) ||
-        ( pDcepMessage == NULL ) ||
-        ( pChannelOpenMessage == NULL ) ||
-        ( dcepMessageLength < DCEP_HEADER_LENGTH ) ||
-        ( pDcepMessage[ DCEP_MESSAGE_TYPE_OFFSET ] != DCEP_MESSAGE_DATA_CHANNEL_OPEN ) )
+        ( pEntries == NULL ) ||
+        ( numEntries == 0 ) ||
+        ( pResults == NULL ) )
     {
         result = DCEP_RESULT_BAD_PARAM;
     }
 
-    if( result == DCEP_RESULT_OK )
+    for( blockStart = 0; ( result == DCEP_RESULT_OK ) && ( blockStart < numEntries ); blockStart += DCEP_HEADER_BLOCK_SIZE )
     {
-        pChannelOpenMessage->channelType = pDcepMessage[ DCEP_CHANNEL_TYPE_OFFSET ];
-        pChannelOpenMessage->priority = DCEP_READ_UINT16( &( pDcepMessage[ DCEP_PRIORITY_OFFSET ] ) );
+        blockLength = numEntries - blockStart;
 
-        reliabilityValue = DCEP_READ_UINT32( &( pDcepMessage[ DCEP_RELIABILITY_PARAMETER_OFFSET ] ) );
+        if( blockLength > DCEP_HEADER_BLOCK_SIZE )
+        {
+            blockLength = DCEP_HEADER_BLOCK_SIZE;
+        }
 
-        pChannelOpenMessage->channelNameLength = DCEP_READ_UINT16( &( pDcepMessage[ DCEP_LABEL_LENGTH_OFFSET ] ) );
-        pChannelOpenMessage->protocolLength = DCEP_READ_UINT16( &( pDcepMessage[ DCEP_PROTOCOL_LENGTH_OFFSET ] ) );
+        /* Validate the headers of the whole block at once. Only the entries
+         * rejected by the kernel (ACKs and invalid messages) go through the
+         * per-message path. */
+        LoadHeaderBlock( &( pEntries[ blockStart ] ),
+                         blockLength,
+                         &( headerBlock ) );
 
-        consumedLength += DCEP_HEADER_LENGTH;
+        validMask = pCtx->validateHeaderBlockFn( &( headerBlock ),
+                                                 blockLength );
 
-        if( ( pChannelOpenMessage->channelType == DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT ) ||
-            ( pChannelOpenMessage->channelType == DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED ) )
-        {
-            pChannelOpenMessage->numRetransmissions = reliabilityValue;
-        }
-        else if( ( pChannelOpenMessage->channelType == DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED ) ||
-                 ( pChannelOpenMessage->channelType == DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED ) )
-        {
-            pChannelOpenMessage->maxLifetimeInMilliseconds = reliabilityValue;
-        }
-        else if( ( pChannelOpenMessage->channelType == DCEP_DATA_CHANNEL_RELIABLE ) ||
-                 ( pChannelOpenMessage->channelType == DCEP_DATA_CHANNEL_RELIABLE_UNORDERED ) )
-        {
-            /* reliabilityValue is ignored. */
-        }
-        else
-        {
-            result = DCEP_RESULT_MALFORMED_MESSAGE;
-        }
-    }
+        /* Entries whose label or protocol is not UTF-8 are left to the
+         * per-message path, which rejects and counts them. */
+        #if defined( DCEP_ENABLE_STRICT_UTF8 )
+            validMask = ValidateHeaderBlockUtf8( pCtx,
+                                                 &( headerBlock ),
+                                                 &( pEntries[ blockStart ] ),
+                                                 blockLength,
+                                                 validMask );
+        #endif
 
-    if( result == DCEP_RESULT_OK )
-    {
-        if( pChannelOpenMessage->channelNameLength > 0 )
+        for( i = 0; i < blockLength; i++ )
         {
-            if( dcepMessageLength < ( consumedLength + pChannelOpenMessage->channelNameLength ) )
+            pEntry = &( pEntries[ blockStart + i ] );
+            pEntryResult = &( pResults[ blockStart + i ] );
+
+            pEntryResult->streamId = pEntry->streamId;
+
+            if( ( validMask & ( 1U << i ) ) != 0 )
             {
-                result = DCEP_RESULT_MALFORMED_MESSAGE;
+                pEntryResult->messageType = DCEP_MESSAGE_DATA_CHANNEL_OPEN;
+                pEntryResult->result = DCEP_RESULT_OK;
+
+                DecodeHeaderBlockEntry( &( headerBlock ),
+                                        i,
+                                        pEntry->pDcepMessage,
+                                        &( pEntryResult->channelOpenMessage ) );
+
+                DCEP_METRICS_INCREMENT( pCtx, channelOpenMessagesDeserialized );
+                DCEP_METRICS_ADD( pCtx, bytesDeserialized, pEntry->dcepMessageLength );
             }
             else
             {
-                pChannelOpenMessage->pChannelName = &( pDcepMessage[ consumedLength ] );
-                consumedLength += pChannelOpenMessage->channelNameLength;
+                DeserializeBatchEntry( pCtx,
+                                       pEntry,
+                                       pEntryResult );
             }
         }
-        else
-        {
-            pChannelOpenMessage->pChannelName = NULL;
-        }
+    }
+
+    DCEP_PROFILING_STOP( pCtx, DCEP_PROFILED_FUNCTION_DESERIALIZE_BATCH, profilingStart );
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+#if defined( DCEP_ENABLE_METRICS )
+
+DcepResult_t Dcep_GetMetrics( DcepContext_t * pCtx,
+                              DcepMetrics_t * pMetrics )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pMetrics == NULL ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
     }
 
     if( result == DCEP_RESULT_OK )
     {
-        if( pChannelOpenMessage->protocolLength > 0 )
-        {
-            if( dcepMessageLength < ( consumedLength + pChannelOpenMessage->protocolLength ) )
-            {
-                result = DCEP_RESULT_MALFORMED_MESSAGE;
-            }
-            else
-            {
-                pChannelOpenMessage->pProtocol = &( pDcepMessage[ consumedLength ] );
-                consumedLength += pChannelOpenMessage->protocolLength;
-            }
-        }
-        else
-        {
-            pChannelOpenMessage->pProtocol = NULL;
-        }
+        memcpy( pMetrics, &( pCtx->metrics ), sizeof( DcepMetrics_t ) );
     }
 
     return result;
@@ -291,35 +1430,67 @@ DcepResult_t Dcep_DeserializeChannelOpenMessage( DcepContext_t * pCtx,
 
 /*-----------------------------------------------------------*/
 
-DcepResult_t Dcep_GetMessageType( DcepContext_t * pCtx,
-                                  const uint8_t * pDcepMessage,
-                                  size_t dcepMessageLength,
-                                  DcepMessageType_t * pDcepMessageType )
+DcepResult_t Dcep_ResetMetrics( DcepContext_t * pCtx )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( pCtx == NULL )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        memset( &( pCtx->metrics ), 0, sizeof( DcepMetrics_t ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_ENABLE_METRICS */
+
+#if defined( DCEP_ENABLE_PROFILING )
+
+DcepResult_t Dcep_GetProfile( DcepContext_t * pCtx,
+                              DcepProfile_t * pProfile )
 {
     DcepResult_t result = DCEP_RESULT_OK;
 
     if( ( pCtx == NULL ) ||
-        ( pDcepMessage == NULL ) ||
-        ( dcepMessageLength == 0 ) ||
-        ( pDcepMessageType == NULL ) )
+        ( pProfile == NULL ) )
     {
         result = DCEP_RESULT_BAD_PARAM;
     }
 
     if( result == DCEP_RESULT_OK )
     {
-        if( ( pDcepMessage[ DCEP_MESSAGE_TYPE_OFFSET ] == DCEP_MESSAGE_DATA_CHANNEL_OPEN ) ||
-            ( pDcepMessage[ DCEP_MESSAGE_TYPE_OFFSET ] == DCEP_MESSAGE_DATA_CHANNEL_ACK ) )
-        {
-            *pDcepMessageType = pDcepMessage[ DCEP_MESSAGE_TYPE_OFFSET ];
-        }
-        else
-        {
-            result = DCEP_RESULT_MALFORMED_MESSAGE;
-        }
+        memcpy( pProfile, &( pCtx->profile ), sizeof( DcepProfile_t ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ResetProfile( DcepContext_t * pCtx )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( pCtx == NULL )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        memset( &( pCtx->profile ), 0, sizeof( DcepProfile_t ) );
     }
 
     return result;
 }
 
 /*-----------------------------------------------------------*/
+
+#endif /* DCEP_ENABLE_PROFILING */
@@ -0,0 +1,134 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "dcep_arena.h"
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ArenaInit( DcepArena_t * pArena,
+                             void * pMemory,
+                             size_t memorySize )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( ( pArena == NULL ) ||
+        ( ( pMemory == NULL ) && ( memorySize > 0 ) ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        pArena->pMemory = ( uint8_t * ) pMemory;
+        pArena->size = memorySize;
+        pArena->used = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ArenaAllocate( DcepArena_t * pArena,
+                                 size_t length,
+                                 uint8_t ** ppAllocation )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( ( pArena == NULL ) ||
+        ( ppAllocation == NULL ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        if( length > ( pArena->size - pArena->used ) )
+        {
+            result = DCEP_RESULT_OUT_OF_MEMORY;
+        }
+        else
+        {
+            *ppAllocation = &( pArena->pMemory[ pArena->used ] );
+            pArena->used += length;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ArenaCopyChannelOpenMessage( DcepArena_t * pArena,
+                                               const DcepChannelOpenMessage_t * pSrc,
+                                               DcepChannelOpenMessage_t * pDst )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    uint8_t * pAllocation = NULL;
+    const uint8_t * pChannelName = NULL;
+    const uint8_t * pProtocol = NULL;
+
+    if( ( pArena == NULL ) ||
+        ( pSrc == NULL ) ||
+        ( pDst == NULL ) ||
+        ( ( pSrc->pChannelName == NULL ) && ( pSrc->channelNameLength > 0 ) ) ||
+        ( ( pSrc->pProtocol == NULL ) && ( pSrc->protocolLength > 0 ) ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = Dcep_ArenaAllocate( pArena,
+                                     ( size_t ) pSrc->channelNameLength + ( size_t ) pSrc->protocolLength,
+                                     &( pAllocation ) );
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        /* Empty fields stay NULL, as returned by the deserializer. */
+        if( pSrc->channelNameLength > 0 )
+        {
+            memcpy( pAllocation, pSrc->pChannelName, pSrc->channelNameLength );
+            pChannelName = pAllocation;
+        }
+
+        if( pSrc->protocolLength > 0 )
+        {
+            memcpy( &( pAllocation[ pSrc->channelNameLength ] ), pSrc->pProtocol, pSrc->protocolLength );
+            pProtocol = &( pAllocation[ pSrc->channelNameLength ] );
+        }
+
+        if( pDst != pSrc )
+        {
+            *pDst = *pSrc;
+        }
+
+        pDst->pChannelName = pChannelName;
+        pDst->pProtocol = pProtocol;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ArenaReset( DcepArena_t * pArena )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( pArena == NULL )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        pArena->used = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
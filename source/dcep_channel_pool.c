@@ -0,0 +1,166 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "dcep_channel_pool.h"
+
+/*-----------------------------------------------------------*/
+
+#define DCEP_CHANNEL_POOL_BLOCK( pPool, index ) \
+    ( ( DcepChannel_t * ) &( ( pPool )->pBlocks[ ( index ) * DCEP_CHANNEL_POOL_BLOCK_SIZE ] ) )
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelPoolGetMemorySize( size_t capacity,
+                                            size_t * pMemorySize )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( ( pMemorySize == NULL ) ||
+        ( capacity == 0 ) ||
+        ( capacity > DCEP_CHANNEL_POOL_MAX_CAPACITY ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        *pMemorySize = capacity * DCEP_CHANNEL_POOL_BLOCK_SIZE;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelPoolInit( DcepChannelPool_t * pPool,
+                                   void * pMemory,
+                                   size_t memorySize,
+                                   size_t capacity )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t requiredMemorySize = 0;
+    DcepChannel_t * pChannel;
+    size_t i;
+
+    if( ( pPool == NULL ) ||
+        ( pMemory == NULL ) ||
+        ( ( ( uintptr_t ) pMemory & ( DCEP_CACHE_LINE_SIZE - 1 ) ) != 0 ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = Dcep_ChannelPoolGetMemorySize( capacity,
+                                                &( requiredMemorySize ) );
+    }
+
+    if( ( result == DCEP_RESULT_OK ) &&
+        ( memorySize < requiredMemorySize ) )
+    {
+        result = DCEP_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        pPool->pBlocks = ( uint8_t * ) pMemory;
+        pPool->pFreeList = NULL;
+        pPool->capacity = capacity;
+        pPool->freeCount = capacity;
+
+        /* Thread the list backwards so that blocks are handed out in address
+         * order. */
+        for( i = capacity; i > 0; i-- )
+        {
+            pChannel = DCEP_CHANNEL_POOL_BLOCK( pPool, i - 1 );
+            pChannel->allocated = 0;
+            pChannel->pNextFree = pPool->pFreeList;
+            pPool->pFreeList = pChannel;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelPoolAllocate( DcepChannelPool_t * pPool,
+                                       DcepChannel_t ** ppChannel )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    DcepChannel_t * pChannel;
+
+    if( ( pPool == NULL ) ||
+        ( ppChannel == NULL ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == DCEP_RESULT_OK ) &&
+        ( pPool->pFreeList == NULL ) )
+    {
+        result = DCEP_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        pChannel = pPool->pFreeList;
+        pPool->pFreeList = pChannel->pNextFree;
+        pPool->freeCount--;
+
+        memset( pChannel, 0, sizeof( DcepChannel_t ) );
+        pChannel->state = DCEP_CHANNEL_STATE_CLOSED;
+        pChannel->allocated = 1;
+
+        *ppChannel = pChannel;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelPoolFree( DcepChannelPool_t * pPool,
+                                   DcepChannel_t * pChannel )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t offset = 0;
+
+    if( ( pPool == NULL ) ||
+        ( pChannel == NULL ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        /* Reject pointers outside the pool or into the middle of a block. */
+        offset = ( size_t ) ( ( uintptr_t ) pChannel - ( uintptr_t ) pPool->pBlocks );
+
+        if( ( ( uintptr_t ) pChannel < ( uintptr_t ) pPool->pBlocks ) ||
+            ( offset >= ( pPool->capacity * DCEP_CHANNEL_POOL_BLOCK_SIZE ) ) ||
+            ( ( offset % DCEP_CHANNEL_POOL_BLOCK_SIZE ) != 0 ) )
+        {
+            result = DCEP_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( ( result == DCEP_RESULT_OK ) &&
+        ( pChannel->allocated == 0U ) )
+    {
+        result = DCEP_RESULT_INVALID_STATE;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        pChannel->allocated = 0;
+        pChannel->pNextFree = pPool->pFreeList;
+        pPool->pFreeList = pChannel;
+        pPool->freeCount++;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,633 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "dcep_channel_registry.h"
+#include "dcep_hash.h"
+
+/*-----------------------------------------------------------*/
+
+/* Stream ids are hashed with Fibonacci hashing: the id is multiplied by
+ * 2^16 / golden ratio and the top bits of the 16-bit product select the home
+ * slot. This spreads both sequential ids and ids that differ only in their
+ * high bits across the table. */
+#define DCEP_CHANNEL_REGISTRY_HASH_MULTIPLIER    0x9E37U
+
+#define DCEP_CHANNEL_REGISTRY_MIN_CAPACITY       2
+
+/*-----------------------------------------------------------*/
+
+static size_t HomeSlot( const DcepChannelRegistry_t * pRegistry,
+                        uint16_t streamId )
+{
+    uint32_t hash = ( ( uint32_t ) streamId * DCEP_CHANNEL_REGISTRY_HASH_MULTIPLIER ) & 0xFFFFU;
+
+    return ( size_t ) ( hash >> pRegistry->hashShift );
+}
+
+/*-----------------------------------------------------------*/
+
+/* Returns the slot holding streamId or, if it is not registered, the empty
+ * slot that ends its probe sequence. One slot is always empty, so the probe
+ * terminates. */
+static size_t ProbeSlot( const DcepChannelRegistry_t * pRegistry,
+                         uint16_t streamId )
+{
+    size_t mask = pRegistry->capacity - 1;
+    size_t slot = HomeSlot( pRegistry, streamId );
+
+    while( ( pRegistry->pStreamIds[ slot ] != streamId ) &&
+           ( pRegistry->pStreamIds[ slot ] != DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID ) )
+    {
+        slot = ( slot + 1 ) & mask;
+    }
+
+    return slot;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint32_t HashLabel( const DcepChannelRegistry_t * pRegistry,
+                           size_t slot )
+{
+    return Dcep_HashBytes( 0,
+                           pRegistry->pLabels[ slot ].pChannelName,
+                           pRegistry->pLabels[ slot ].channelNameLength );
+}
+
+/*-----------------------------------------------------------*/
+
+static int IsSameLabel( const DcepChannelRegistry_t * pRegistry,
+                        size_t slot,
+                        const uint8_t * pChannelName,
+                        size_t channelNameLength )
+{
+    return ( pRegistry->pLabels[ slot ].channelNameLength == channelNameLength ) &&
+           ( ( channelNameLength == 0 ) ||
+             ( memcmp( pRegistry->pLabels[ slot ].pChannelName, pChannelName, channelNameLength ) == 0 ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/* Adds the channel in a registry slot to the label index. The index has as
+ * many slots as the registry, so there is always an empty one. */
+static void IndexLabel( DcepChannelRegistry_t * pRegistry,
+                        size_t slot )
+{
+    DcepChannelLabelIndex_t * pIndex = &( pRegistry->labelIndex );
+    size_t mask = pRegistry->capacity - 1;
+    uint32_t hash = HashLabel( pRegistry, slot );
+    size_t indexSlot = ( size_t ) hash & mask;
+
+    while( pIndex->pStreamIds[ indexSlot ] != DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID )
+    {
+        indexSlot = ( indexSlot + 1 ) & mask;
+    }
+
+    pIndex->pHashes[ indexSlot ] = hash;
+    pIndex->pStreamIds[ indexSlot ] = pRegistry->pStreamIds[ slot ];
+}
+
+/*-----------------------------------------------------------*/
+
+/* Removes the channel in a registry slot from the label index, with the same
+ * backward shift deletion as Dcep_ChannelRegistryRemove. */
+static void UnindexLabel( DcepChannelRegistry_t * pRegistry,
+                          size_t slot )
+{
+    DcepChannelLabelIndex_t * pIndex = &( pRegistry->labelIndex );
+    size_t mask = pRegistry->capacity - 1;
+    size_t holeSlot = ( size_t ) HashLabel( pRegistry, slot ) & mask, indexSlot, homeSlot;
+
+    /* Stream ids are unique, so the entry is the one with the stream id in
+     * the probe sequence of the hash. */
+    while( pIndex->pStreamIds[ holeSlot ] != pRegistry->pStreamIds[ slot ] )
+    {
+        holeSlot = ( holeSlot + 1 ) & mask;
+    }
+
+    indexSlot = ( holeSlot + 1 ) & mask;
+
+    while( pIndex->pStreamIds[ indexSlot ] != DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID )
+    {
+        homeSlot = ( size_t ) pIndex->pHashes[ indexSlot ] & mask;
+
+        if( ( ( indexSlot - homeSlot ) & mask ) >= ( ( indexSlot - holeSlot ) & mask ) )
+        {
+            pIndex->pHashes[ holeSlot ] = pIndex->pHashes[ indexSlot ];
+            pIndex->pStreamIds[ holeSlot ] = pIndex->pStreamIds[ indexSlot ];
+            holeSlot = indexSlot;
+        }
+
+        indexSlot = ( indexSlot + 1 ) & mask;
+    }
+
+    pIndex->pStreamIds[ holeSlot ] = DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID;
+}
+
+/*-----------------------------------------------------------*/
+
+static uint32_t GetReliabilityParameter( const DcepChannelOpenMessage_t * pChannelOpenMessage )
+{
+    uint8_t descriptor = DCEP_GET_DESCRIPTOR( pChannelOpenMessage->channelType );
+
+    /* Reliable channels have no reliability parameter. */
+    return ( pChannelOpenMessage->numRetransmissions & DCEP_DESCRIPTOR_MASK( descriptor, DCEP_DESCRIPTOR_REXMIT ) ) |
+           ( pChannelOpenMessage->maxLifetimeInMilliseconds & DCEP_DESCRIPTOR_MASK( descriptor, DCEP_DESCRIPTOR_TIMED ) );
+}
+
+/*-----------------------------------------------------------*/
+
+static void SetReliabilityParameter( DcepChannelOpenMessage_t * pChannelOpenMessage,
+                                     uint32_t reliabilityValue )
+{
+    uint8_t descriptor = DCEP_GET_DESCRIPTOR( pChannelOpenMessage->channelType );
+
+    pChannelOpenMessage->numRetransmissions = reliabilityValue & DCEP_DESCRIPTOR_MASK( descriptor, DCEP_DESCRIPTOR_REXMIT );
+    pChannelOpenMessage->maxLifetimeInMilliseconds = reliabilityValue & DCEP_DESCRIPTOR_MASK( descriptor, DCEP_DESCRIPTOR_TIMED );
+}
+
+/*-----------------------------------------------------------*/
+
+static void MoveSlot( DcepChannelRegistry_t * pRegistry,
+                      size_t dstSlot,
+                      size_t srcSlot )
+{
+    pRegistry->pStreamIds[ dstSlot ] = pRegistry->pStreamIds[ srcSlot ];
+    pRegistry->pStates[ dstSlot ] = pRegistry->pStates[ srcSlot ];
+    pRegistry->pChannelTypes[ dstSlot ] = pRegistry->pChannelTypes[ srcSlot ];
+    pRegistry->pPriorities[ dstSlot ] = pRegistry->pPriorities[ srcSlot ];
+    pRegistry->pReliabilityParameters[ dstSlot ] = pRegistry->pReliabilityParameters[ srcSlot ];
+    pRegistry->pLabels[ dstSlot ] = pRegistry->pLabels[ srcSlot ];
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelRegistryGetMemorySize( size_t capacity,
+                                                size_t * pMemorySize )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( ( pMemorySize == NULL ) ||
+        ( capacity < DCEP_CHANNEL_REGISTRY_MIN_CAPACITY ) ||
+        ( capacity > DCEP_CHANNEL_REGISTRY_MAX_CAPACITY ) ||
+        ( ( capacity & ( capacity - 1 ) ) != 0 ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        *pMemorySize = capacity * ( sizeof( DcepChannelRegistryLabel_t ) +
+                                    sizeof( uint32_t ) +
+                                    sizeof( uint16_t ) +
+                                    sizeof( uint16_t ) +
+                                    sizeof( uint8_t ) +
+                                    sizeof( uint8_t ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelRegistryInit( DcepChannelRegistry_t * pRegistry,
+                                       void * pMemory,
+                                       size_t memorySize,
+                                       size_t capacity )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t requiredMemorySize = 0;
+    uint8_t * pCursor = ( uint8_t * ) pMemory;
+    size_t i;
+
+    if( ( pRegistry == NULL ) ||
+        ( pMemory == NULL ) ||
+        ( ( ( uintptr_t ) pMemory & ( sizeof( void * ) - 1 ) ) != 0 ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = Dcep_ChannelRegistryGetMemorySize( capacity,
+                                                    &( requiredMemorySize ) );
+    }
+
+    if( ( result == DCEP_RESULT_OK ) &&
+        ( memorySize < requiredMemorySize ) )
+    {
+        result = DCEP_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        /* Arrays are laid out in decreasing order of alignment so that each
+         * one starts suitably aligned. */
+        pRegistry->pLabels = ( DcepChannelRegistryLabel_t * ) pCursor;
+        pCursor += capacity * sizeof( DcepChannelRegistryLabel_t );
+
+        pRegistry->pReliabilityParameters = ( uint32_t * ) pCursor;
+        pCursor += capacity * sizeof( uint32_t );
+
+        pRegistry->pStreamIds = ( uint16_t * ) pCursor;
+        pCursor += capacity * sizeof( uint16_t );
+
+        pRegistry->pPriorities = ( uint16_t * ) pCursor;
+        pCursor += capacity * sizeof( uint16_t );
+
+        pRegistry->pStates = pCursor;
+        pCursor += capacity * sizeof( uint8_t );
+
+        pRegistry->pChannelTypes = pCursor;
+
+        pRegistry->labelIndex.pHashes = NULL;
+        pRegistry->labelIndex.pStreamIds = NULL;
+        pRegistry->capacity = capacity;
+        pRegistry->count = 0;
+        pRegistry->hashShift = 16;
+
+        for( i = capacity; i > 1; i >>= 1 )
+        {
+            pRegistry->hashShift--;
+        }
+
+        for( i = 0; i < capacity; i++ )
+        {
+            pRegistry->pStreamIds[ i ] = DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID;
+        }
+
+        memset( pRegistry->pStates, DCEP_CHANNEL_STATE_CLOSED, capacity );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelRegistryInsert( DcepChannelRegistry_t * pRegistry,
+                                         uint16_t streamId,
+                                         DcepChannelState_t state,
+                                         const DcepChannelOpenMessage_t * pChannelOpenMessage )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t slot = 0;
+
+    if( ( pRegistry == NULL ) ||
+        ( pChannelOpenMessage == NULL ) ||
+        ( streamId == DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        slot = ProbeSlot( pRegistry, streamId );
+
+        if( pRegistry->pStreamIds[ slot ] == streamId )
+        {
+            result = DCEP_RESULT_ALREADY_EXISTS;
+        }
+        else if( ( pRegistry->count + 1 ) >= pRegistry->capacity )
+        {
+            result = DCEP_RESULT_OUT_OF_MEMORY;
+        }
+        else
+        {
+            /* slot is the empty slot for streamId. */
+        }
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        pRegistry->pStreamIds[ slot ] = streamId;
+        pRegistry->pStates[ slot ] = ( uint8_t ) state;
+        pRegistry->pChannelTypes[ slot ] = ( uint8_t ) pChannelOpenMessage->channelType;
+        pRegistry->pPriorities[ slot ] = pChannelOpenMessage->priority;
+        pRegistry->pReliabilityParameters[ slot ] = GetReliabilityParameter( pChannelOpenMessage );
+        pRegistry->pLabels[ slot ].pChannelName = pChannelOpenMessage->pChannelName;
+        pRegistry->pLabels[ slot ].channelNameLength = pChannelOpenMessage->channelNameLength;
+        pRegistry->pLabels[ slot ].pProtocol = pChannelOpenMessage->pProtocol;
+        pRegistry->pLabels[ slot ].protocolLength = pChannelOpenMessage->protocolLength;
+
+        if( pRegistry->labelIndex.pHashes != NULL )
+        {
+            IndexLabel( pRegistry, slot );
+        }
+
+        pRegistry->count++;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelRegistryFind( const DcepChannelRegistry_t * pRegistry,
+                                       uint16_t streamId,
+                                       size_t * pIndex )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t slot;
+
+    if( ( pRegistry == NULL ) ||
+        ( pIndex == NULL ) ||
+        ( streamId == DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        slot = ProbeSlot( pRegistry, streamId );
+
+        if( pRegistry->pStreamIds[ slot ] == streamId )
+        {
+            *pIndex = slot;
+        }
+        else
+        {
+            result = DCEP_RESULT_NOT_FOUND;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelRegistryGetState( const DcepChannelRegistry_t * pRegistry,
+                                           uint16_t streamId,
+                                           DcepChannelState_t * pState )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t slot = 0;
+
+    if( pState == NULL )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = Dcep_ChannelRegistryFind( pRegistry, streamId, &( slot ) );
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        *pState = ( DcepChannelState_t ) pRegistry->pStates[ slot ];
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelRegistrySetState( DcepChannelRegistry_t * pRegistry,
+                                           uint16_t streamId,
+                                           DcepChannelState_t state )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t slot = 0;
+
+    result = Dcep_ChannelRegistryFind( pRegistry, streamId, &( slot ) );
+
+    if( result == DCEP_RESULT_OK )
+    {
+        pRegistry->pStates[ slot ] = ( uint8_t ) state;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelRegistryGetChannel( const DcepChannelRegistry_t * pRegistry,
+                                             uint16_t streamId,
+                                             DcepChannelOpenMessage_t * pChannelOpenMessage )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t slot = 0;
+
+    if( pChannelOpenMessage == NULL )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = Dcep_ChannelRegistryFind( pRegistry, streamId, &( slot ) );
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        memset( pChannelOpenMessage, 0, sizeof( DcepChannelOpenMessage_t ) );
+
+        pChannelOpenMessage->channelType = ( DcepChannelType_t ) pRegistry->pChannelTypes[ slot ];
+        pChannelOpenMessage->priority = pRegistry->pPriorities[ slot ];
+        SetReliabilityParameter( pChannelOpenMessage,
+                                 pRegistry->pReliabilityParameters[ slot ] );
+        pChannelOpenMessage->pChannelName = pRegistry->pLabels[ slot ].pChannelName;
+        pChannelOpenMessage->channelNameLength = pRegistry->pLabels[ slot ].channelNameLength;
+        pChannelOpenMessage->pProtocol = pRegistry->pLabels[ slot ].pProtocol;
+        pChannelOpenMessage->protocolLength = pRegistry->pLabels[ slot ].protocolLength;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelRegistryRemove( DcepChannelRegistry_t * pRegistry,
+                                         uint16_t streamId )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t mask, holeSlot = 0, slot, homeSlot;
+
+    result = Dcep_ChannelRegistryFind( pRegistry, streamId, &( holeSlot ) );
+
+    if( ( result == DCEP_RESULT_OK ) &&
+        ( pRegistry->labelIndex.pHashes != NULL ) )
+    {
+        UnindexLabel( pRegistry, holeSlot );
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        mask = pRegistry->capacity - 1;
+        slot = ( holeSlot + 1 ) & mask;
+
+        /* Backward shift deletion: move each following entry of the probe
+         * run into the hole unless its home slot lies cyclically in
+         * ( holeSlot, slot ], in which case it is already reachable. */
+        while( pRegistry->pStreamIds[ slot ] != DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID )
+        {
+            homeSlot = HomeSlot( pRegistry, pRegistry->pStreamIds[ slot ] );
+
+            if( ( ( slot - homeSlot ) & mask ) >= ( ( slot - holeSlot ) & mask ) )
+            {
+                MoveSlot( pRegistry, holeSlot, slot );
+                holeSlot = slot;
+            }
+
+            slot = ( slot + 1 ) & mask;
+        }
+
+        pRegistry->pStreamIds[ holeSlot ] = DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID;
+        pRegistry->pStates[ holeSlot ] = DCEP_CHANNEL_STATE_CLOSED;
+        pRegistry->count--;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelRegistryGetLabelIndexMemorySize( size_t capacity,
+                                                          size_t * pMemorySize )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( ( pMemorySize == NULL ) ||
+        ( capacity < DCEP_CHANNEL_REGISTRY_MIN_CAPACITY ) ||
+        ( capacity > DCEP_CHANNEL_REGISTRY_MAX_CAPACITY ) ||
+        ( ( capacity & ( capacity - 1 ) ) != 0 ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        *pMemorySize = capacity * ( sizeof( uint32_t ) + sizeof( uint16_t ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelRegistryEnableLabelIndex( DcepChannelRegistry_t * pRegistry,
+                                                   void * pMemory,
+                                                   size_t memorySize )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t requiredMemorySize = 0;
+    uint8_t * pCursor = ( uint8_t * ) pMemory;
+    size_t i;
+
+    if( ( pRegistry == NULL ) ||
+        ( pMemory == NULL ) ||
+        ( ( ( uintptr_t ) pMemory & ( sizeof( uint32_t ) - 1 ) ) != 0 ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = Dcep_ChannelRegistryGetLabelIndexMemorySize( pRegistry->capacity,
+                                                              &( requiredMemorySize ) );
+    }
+
+    if( ( result == DCEP_RESULT_OK ) &&
+        ( memorySize < requiredMemorySize ) )
+    {
+        result = DCEP_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        pRegistry->labelIndex.pHashes = ( uint32_t * ) pCursor;
+        pCursor += pRegistry->capacity * sizeof( uint32_t );
+
+        pRegistry->labelIndex.pStreamIds = ( uint16_t * ) pCursor;
+
+        for( i = 0; i < pRegistry->capacity; i++ )
+        {
+            pRegistry->labelIndex.pStreamIds[ i ] = DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID;
+        }
+
+        for( i = 0; i < pRegistry->capacity; i++ )
+        {
+            if( pRegistry->pStreamIds[ i ] != DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID )
+            {
+                IndexLabel( pRegistry, i );
+            }
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelRegistryFindByLabel( const DcepChannelRegistry_t * pRegistry,
+                                              const uint8_t * pChannelName,
+                                              size_t channelNameLength,
+                                              uint16_t * pStreamId )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    const DcepChannelLabelIndex_t * pIndex;
+    size_t mask, indexSlot, slot = 0, i;
+    uint32_t hash;
+    int found = 0;
+
+    if( ( pRegistry == NULL ) ||
+        ( pStreamId == NULL ) ||
+        ( ( pChannelName == NULL ) && ( channelNameLength > 0 ) ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == DCEP_RESULT_OK ) &&
+        ( pRegistry->labelIndex.pHashes != NULL ) )
+    {
+        pIndex = &( pRegistry->labelIndex );
+        mask = pRegistry->capacity - 1;
+        hash = Dcep_HashBytes( 0, pChannelName, channelNameLength );
+
+        /* Only channels whose label has the same hash are compared. */
+        for( indexSlot = ( size_t ) hash & mask;
+             ( found == 0 ) && ( pIndex->pStreamIds[ indexSlot ] != DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID );
+             indexSlot = ( indexSlot + 1 ) & mask )
+        {
+            if( pIndex->pHashes[ indexSlot ] == hash )
+            {
+                slot = ProbeSlot( pRegistry, pIndex->pStreamIds[ indexSlot ] );
+                found = IsSameLabel( pRegistry, slot, pChannelName, channelNameLength );
+            }
+        }
+    }
+    else if( result == DCEP_RESULT_OK )
+    {
+        for( i = 0; ( found == 0 ) && ( i < pRegistry->capacity ); i++ )
+        {
+            if( ( pRegistry->pStreamIds[ i ] != DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID ) &&
+                ( IsSameLabel( pRegistry, i, pChannelName, channelNameLength ) != 0 ) )
+            {
+                slot = i;
+                found = 1;
+            }
+        }
+    }
+    else
+    {
+        /* Bad parameters. */
+    }
+
+    if( ( result == DCEP_RESULT_OK ) && ( found == 0 ) )
+    {
+        result = DCEP_RESULT_NOT_FOUND;
+    }
+    else if( result == DCEP_RESULT_OK )
+    {
+        *pStreamId = pRegistry->pStreamIds[ slot ];
+    }
+    else
+    {
+        /* Bad parameters. */
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,42 @@
+/* API includes. */
+#include "dcep_descriptors.h"
+
+/*-----------------------------------------------------------*/
+
+#define RELIABLE              ( DCEP_DESCRIPTOR_CHANNEL_TYPE_VALID )
+#define REXMIT                ( DCEP_DESCRIPTOR_CHANNEL_TYPE_VALID | DCEP_DESCRIPTOR_REXMIT )
+#define TIMED                 ( DCEP_DESCRIPTOR_CHANNEL_TYPE_VALID | DCEP_DESCRIPTOR_TIMED )
+#define RELIABLE_UNORDERED    ( RELIABLE | DCEP_DESCRIPTOR_UNORDERED )
+#define REXMIT_UNORDERED      ( REXMIT | DCEP_DESCRIPTOR_UNORDERED )
+#define TIMED_UNORDERED       ( TIMED | DCEP_DESCRIPTOR_UNORDERED )
+
+/* 0x02 is both the timed channel type and the DATA_CHANNEL_ACK message type,
+ * 0x03 is the DATA_CHANNEL_OPEN message type. */
+#define TIMED_OR_ACK          ( TIMED | DCEP_DESCRIPTOR_MESSAGE_TYPE_VALID )
+#define OPEN                  ( DCEP_DESCRIPTOR_MESSAGE_TYPE_VALID )
+
+/*-----------------------------------------------------------*/
+
+const uint8_t Dcep_WireByteDescriptors[ 256 ] =
+{
+    /* 0x00 */ RELIABLE, REXMIT, TIMED_OR_ACK, OPEN, 0, 0, 0, 0,
+               0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0x10 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0x20 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0x30 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0x40 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0x50 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0x60 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0x70 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0x80 */ RELIABLE_UNORDERED, REXMIT_UNORDERED, TIMED_UNORDERED, 0, 0, 0, 0, 0,
+               0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0x90 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0xA0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0xB0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0xC0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0xD0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0xE0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    /* 0xF0 */ 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
+};
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,48 @@
+#ifndef DCEP_HASH_H
+#define DCEP_HASH_H
+
+/* Data types includes. */
+#include "dcep_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/* 32-bit FNV-1a parameters. */
+#define DCEP_HASH_FNV_OFFSET_BASIS    2166136261UL
+#define DCEP_HASH_FNV_PRIME           16777619UL
+
+/*-----------------------------------------------------------*/
+
+/* Finalizer of MurmurHash3, so that every bit of the result depends on every
+ * bit of the input. */
+static DCEP_INLINE uint32_t Dcep_MixHash( uint32_t hash )
+{
+    hash ^= hash >> 16;
+    hash *= 0x85EBCA6BUL;
+    hash ^= hash >> 13;
+    hash *= 0xC2B2AE35UL;
+    hash ^= hash >> 16;
+
+    return hash;
+}
+
+/* Hash of a label or protocol: FNV-1a followed by Dcep_MixHash, so that any
+ * subset of the bits can be used to pick a slot. */
+static DCEP_INLINE uint32_t Dcep_HashBytes( uint32_t seed,
+                                            const uint8_t * pData,
+                                            size_t length )
+{
+    uint32_t hash = DCEP_HASH_FNV_OFFSET_BASIS ^ seed;
+    size_t i;
+
+    for( i = 0; i < length; i++ )
+    {
+        hash ^= pData[ i ];
+        hash *= DCEP_HASH_FNV_PRIME;
+    }
+
+    return Dcep_MixHash( hash );
+}
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_HASH_H */
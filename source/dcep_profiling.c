@@ -0,0 +1,129 @@
+/* Needed for clock_gettime. */
+#if !defined( _POSIX_C_SOURCE )
+    #define _POSIX_C_SOURCE    199309L
+#endif
+
+/* API includes. */
+#include "dcep_profiling.h"
+
+#if defined( DCEP_PROFILING_POSIX_CLOCK )
+    #include <time.h>
+#endif
+
+/*-----------------------------------------------------------*/
+
+#define DCEP_LATENCY_HISTOGRAM_LAST_BUCKET    ( DCEP_LATENCY_HISTOGRAM_BUCKETS - 1 )
+
+#define DCEP_PPM                              1000000U
+
+/*-----------------------------------------------------------*/
+
+static uint32_t GetBucketIndex( uint64_t ticks )
+{
+    uint32_t index = 0;
+
+    #if defined( __GNUC__ )
+        if( ticks > 1 )
+        {
+            index = ( uint32_t ) ( 63 - __builtin_clzll( ticks ) );
+        }
+    #else
+        while( ticks > 1 )
+        {
+            ticks >>= 1;
+            index++;
+        }
+    #endif
+
+    if( index > DCEP_LATENCY_HISTOGRAM_LAST_BUCKET )
+    {
+        index = DCEP_LATENCY_HISTOGRAM_LAST_BUCKET;
+    }
+
+    return index;
+}
+
+/*-----------------------------------------------------------*/
+
+void Dcep_LatencyHistogramRecord( DcepLatencyHistogram_t * pHistogram,
+                                  uint64_t ticks )
+{
+    pHistogram->buckets[ GetBucketIndex( ticks ) ]++;
+    pHistogram->count++;
+    pHistogram->totalTicks += ticks;
+
+    if( ticks > pHistogram->maxTicks )
+    {
+        pHistogram->maxTicks = ticks;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+uint64_t Dcep_LatencyHistogramGetQuantile( const DcepLatencyHistogram_t * pHistogram,
+                                           uint32_t quantilePpm )
+{
+    uint64_t upperBound = 0;
+    uint64_t rank, cumulativeCount = 0;
+    uint32_t i;
+
+    if( ( pHistogram != NULL ) &&
+        ( pHistogram->count > 0 ) )
+    {
+        if( quantilePpm > DCEP_PPM )
+        {
+            quantilePpm = DCEP_PPM;
+        }
+
+        /* Number of calls at or below the quantile, rounded up. */
+        rank = ( ( ( uint64_t ) pHistogram->count * quantilePpm ) + ( DCEP_PPM - 1U ) ) / DCEP_PPM;
+
+        if( rank == 0 )
+        {
+            rank = 1;
+        }
+
+        for( i = 0; i < DCEP_LATENCY_HISTOGRAM_LAST_BUCKET; i++ )
+        {
+            cumulativeCount += pHistogram->buckets[ i ];
+
+            if( cumulativeCount >= rank )
+            {
+                break;
+            }
+        }
+
+        if( i == DCEP_LATENCY_HISTOGRAM_LAST_BUCKET )
+        {
+            upperBound = pHistogram->maxTicks;
+        }
+        else
+        {
+            upperBound = ( ( uint64_t ) 1U << ( i + 1U ) ) - 1U;
+
+            if( upperBound > pHistogram->maxTicks )
+            {
+                upperBound = pHistogram->maxTicks;
+            }
+        }
+    }
+
+    return upperBound;
+}
+
+/*-----------------------------------------------------------*/
+
+#if defined( DCEP_PROFILING_POSIX_CLOCK )
+
+uint64_t Dcep_GetMonotonicTimestamp( void )
+{
+    struct timespec now;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &( now ) );
+
+    return ( ( uint64_t ) now.tv_sec * 1000000000U ) + ( uint64_t ) now.tv_nsec;
+}
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_PROFILING_POSIX_CLOCK */
@@ -0,0 +1,253 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "dcep_protocol_table.h"
+#include "dcep_hash.h"
+
+/*-----------------------------------------------------------*/
+
+/* 2^32 / golden ratio, spreads consecutive displacements. */
+#define DCEP_PROTOCOL_TABLE_GOLDEN_RATIO        0x9E3779B9UL
+
+/* With the table at most half full, a bucket almost always finds a
+ * displacement within the first few tries. The limits only bound the work
+ * done when two protocols have the same hash, in which case a new seed is
+ * tried. */
+#if !defined( DCEP_PROTOCOL_TABLE_MAX_DISPLACEMENT )
+    #define DCEP_PROTOCOL_TABLE_MAX_DISPLACEMENT    1024
+#endif
+
+#if !defined( DCEP_PROTOCOL_TABLE_MAX_SEEDS )
+    #define DCEP_PROTOCOL_TABLE_MAX_SEEDS    8
+#endif
+
+/*-----------------------------------------------------------*/
+
+static size_t GetSlot( const DcepProtocolTable_t * pTable,
+                       uint32_t hash,
+                       uint32_t displacement )
+{
+    return ( size_t ) ( Dcep_MixHash( hash ^ ( displacement * DCEP_PROTOCOL_TABLE_GOLDEN_RATIO ) ) & pTable->slotMask );
+}
+
+/*-----------------------------------------------------------*/
+
+static int IsSameProtocol( const uint8_t * pProtocol1,
+                           size_t protocolLength1,
+                           const uint8_t * pProtocol2,
+                           size_t protocolLength2 )
+{
+    return ( protocolLength1 == protocolLength2 ) &&
+           ( ( protocolLength1 == 0 ) ||
+             ( memcmp( pProtocol1, pProtocol2, protocolLength1 ) == 0 ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/* Finds a displacement that sends every protocol of the bucket to a free
+ * slot, and fills those slots. Returns 0 if there is none. */
+static int PlaceBucket( DcepProtocolTable_t * pTable,
+                        const DcepProtocolHandler_t * pHandlers,
+                        size_t numHandlers,
+                        const uint32_t * pHashes,
+                        uint32_t bucket )
+{
+    size_t placedSlots[ DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS ];
+    size_t numPlaced, slot, i;
+    uint32_t displacement;
+    int placed = 0;
+
+    for( displacement = 0; ( placed == 0 ) && ( displacement < DCEP_PROTOCOL_TABLE_MAX_DISPLACEMENT ); displacement++ )
+    {
+        placed = 1;
+        numPlaced = 0;
+
+        for( i = 0; ( placed == 1 ) && ( i < numHandlers ); i++ )
+        {
+            if( ( pHashes[ i ] & pTable->bucketMask ) == bucket )
+            {
+                slot = GetSlot( pTable, pHashes[ i ], displacement );
+
+                if( pTable->handlerIds[ slot ] != DCEP_PROTOCOL_TABLE_NO_HANDLER )
+                {
+                    placed = 0;
+                }
+                else
+                {
+                    pTable->pProtocols[ slot ] = pHandlers[ i ].pProtocol;
+                    pTable->protocolLengths[ slot ] = pHandlers[ i ].protocolLength;
+                    pTable->handlerIds[ slot ] = pHandlers[ i ].handlerId;
+                    placedSlots[ numPlaced++ ] = slot;
+                }
+            }
+        }
+
+        if( placed == 1 )
+        {
+            pTable->displacements[ bucket ] = ( uint16_t ) displacement;
+        }
+        else
+        {
+            /* Undo the protocols of this bucket that did fit. */
+            for( i = 0; i < numPlaced; i++ )
+            {
+                pTable->handlerIds[ placedSlots[ i ] ] = DCEP_PROTOCOL_TABLE_NO_HANDLER;
+            }
+        }
+    }
+
+    return placed;
+}
+
+/*-----------------------------------------------------------*/
+
+static int BuildTable( DcepProtocolTable_t * pTable,
+                       const DcepProtocolHandler_t * pHandlers,
+                       size_t numHandlers,
+                       uint32_t seed )
+{
+    uint32_t hashes[ DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS ];
+    uint8_t bucketSizes[ DCEP_PROTOCOL_TABLE_MAX_BUCKETS ];
+    size_t bucketSize, i;
+    uint32_t bucket;
+    int built = 1;
+
+    pTable->seed = seed;
+    memset( &( pTable->displacements[ 0 ] ), 0, sizeof( pTable->displacements ) );
+    memset( &( pTable->pProtocols[ 0 ] ), 0, sizeof( pTable->pProtocols ) );
+    memset( &( pTable->protocolLengths[ 0 ] ), 0, sizeof( pTable->protocolLengths ) );
+    memset( &( pTable->handlerIds[ 0 ] ), 0xFF, sizeof( pTable->handlerIds ) );
+    memset( &( bucketSizes[ 0 ] ), 0, sizeof( bucketSizes ) );
+
+    for( i = 0; i < numHandlers; i++ )
+    {
+        hashes[ i ] = Dcep_HashBytes( seed,
+                                      pHandlers[ i ].pProtocol,
+                                      pHandlers[ i ].protocolLength );
+        bucketSizes[ hashes[ i ] & pTable->bucketMask ]++;
+    }
+
+    /* Place the largest buckets first, while most slots are still free. */
+    for( bucketSize = numHandlers; ( built == 1 ) && ( bucketSize > 0 ); bucketSize-- )
+    {
+        for( bucket = 0; ( built == 1 ) && ( bucket <= pTable->bucketMask ); bucket++ )
+        {
+            if( bucketSizes[ bucket ] == bucketSize )
+            {
+                built = PlaceBucket( pTable, pHandlers, numHandlers, &( hashes[ 0 ] ), bucket );
+            }
+        }
+    }
+
+    return built;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ProtocolTableInit( DcepProtocolTable_t * pTable,
+                                     const DcepProtocolHandler_t * pHandlers,
+                                     size_t numHandlers )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    uint32_t numSlots = 2, seed;
+    size_t i, j;
+    int built = 0;
+
+    if( ( pTable == NULL ) ||
+        ( pHandlers == NULL ) ||
+        ( numHandlers == 0 ) ||
+        ( numHandlers > DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    for( i = 0; ( result == DCEP_RESULT_OK ) && ( i < numHandlers ); i++ )
+    {
+        if( ( ( pHandlers[ i ].pProtocol == NULL ) && ( pHandlers[ i ].protocolLength > 0 ) ) ||
+            ( pHandlers[ i ].handlerId == DCEP_PROTOCOL_TABLE_NO_HANDLER ) )
+        {
+            result = DCEP_RESULT_BAD_PARAM;
+        }
+    }
+
+    for( i = 0; ( result == DCEP_RESULT_OK ) && ( i < numHandlers ); i++ )
+    {
+        for( j = i + 1; ( result == DCEP_RESULT_OK ) && ( j < numHandlers ); j++ )
+        {
+            if( IsSameProtocol( pHandlers[ i ].pProtocol,
+                                pHandlers[ i ].protocolLength,
+                                pHandlers[ j ].pProtocol,
+                                pHandlers[ j ].protocolLength ) != 0 )
+            {
+                result = DCEP_RESULT_ALREADY_EXISTS;
+            }
+        }
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        while( numSlots < ( 2 * numHandlers ) )
+        {
+            numSlots *= 2;
+        }
+
+        pTable->slotMask = numSlots - 1;
+        pTable->bucketMask = ( numSlots / 2 ) - 1;
+
+        for( seed = 0; ( built == 0 ) && ( seed < DCEP_PROTOCOL_TABLE_MAX_SEEDS ); seed++ )
+        {
+            built = BuildTable( pTable, pHandlers, numHandlers, seed );
+        }
+
+        if( built == 0 )
+        {
+            result = DCEP_RESULT_OUT_OF_MEMORY;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ProtocolTableLookup( const DcepProtocolTable_t * pTable,
+                                       const uint8_t * pProtocol,
+                                       size_t protocolLength,
+                                       uint16_t * pHandlerId )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    uint32_t hash;
+    size_t slot;
+
+    if( ( pTable == NULL ) ||
+        ( pHandlerId == NULL ) ||
+        ( ( pProtocol == NULL ) && ( protocolLength > 0 ) ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        hash = Dcep_HashBytes( pTable->seed, pProtocol, protocolLength );
+        slot = GetSlot( pTable, hash, pTable->displacements[ hash & pTable->bucketMask ] );
+
+        /* The only candidate is the protocol in that slot. */
+        if( ( pTable->handlerIds[ slot ] != DCEP_PROTOCOL_TABLE_NO_HANDLER ) &&
+            ( IsSameProtocol( pTable->pProtocols[ slot ],
+                              pTable->protocolLengths[ slot ],
+                              pProtocol,
+                              protocolLength ) != 0 ) )
+        {
+            *pHandlerId = pTable->handlerIds[ slot ];
+        }
+        else
+        {
+            result = DCEP_RESULT_NOT_FOUND;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,89 @@
+/* API includes. */
+#include "dcep_reliability_policy.h"
+#include "dcep_descriptors.h"
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ReliabilityPolicyInit( DcepReliabilityPolicy_t * pPolicy,
+                                         const DcepChannelOpenMessage_t * pChannelOpenMessage )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    uint8_t descriptor = 0;
+    uint32_t rexmitMask, timedMask;
+
+    if( ( pPolicy == NULL ) ||
+        ( pChannelOpenMessage == NULL ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        descriptor = DCEP_GET_DESCRIPTOR( pChannelOpenMessage->channelType );
+
+        if( ( ( uint32_t ) pChannelOpenMessage->channelType > 0xFFU ) ||
+            ( ( descriptor & DCEP_DESCRIPTOR_CHANNEL_TYPE_VALID ) == 0U ) )
+        {
+            result = DCEP_RESULT_BAD_PARAM;
+        }
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        rexmitMask = DCEP_DESCRIPTOR_MASK( descriptor, DCEP_DESCRIPTOR_REXMIT );
+        timedMask = DCEP_DESCRIPTOR_MASK( descriptor, DCEP_DESCRIPTOR_TIMED );
+
+        pPolicy->maxRetransmissions = ( pChannelOpenMessage->numRetransmissions & rexmitMask ) | ~rexmitMask;
+        pPolicy->maxLifetimeInMilliseconds = ( pChannelOpenMessage->maxLifetimeInMilliseconds & timedMask ) | ~timedMask;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ReliabilityPolicySweep( const DcepReliabilityPolicy_t * pPolicy,
+                                          uint32_t currentTimeMs,
+                                          const uint32_t * pSendTimesMs,
+                                          const uint32_t * pNumRetransmissions,
+                                          size_t numMessages,
+                                          uint8_t * pAbandoned,
+                                          size_t * pNumAbandoned )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    uint32_t maxRetransmissions, maxLifetimeInMilliseconds, abandoned;
+    size_t numAbandoned = 0;
+    size_t i;
+
+    if( ( pPolicy == NULL ) ||
+        ( pSendTimesMs == NULL ) ||
+        ( pNumRetransmissions == NULL ) ||
+        ( pAbandoned == NULL ) ||
+        ( pNumAbandoned == NULL ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        /* Local copies, so that the compiler knows that the stores to
+         * pAbandoned do not change the limits and can vectorize the loop. */
+        maxRetransmissions = pPolicy->maxRetransmissions;
+        maxLifetimeInMilliseconds = pPolicy->maxLifetimeInMilliseconds;
+
+        for( i = 0; i < numMessages; i++ )
+        {
+            abandoned = ( uint32_t ) ( pNumRetransmissions[ i ] >= maxRetransmissions ) |
+                        ( uint32_t ) ( ( currentTimeMs - pSendTimesMs[ i ] ) > maxLifetimeInMilliseconds );
+
+            pAbandoned[ i ] = ( uint8_t ) abandoned;
+            numAbandoned += abandoned;
+        }
+
+        *pNumAbandoned = numAbandoned;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,228 @@
+/* API includes. */
+#include "dcep_data_types.h"
+
+#if defined( DCEP_SIMD_X86 )
+    #include <immintrin.h>
+#endif
+
+/*-----------------------------------------------------------*/
+
+#define DCEP_CHANNEL_TYPE_UNORDERED_BIT     0x80
+#define DCEP_CHANNEL_TYPE_MAX_RELIABILITY   0x02
+
+/* Build a mask of the low numHeaders bits. */
+#define DCEP_HEADER_BLOCK_MASK( numHeaders ) \
+    ( ( uint16_t ) ( ( 1UL << ( numHeaders ) ) - 1UL ) )
+
+/*-----------------------------------------------------------*/
+
+static uint16_t NetworkToHostUint16( const uint16_t * pValue )
+{
+    const uint8_t * pBytes = ( const uint8_t * ) pValue;
+
+    return ( uint16_t ) ( ( ( uint16_t ) pBytes[ 0 ] << 8 ) |
+                          ( ( uint16_t ) pBytes[ 1 ] ) );
+}
+
+/*-----------------------------------------------------------*/
+
+static uint32_t NetworkToHostUint32( const uint32_t * pValue )
+{
+    const uint8_t * pBytes = ( const uint8_t * ) pValue;
+
+    return ( ( ( uint32_t ) pBytes[ 0 ] << 24 ) |
+             ( ( uint32_t ) pBytes[ 1 ] << 16 ) |
+             ( ( uint32_t ) pBytes[ 2 ] << 8 ) |
+             ( ( uint32_t ) pBytes[ 3 ] ) );
+}
+
+/*-----------------------------------------------------------*/
+
+uint16_t Dcep_ValidateHeaderBlockScalar( DcepHeaderBlock_t * pBlock,
+                                         size_t numHeaders )
+{
+    uint16_t validMask = 0;
+    uint32_t requiredLength;
+    uint8_t baseChannelType;
+    size_t i;
+
+    if( numHeaders > DCEP_HEADER_BLOCK_SIZE )
+    {
+        numHeaders = DCEP_HEADER_BLOCK_SIZE;
+    }
+
+    for( i = 0; i < numHeaders; i++ )
+    {
+        pBlock->priority[ i ] = NetworkToHostUint16( &( pBlock->priority[ i ] ) );
+        pBlock->reliabilityParameter[ i ] = NetworkToHostUint32( &( pBlock->reliabilityParameter[ i ] ) );
+        pBlock->labelLength[ i ] = NetworkToHostUint16( &( pBlock->labelLength[ i ] ) );
+        pBlock->protocolLength[ i ] = NetworkToHostUint16( &( pBlock->protocolLength[ i ] ) );
+
+        baseChannelType = ( uint8_t ) ( pBlock->channelType[ i ] & ~DCEP_CHANNEL_TYPE_UNORDERED_BIT );
+        requiredLength = ( uint32_t ) DCEP_HEADER_LENGTH +
+                         ( uint32_t ) pBlock->labelLength[ i ] +
+                         ( uint32_t ) pBlock->protocolLength[ i ];
+
+        if( ( pBlock->messageType[ i ] == DCEP_MESSAGE_DATA_CHANNEL_OPEN ) &&
+            ( baseChannelType <= DCEP_CHANNEL_TYPE_MAX_RELIABILITY ) &&
+            ( requiredLength <= pBlock->messageLength[ i ] ) )
+        {
+            validMask |= ( uint16_t ) ( 1U << i );
+        }
+    }
+
+    return validMask;
+}
+
+/*-----------------------------------------------------------*/
+
+#if defined( DCEP_SIMD_X86 )
+
+__attribute__( ( target( "sse4.1" ) ) )
+uint16_t Dcep_ValidateHeaderBlockSse41( DcepHeaderBlock_t * pBlock,
+                                        size_t numHeaders )
+{
+    const __m128i swap16 = _mm_setr_epi8( 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 );
+    const __m128i swap32 = _mm_setr_epi8( 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 );
+    __m128i * pPriority = ( __m128i * ) &( pBlock->priority[ 0 ] );
+    __m128i * pReliability = ( __m128i * ) &( pBlock->reliabilityParameter[ 0 ] );
+    __m128i * pLabelLength = ( __m128i * ) &( pBlock->labelLength[ 0 ] );
+    __m128i * pProtocolLength = ( __m128i * ) &( pBlock->protocolLength[ 0 ] );
+    __m128i messageType, baseChannelType, typeMatches;
+    __m128i labelLength, protocolLength, requiredLength, messageLength, fits;
+    uint32_t typeMask, lengthMask = 0;
+    size_t i;
+
+    if( numHeaders > DCEP_HEADER_BLOCK_SIZE )
+    {
+        numHeaders = DCEP_HEADER_BLOCK_SIZE;
+    }
+
+    /* Convert all fields to host byte order. Unused slots are zero and stay
+     * zero, so the whole block is processed unconditionally. */
+    for( i = 0; i < 2; i++ )
+    {
+        _mm_storeu_si128( &( pPriority[ i ] ), _mm_shuffle_epi8( _mm_loadu_si128( &( pPriority[ i ] ) ), swap16 ) );
+        _mm_storeu_si128( &( pLabelLength[ i ] ), _mm_shuffle_epi8( _mm_loadu_si128( &( pLabelLength[ i ] ) ), swap16 ) );
+        _mm_storeu_si128( &( pProtocolLength[ i ] ), _mm_shuffle_epi8( _mm_loadu_si128( &( pProtocolLength[ i ] ) ), swap16 ) );
+    }
+
+    for( i = 0; i < 4; i++ )
+    {
+        _mm_storeu_si128( &( pReliability[ i ] ), _mm_shuffle_epi8( _mm_loadu_si128( &( pReliability[ i ] ) ), swap32 ) );
+    }
+
+    /* Message type must be DATA_CHANNEL_OPEN and the channel type, with the
+     * unordered bit cleared, must be at most 2. */
+    messageType = _mm_loadu_si128( ( const __m128i * ) &( pBlock->messageType[ 0 ] ) );
+    baseChannelType = _mm_and_si128( _mm_loadu_si128( ( const __m128i * ) &( pBlock->channelType[ 0 ] ) ),
+                                     _mm_set1_epi8( ( char ) ~DCEP_CHANNEL_TYPE_UNORDERED_BIT ) );
+    typeMatches = _mm_and_si128( _mm_cmpeq_epi8( messageType, _mm_set1_epi8( DCEP_MESSAGE_DATA_CHANNEL_OPEN ) ),
+                                 _mm_cmpeq_epi8( _mm_min_epu8( baseChannelType, _mm_set1_epi8( DCEP_CHANNEL_TYPE_MAX_RELIABILITY ) ),
+                                                 baseChannelType ) );
+    typeMask = ( uint32_t ) _mm_movemask_epi8( typeMatches );
+
+    /* Header, label and protocol must fit in the message, four at a time. */
+    for( i = 0; i < DCEP_HEADER_BLOCK_SIZE; i += 4 )
+    {
+        labelLength = _mm_cvtepu16_epi32( _mm_loadl_epi64( ( const __m128i * ) &( pBlock->labelLength[ i ] ) ) );
+        protocolLength = _mm_cvtepu16_epi32( _mm_loadl_epi64( ( const __m128i * ) &( pBlock->protocolLength[ i ] ) ) );
+        requiredLength = _mm_add_epi32( _mm_add_epi32( labelLength, protocolLength ),
+                                        _mm_set1_epi32( DCEP_HEADER_LENGTH ) );
+        messageLength = _mm_loadu_si128( ( const __m128i * ) &( pBlock->messageLength[ i ] ) );
+        fits = _mm_cmpeq_epi32( _mm_max_epu32( requiredLength, messageLength ), messageLength );
+        lengthMask |= ( uint32_t ) _mm_movemask_ps( _mm_castsi128_ps( fits ) ) << i;
+    }
+
+    return ( uint16_t ) ( typeMask & lengthMask & DCEP_HEADER_BLOCK_MASK( numHeaders ) );
+}
+
+/*-----------------------------------------------------------*/
+
+__attribute__( ( target( "avx2" ) ) )
+uint16_t Dcep_ValidateHeaderBlockAvx2( DcepHeaderBlock_t * pBlock,
+                                       size_t numHeaders )
+{
+    const __m256i swap16 = _mm256_setr_epi8( 1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                             1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14 );
+    const __m256i swap32 = _mm256_setr_epi8( 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12,
+                                             3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12 );
+    __m256i * pPriority = ( __m256i * ) &( pBlock->priority[ 0 ] );
+    __m256i * pReliability = ( __m256i * ) &( pBlock->reliabilityParameter[ 0 ] );
+    __m256i * pLabelLength = ( __m256i * ) &( pBlock->labelLength[ 0 ] );
+    __m256i * pProtocolLength = ( __m256i * ) &( pBlock->protocolLength[ 0 ] );
+    __m128i messageType, baseChannelType, typeMatches;
+    __m256i labelLength, protocolLength, requiredLength, messageLength, fits;
+    uint32_t typeMask, lengthMask = 0;
+    size_t i;
+
+    if( numHeaders > DCEP_HEADER_BLOCK_SIZE )
+    {
+        numHeaders = DCEP_HEADER_BLOCK_SIZE;
+    }
+
+    /* Convert all fields to host byte order. Unused slots are zero and stay
+     * zero, so the whole block is processed unconditionally. */
+    _mm256_storeu_si256( pPriority, _mm256_shuffle_epi8( _mm256_loadu_si256( pPriority ), swap16 ) );
+    _mm256_storeu_si256( pLabelLength, _mm256_shuffle_epi8( _mm256_loadu_si256( pLabelLength ), swap16 ) );
+    _mm256_storeu_si256( pProtocolLength, _mm256_shuffle_epi8( _mm256_loadu_si256( pProtocolLength ), swap16 ) );
+    _mm256_storeu_si256( &( pReliability[ 0 ] ), _mm256_shuffle_epi8( _mm256_loadu_si256( &( pReliability[ 0 ] ) ), swap32 ) );
+    _mm256_storeu_si256( &( pReliability[ 1 ] ), _mm256_shuffle_epi8( _mm256_loadu_si256( &( pReliability[ 1 ] ) ), swap32 ) );
+
+    /* Message type must be DATA_CHANNEL_OPEN and the channel type, with the
+     * unordered bit cleared, must be at most 2. */
+    messageType = _mm_loadu_si128( ( const __m128i * ) &( pBlock->messageType[ 0 ] ) );
+    baseChannelType = _mm_and_si128( _mm_loadu_si128( ( const __m128i * ) &( pBlock->channelType[ 0 ] ) ),
+                                     _mm_set1_epi8( ( char ) ~DCEP_CHANNEL_TYPE_UNORDERED_BIT ) );
+    typeMatches = _mm_and_si128( _mm_cmpeq_epi8( messageType, _mm_set1_epi8( DCEP_MESSAGE_DATA_CHANNEL_OPEN ) ),
+                                 _mm_cmpeq_epi8( _mm_min_epu8( baseChannelType, _mm_set1_epi8( DCEP_CHANNEL_TYPE_MAX_RELIABILITY ) ),
+                                                 baseChannelType ) );
+    typeMask = ( uint32_t ) _mm_movemask_epi8( typeMatches );
+
+    /* Header, label and protocol must fit in the message, eight at a time. */
+    for( i = 0; i < DCEP_HEADER_BLOCK_SIZE; i += 8 )
+    {
+        labelLength = _mm256_cvtepu16_epi32( _mm_loadu_si128( ( const __m128i * ) &( pBlock->labelLength[ i ] ) ) );
+        protocolLength = _mm256_cvtepu16_epi32( _mm_loadu_si128( ( const __m128i * ) &( pBlock->protocolLength[ i ] ) ) );
+        requiredLength = _mm256_add_epi32( _mm256_add_epi32( labelLength, protocolLength ),
+                                           _mm256_set1_epi32( DCEP_HEADER_LENGTH ) );
+        messageLength = _mm256_loadu_si256( ( const __m256i * ) &( pBlock->messageLength[ i ] ) );
+        fits = _mm256_cmpeq_epi32( _mm256_max_epu32( requiredLength, messageLength ), messageLength );
+        lengthMask |= ( uint32_t ) _mm256_movemask_ps( _mm256_castsi256_ps( fits ) ) << i;
+    }
+
+    return ( uint16_t ) ( typeMask & lengthMask & DCEP_HEADER_BLOCK_MASK( numHeaders ) );
+}
+
+#endif /* DCEP_SIMD_X86 */
+
+/*-----------------------------------------------------------*/
+
+DcepValidateHeaderBlock_t Dcep_SelectValidateHeaderBlockFunction( void )
+{
+    DcepValidateHeaderBlock_t validateFn = Dcep_ValidateHeaderBlockScalar;
+
+    #if defined( DCEP_SIMD_X86 )
+        __builtin_cpu_init();
+
+        /* The kernel selected depends on the CPU running the tests. */
+        /* LCOV_EXCL_START */
+        if( __builtin_cpu_supports( "avx2" ) )
+        {
+            validateFn = Dcep_ValidateHeaderBlockAvx2;
+        }
+        else if( __builtin_cpu_supports( "sse4.1" ) )
+        {
+            validateFn = Dcep_ValidateHeaderBlockSse41;
+        }
+        else
+        {
+            /* Use the scalar kernel. */
+        }
+        /* LCOV_EXCL_STOP */
+    #endif
+
+    return validateFn;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,207 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "dcep_state_machine.h"
+
+/*-----------------------------------------------------------*/
+
+static DcepResult_t ProcessChannelOpenMessage( DcepContext_t * pCtx,
+                                               DcepChannelRegistry_t * pRegistry,
+                                               uint16_t streamId,
+                                               const uint8_t * pDcepMessage,
+                                               size_t dcepMessageLength,
+                                               uint8_t * pAckBuffer,
+                                               size_t * pAckBufferLength,
+                                               DcepProcessedMessage_t * pProcessedMessage )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( *pAckBufferLength < DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH )
+    {
+        DCEP_METRICS_INCREMENT( pCtx, outOfMemory );
+        result = DCEP_RESULT_OUT_OF_MEMORY;
+    }
+    else if( dcepMessageLength < DCEP_HEADER_LENGTH )
+    {
+        DCEP_METRICS_INCREMENT( pCtx, malformedTruncatedHeader );
+        result = DCEP_RESULT_MALFORMED_MESSAGE;
+    }
+    else
+    {
+        result = Dcep_DeserializeChannelOpenMessage( pCtx,
+                                                     pDcepMessage,
+                                                     dcepMessageLength,
+                                                     &( pProcessedMessage->channelOpenMessage ) );
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = Dcep_ChannelRegistryInsert( pRegistry,
+                                             streamId,
+                                             DCEP_CHANNEL_STATE_OPEN,
+                                             &( pProcessedMessage->channelOpenMessage ) );
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        /* Cannot fail as the ACK buffer length is checked above. */
+        ( void ) Dcep_SerializeChannelAckMessage( pCtx,
+                                                  pAckBuffer,
+                                                  pAckBufferLength );
+
+        pProcessedMessage->channelState = DCEP_CHANNEL_STATE_OPEN;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+static DcepResult_t ProcessChannelAckMessage( DcepChannelRegistry_t * pRegistry,
+                                              uint16_t streamId,
+                                              size_t * pAckBufferLength,
+                                              DcepProcessedMessage_t * pProcessedMessage )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t index = 0;
+
+    result = Dcep_ChannelRegistryFind( pRegistry,
+                                       streamId,
+                                       &( index ) );
+
+    if( ( result == DCEP_RESULT_OK ) &&
+        ( pRegistry->pStates[ index ] != DCEP_CHANNEL_STATE_OPENING ) )
+    {
+        result = DCEP_RESULT_INVALID_STATE;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        pRegistry->pStates[ index ] = DCEP_CHANNEL_STATE_OPEN;
+
+        pProcessedMessage->channelState = DCEP_CHANNEL_STATE_OPEN;
+        *pAckBufferLength = 0;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_OpenChannel( DcepContext_t * pCtx,
+                               DcepChannelRegistry_t * pRegistry,
+                               uint16_t streamId,
+                               const DcepChannelOpenMessage_t * pChannelOpenMessage,
+                               uint8_t * pBuffer,
+                               size_t * pBufferLength )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pRegistry == NULL ) ||
+        ( pChannelOpenMessage == NULL ) ||
+        ( pBuffer == NULL ) ||
+        ( pBufferLength == NULL ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = Dcep_ChannelRegistryInsert( pRegistry,
+                                             streamId,
+                                             DCEP_CHANNEL_STATE_OPENING,
+                                             pChannelOpenMessage );
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = Dcep_SerializeChannelOpenMessage( pCtx,
+                                                   pChannelOpenMessage,
+                                                   pBuffer,
+                                                   pBufferLength );
+
+        if( result != DCEP_RESULT_OK )
+        {
+            /* Do not leave a channel in OPENING state for which no
+             * DATA_CHANNEL_OPEN message could be sent. */
+            ( void ) Dcep_ChannelRegistryRemove( pRegistry,
+                                                 streamId );
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ProcessMessage( DcepContext_t * pCtx,
+                                  DcepChannelRegistry_t * pRegistry,
+                                  uint16_t streamId,
+                                  const uint8_t * pDcepMessage,
+                                  size_t dcepMessageLength,
+                                  uint8_t * pAckBuffer,
+                                  size_t * pAckBufferLength,
+                                  DcepProcessedMessage_t * pProcessedMessage )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( ( pCtx == NULL ) ||
+        ( pRegistry == NULL ) ||
+        ( pDcepMessage == NULL ) ||
+        ( dcepMessageLength == 0 ) ||
+        ( pAckBuffer == NULL ) ||
+        ( pAckBufferLength == NULL ) ||
+        ( pProcessedMessage == NULL ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        memset( pProcessedMessage, 0, sizeof( DcepProcessedMessage_t ) );
+
+        pProcessedMessage->messageType = ( DcepMessageType_t ) pDcepMessage[ 0 ];
+
+        if( pDcepMessage[ 0 ] == DCEP_MESSAGE_DATA_CHANNEL_OPEN )
+        {
+            result = ProcessChannelOpenMessage( pCtx,
+                                                pRegistry,
+                                                streamId,
+                                                pDcepMessage,
+                                                dcepMessageLength,
+                                                pAckBuffer,
+                                                pAckBufferLength,
+                                                pProcessedMessage );
+        }
+        else if( pDcepMessage[ 0 ] == DCEP_MESSAGE_DATA_CHANNEL_ACK )
+        {
+            DCEP_METRICS_INCREMENT( pCtx, channelAckMessagesDeserialized );
+            DCEP_METRICS_ADD( pCtx, bytesDeserialized, dcepMessageLength );
+
+            result = ProcessChannelAckMessage( pRegistry,
+                                               streamId,
+                                               pAckBufferLength,
+                                               pProcessedMessage );
+        }
+        else
+        {
+            DCEP_METRICS_INCREMENT( pCtx, malformedMessageType );
+            result = DCEP_RESULT_MALFORMED_MESSAGE;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_CloseChannel( DcepChannelRegistry_t * pRegistry,
+                                uint16_t streamId )
+{
+    return Dcep_ChannelRegistryRemove( pRegistry,
+                                       streamId );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,296 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "dcep_stream_id_allocator.h"
+
+/*-----------------------------------------------------------*/
+
+/* Bits of even and odd stream ids within a word. */
+#define DCEP_STREAM_ID_EVEN_MASK    0x55555555UL
+#define DCEP_STREAM_ID_ODD_MASK     0xAAAAAAAAUL
+
+#define DCEP_STREAM_ID_WORD_INDEX( streamId )    ( ( size_t ) ( streamId ) / DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD )
+#define DCEP_STREAM_ID_BIT_MASK( streamId )      ( ( uint32_t ) 1U << ( ( streamId ) % DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD ) )
+
+/*-----------------------------------------------------------*/
+
+static uint32_t CountTrailingZeros( uint32_t word )
+{
+    uint32_t count = 0;
+
+    #if defined( __GNUC__ )
+        count = ( uint32_t ) __builtin_ctz( word );
+    #else
+        while( ( word & 1U ) == 0U )
+        {
+            word >>= 1;
+            count++;
+        }
+    #endif
+
+    return count;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t CountSetBits( uint32_t word )
+{
+    size_t count = 0;
+
+    #if defined( __GNUC__ )
+        count = ( size_t ) __builtin_popcount( word );
+    #else
+        while( word != 0U )
+        {
+            word &= word - 1U;
+            count++;
+        }
+    #endif
+
+    return count;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Sets or clears bit index of a bitmap. */
+static void SetBit( uint32_t * pBits,
+                    size_t index,
+                    uint8_t isSet )
+{
+    uint32_t bitMask = ( uint32_t ) 1U << ( index % DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD );
+
+    if( isSet != 0U )
+    {
+        pBits[ index / DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD ] |= bitMask;
+    }
+    else
+    {
+        pBits[ index / DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD ] &= ~bitMask;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/* Updates the summary bits of a word of usedBits after it changed. */
+static void UpdateNonFullBits( DcepStreamIdAllocator_t * pAllocator,
+                               size_t wordIndex )
+{
+    size_t groupIndex = wordIndex / DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD;
+
+    SetBit( &( pAllocator->nonFullWords[ 0 ] ),
+            wordIndex,
+            ( uint8_t ) ( ( ~( pAllocator->usedBits[ wordIndex ] ) & pAllocator->parityMask ) != 0U ) );
+    SetBit( &( pAllocator->nonFullGroups[ 0 ] ),
+            groupIndex,
+            ( uint8_t ) ( pAllocator->nonFullWords[ groupIndex ] != 0U ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/* Returns the first word of usedBits at or after startWordIndex, wrapping
+ * around, with a free bit of the local parity. At least one must exist. */
+static size_t FindNonFullWord( const DcepStreamIdAllocator_t * pAllocator,
+                               size_t startWordIndex )
+{
+    size_t groupIndex = startWordIndex / DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD;
+    size_t groupWordIndex;
+    uint32_t bits;
+
+    /* Words of the start group at or after the start word. */
+    bits = pAllocator->nonFullWords[ groupIndex ] &
+           ( 0xFFFFFFFFUL << ( startWordIndex % DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD ) );
+
+    if( bits == 0U )
+    {
+        /* The first non-full group after the start group. The start group is
+         * found again after wrapping around if it is the only one, and then
+         * its free words are all before the start word. */
+        groupIndex = ( groupIndex + 1U ) % DCEP_STREAM_ID_ALLOCATOR_NUM_GROUPS;
+        groupWordIndex = groupIndex / DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD;
+        bits = pAllocator->nonFullGroups[ groupWordIndex ] &
+               ( 0xFFFFFFFFUL << ( groupIndex % DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD ) );
+
+        /* Visits every word of nonFullGroups at most once more. */
+        while( bits == 0U )
+        {
+            groupWordIndex = ( groupWordIndex + 1U ) % DCEP_STREAM_ID_ALLOCATOR_NUM_GROUP_WORDS;
+            bits = pAllocator->nonFullGroups[ groupWordIndex ];
+        }
+
+        groupIndex = ( groupWordIndex * DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD ) + CountTrailingZeros( bits );
+        bits = pAllocator->nonFullWords[ groupIndex ];
+    }
+
+    return ( groupIndex * DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD ) + CountTrailingZeros( bits );
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_StreamIdAllocatorInit( DcepStreamIdAllocator_t * pAllocator,
+                                         DcepDtlsRole_t dtlsRole )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( ( pAllocator == NULL ) ||
+        ( ( dtlsRole != DCEP_DTLS_ROLE_CLIENT ) &&
+          ( dtlsRole != DCEP_DTLS_ROLE_SERVER ) ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        memset( pAllocator, 0, sizeof( DcepStreamIdAllocator_t ) );
+
+        pAllocator->parityMask = ( dtlsRole == DCEP_DTLS_ROLE_CLIENT ) ? DCEP_STREAM_ID_EVEN_MASK :
+                                                                         DCEP_STREAM_ID_ODD_MASK;
+        pAllocator->freeCount = ( DCEP_STREAM_ID_ALLOCATOR_NUM_WORDS *
+                                  DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD ) / 2;
+
+        /* Every word has free stream ids of both parities. */
+        memset( &( pAllocator->nonFullWords[ 0 ] ), 0xFF, sizeof( pAllocator->nonFullWords ) );
+        memset( &( pAllocator->nonFullGroups[ 0 ] ), 0xFF, sizeof( pAllocator->nonFullGroups ) );
+
+        /* The reserved stream id is odd. */
+        pAllocator->usedBits[ DCEP_STREAM_ID_WORD_INDEX( DCEP_STREAM_ID_RESERVED ) ] |= DCEP_STREAM_ID_BIT_MASK( DCEP_STREAM_ID_RESERVED );
+
+        if( dtlsRole == DCEP_DTLS_ROLE_SERVER )
+        {
+            pAllocator->freeCount--;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_StreamIdAllocatorAllocate( DcepStreamIdAllocator_t * pAllocator,
+                                             uint16_t * pStreamId )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t wordIndex;
+    uint32_t freeBits = 0;
+
+    if( ( pAllocator == NULL ) ||
+        ( pStreamId == NULL ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == DCEP_RESULT_OK ) &&
+        ( pAllocator->freeCount == 0 ) )
+    {
+        result = DCEP_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        /* freeCount is non-zero, so a word with a free bit exists. */
+        wordIndex = FindNonFullWord( pAllocator, pAllocator->searchHint );
+        freeBits = ~( pAllocator->usedBits[ wordIndex ] ) & pAllocator->parityMask;
+
+        freeBits &= ~freeBits + 1U;
+
+        pAllocator->usedBits[ wordIndex ] |= freeBits;
+        UpdateNonFullBits( pAllocator, wordIndex );
+        pAllocator->searchHint = wordIndex;
+        pAllocator->freeCount--;
+
+        *pStreamId = ( uint16_t ) ( ( wordIndex * DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD ) +
+                                    CountTrailingZeros( freeBits ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_StreamIdAllocatorRelease( DcepStreamIdAllocator_t * pAllocator,
+                                            uint16_t streamId )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t wordIndex = DCEP_STREAM_ID_WORD_INDEX( streamId );
+    uint32_t bitMask = DCEP_STREAM_ID_BIT_MASK( streamId );
+
+    if( ( pAllocator == NULL ) ||
+        ( streamId == DCEP_STREAM_ID_RESERVED ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( ( result == DCEP_RESULT_OK ) &&
+        ( ( pAllocator->usedBits[ wordIndex ] & bitMask ) == 0U ) )
+    {
+        result = DCEP_RESULT_NOT_FOUND;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        pAllocator->usedBits[ wordIndex ] &= ~bitMask;
+
+        if( ( bitMask & pAllocator->parityMask ) != 0U )
+        {
+            UpdateNonFullBits( pAllocator, wordIndex );
+            pAllocator->freeCount++;
+            pAllocator->searchHint = wordIndex;
+        }
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_StreamIdAllocatorReserve( DcepStreamIdAllocator_t * pAllocator,
+                                            uint16_t firstStreamId,
+                                            size_t count )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t streamId = firstStreamId;
+    size_t endStreamId = ( size_t ) firstStreamId + count;
+    size_t bitIndex, numBits;
+    uint32_t rangeMask, newBits;
+
+    if( ( pAllocator == NULL ) ||
+        ( count > DCEP_STREAM_ID_RESERVED ) ||
+        ( endStreamId > DCEP_STREAM_ID_RESERVED ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    /* Mark the range one word at a time. */
+    while( ( result == DCEP_RESULT_OK ) &&
+           ( streamId < endStreamId ) )
+    {
+        bitIndex = streamId % DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD;
+        numBits = DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD - bitIndex;
+
+        if( numBits > ( endStreamId - streamId ) )
+        {
+            numBits = endStreamId - streamId;
+        }
+
+        if( numBits == DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD )
+        {
+            rangeMask = 0xFFFFFFFFUL;
+        }
+        else
+        {
+            rangeMask = ( ( ( uint32_t ) 1U << numBits ) - 1U ) << bitIndex;
+        }
+
+        newBits = rangeMask & ~( pAllocator->usedBits[ DCEP_STREAM_ID_WORD_INDEX( streamId ) ] );
+
+        pAllocator->usedBits[ DCEP_STREAM_ID_WORD_INDEX( streamId ) ] |= rangeMask;
+        UpdateNonFullBits( pAllocator, DCEP_STREAM_ID_WORD_INDEX( streamId ) );
+        pAllocator->freeCount -= CountSetBits( newBits & pAllocator->parityMask );
+
+        streamId += numBits;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,328 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "dcep_timer_wheel.h"
+
+/*-----------------------------------------------------------*/
+
+#define DCEP_TIMER_WHEEL_SLOT_MASK    ( DCEP_TIMER_WHEEL_SLOTS - 1U )
+
+/* Number of ticks covered by one slot of a level. */
+#define DCEP_TIMER_WHEEL_LEVEL_TICKS( level ) \
+    ( ( uint32_t ) 1U << ( DCEP_TIMER_WHEEL_SLOT_BITS * ( level ) ) )
+
+/* Advancing by half the range of the tick counter or more is taken to be a
+ * tick that went backwards. */
+#define DCEP_TIMER_WHEEL_MAX_ADVANCE  0x80000000UL
+
+/*-----------------------------------------------------------*/
+
+/* Returns the bucket of a timer: the lowest level whose slots still span the
+ * time left, and the slot of that level that contains the expiry tick. */
+static uint32_t GetBucket( const DcepTimerWheel_t * pWheel,
+                           uint32_t expiryTick )
+{
+    uint32_t ticksLeft = expiryTick - pWheel->currentTick;
+    uint32_t level = 0;
+
+    while( ( ( level + 1U ) < DCEP_TIMER_WHEEL_LEVELS ) &&
+           ( ticksLeft >= DCEP_TIMER_WHEEL_LEVEL_TICKS( level + 1U ) ) )
+    {
+        level++;
+    }
+
+    return ( level * DCEP_TIMER_WHEEL_SLOTS ) +
+           ( ( expiryTick >> ( DCEP_TIMER_WHEEL_SLOT_BITS * level ) ) & DCEP_TIMER_WHEEL_SLOT_MASK );
+}
+
+/*-----------------------------------------------------------*/
+
+static void LinkTimer( DcepTimerWheel_t * pWheel,
+                       uint16_t streamId,
+                       uint32_t bucket )
+{
+    uint16_t head = pWheel->heads[ bucket ];
+
+    pWheel->pNext[ streamId ] = head;
+    pWheel->pPrev[ streamId ] = DCEP_TIMER_WHEEL_NONE;
+    pWheel->pBuckets[ streamId ] = ( uint16_t ) bucket;
+
+    if( head != DCEP_TIMER_WHEEL_NONE )
+    {
+        pWheel->pPrev[ head ] = streamId;
+    }
+
+    pWheel->heads[ bucket ] = streamId;
+}
+
+/*-----------------------------------------------------------*/
+
+static void UnlinkTimer( DcepTimerWheel_t * pWheel,
+                         uint16_t streamId )
+{
+    uint16_t next = pWheel->pNext[ streamId ];
+    uint16_t prev = pWheel->pPrev[ streamId ];
+
+    if( prev == DCEP_TIMER_WHEEL_NONE )
+    {
+        pWheel->heads[ pWheel->pBuckets[ streamId ] ] = next;
+    }
+    else
+    {
+        pWheel->pNext[ prev ] = next;
+    }
+
+    if( next != DCEP_TIMER_WHEEL_NONE )
+    {
+        pWheel->pPrev[ next ] = prev;
+    }
+
+    pWheel->pBuckets[ streamId ] = DCEP_TIMER_WHEEL_NONE;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Moves the timers of the current slot of a level to the levels below. They
+ * all expire before the slot comes round again. */
+static void CascadeLevel( DcepTimerWheel_t * pWheel,
+                          uint32_t level )
+{
+    uint32_t bucket = ( level * DCEP_TIMER_WHEEL_SLOTS ) +
+                      ( ( pWheel->currentTick >> ( DCEP_TIMER_WHEEL_SLOT_BITS * level ) ) & DCEP_TIMER_WHEEL_SLOT_MASK );
+    uint16_t streamId = pWheel->heads[ bucket ];
+    uint16_t next;
+
+    pWheel->heads[ bucket ] = DCEP_TIMER_WHEEL_NONE;
+
+    while( streamId != DCEP_TIMER_WHEEL_NONE )
+    {
+        next = pWheel->pNext[ streamId ];
+        LinkTimer( pWheel, streamId, GetBucket( pWheel, pWheel->pExpiryTicks[ streamId ] ) );
+        streamId = next;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void AdvanceOneTick( DcepTimerWheel_t * pWheel )
+{
+    uint32_t level;
+
+    pWheel->currentTick++;
+
+    /* Higher levels first, so that their timers can be cascaded again by the
+     * levels below on the same tick. */
+    for( level = DCEP_TIMER_WHEEL_LEVELS - 1U; level > 0U; level-- )
+    {
+        if( ( pWheel->currentTick & ( DCEP_TIMER_WHEEL_LEVEL_TICKS( level ) - 1U ) ) == 0U )
+        {
+            CascadeLevel( pWheel, level );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_TimerWheelGetMemorySize( size_t capacity,
+                                           size_t * pMemorySize )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( ( pMemorySize == NULL ) ||
+        ( capacity == 0 ) ||
+        ( capacity > DCEP_TIMER_WHEEL_MAX_CAPACITY ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        *pMemorySize = capacity * ( sizeof( uint32_t ) +
+                                    sizeof( uint16_t ) +
+                                    sizeof( uint16_t ) +
+                                    sizeof( uint16_t ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_TimerWheelInit( DcepTimerWheel_t * pWheel,
+                                  void * pMemory,
+                                  size_t memorySize,
+                                  size_t capacity,
+                                  uint32_t currentTick )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t requiredMemorySize = 0;
+    uint8_t * pCursor = ( uint8_t * ) pMemory;
+
+    if( ( pWheel == NULL ) ||
+        ( pMemory == NULL ) ||
+        ( ( ( uintptr_t ) pMemory & ( sizeof( uint32_t ) - 1 ) ) != 0 ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = Dcep_TimerWheelGetMemorySize( capacity,
+                                               &( requiredMemorySize ) );
+    }
+
+    if( ( result == DCEP_RESULT_OK ) &&
+        ( memorySize < requiredMemorySize ) )
+    {
+        result = DCEP_RESULT_OUT_OF_MEMORY;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        pWheel->pExpiryTicks = ( uint32_t * ) pCursor;
+        pCursor += capacity * sizeof( uint32_t );
+
+        pWheel->pNext = ( uint16_t * ) pCursor;
+        pCursor += capacity * sizeof( uint16_t );
+
+        pWheel->pPrev = ( uint16_t * ) pCursor;
+        pCursor += capacity * sizeof( uint16_t );
+
+        pWheel->pBuckets = ( uint16_t * ) pCursor;
+
+        pWheel->capacity = capacity;
+        pWheel->count = 0;
+        pWheel->currentTick = currentTick;
+
+        /* DCEP_TIMER_WHEEL_NONE has every byte set. */
+        memset( pWheel->pBuckets, 0xFF, capacity * sizeof( uint16_t ) );
+        memset( &( pWheel->heads[ 0 ] ), 0xFF, sizeof( pWheel->heads ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_TimerWheelArm( DcepTimerWheel_t * pWheel,
+                                 uint16_t streamId,
+                                 uint32_t timeoutTicks )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( ( pWheel == NULL ) ||
+        ( streamId >= pWheel->capacity ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        if( pWheel->pBuckets[ streamId ] != DCEP_TIMER_WHEEL_NONE )
+        {
+            UnlinkTimer( pWheel, streamId );
+        }
+        else
+        {
+            pWheel->count++;
+        }
+
+        if( timeoutTicks > DCEP_TIMER_WHEEL_MAX_TIMEOUT )
+        {
+            timeoutTicks = DCEP_TIMER_WHEEL_MAX_TIMEOUT;
+        }
+
+        pWheel->pExpiryTicks[ streamId ] = pWheel->currentTick + timeoutTicks;
+        LinkTimer( pWheel, streamId, GetBucket( pWheel, pWheel->pExpiryTicks[ streamId ] ) );
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_TimerWheelCancel( DcepTimerWheel_t * pWheel,
+                                    uint16_t streamId )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+
+    if( ( pWheel == NULL ) ||
+        ( streamId >= pWheel->capacity ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+    else if( pWheel->pBuckets[ streamId ] == DCEP_TIMER_WHEEL_NONE )
+    {
+        result = DCEP_RESULT_NOT_FOUND;
+    }
+    else
+    {
+        UnlinkTimer( pWheel, streamId );
+        pWheel->count--;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_TimerWheelAdvance( DcepTimerWheel_t * pWheel,
+                                     uint32_t currentTick,
+                                     uint16_t * pExpiredStreamIds,
+                                     size_t maxExpired,
+                                     size_t * pNumExpired )
+{
+    DcepResult_t result = DCEP_RESULT_OK;
+    size_t numExpired = 0;
+    uint16_t * pHead;
+    int done = 0;
+
+    if( ( pWheel == NULL ) ||
+        ( pExpiredStreamIds == NULL ) ||
+        ( maxExpired == 0 ) ||
+        ( pNumExpired == NULL ) ||
+        ( ( currentTick - pWheel->currentTick ) >= DCEP_TIMER_WHEEL_MAX_ADVANCE ) )
+    {
+        result = DCEP_RESULT_BAD_PARAM;
+    }
+
+    while( ( result == DCEP_RESULT_OK ) && ( done == 0 ) )
+    {
+        /* Every timer of the current level 0 slot expires on this tick. */
+        pHead = &( pWheel->heads[ pWheel->currentTick & DCEP_TIMER_WHEEL_SLOT_MASK ] );
+
+        while( ( *pHead != DCEP_TIMER_WHEEL_NONE ) && ( numExpired < maxExpired ) )
+        {
+            pExpiredStreamIds[ numExpired ] = *pHead;
+            numExpired++;
+            UnlinkTimer( pWheel, *pHead );
+            pWheel->count--;
+        }
+
+        if( ( *pHead != DCEP_TIMER_WHEEL_NONE ) ||
+            ( pWheel->currentTick == currentTick ) )
+        {
+            done = 1;
+        }
+        else if( pWheel->count == 0 )
+        {
+            /* Nothing left to cascade or expire. */
+            pWheel->currentTick = currentTick;
+            done = 1;
+        }
+        else
+        {
+            AdvanceOneTick( pWheel );
+        }
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        *pNumExpired = numExpired;
+    }
+
+    return result;
+}
+
+/*-----------------------------------------------------------*/
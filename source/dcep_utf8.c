@@ -0,0 +1,640 @@
+/* Standard includes. */
+#include <string.h>
+
+/* API includes. */
+#include "dcep_data_types.h"
+
+#if defined( DCEP_SIMD_X86 )
+    #include <immintrin.h>
+#endif
+
+#if defined( DCEP_SIMD_NEON )
+    #include <arm_neon.h>
+#endif
+
+/*-----------------------------------------------------------*/
+
+/* States in the middle of a multi-byte character. CONTn expects n more
+ * continuation bytes. The other states expect a restricted second byte that
+ * excludes overlong encodings (E0, F0), surrogates (ED) and code points above
+ * U+10FFFF (F4). */
+#define DCEP_UTF8_CONT1           2U
+#define DCEP_UTF8_CONT2           3U
+#define DCEP_UTF8_CONT3           4U
+#define DCEP_UTF8_AFTER_E0        5U
+#define DCEP_UTF8_AFTER_ED        6U
+#define DCEP_UTF8_AFTER_F0        7U
+#define DCEP_UTF8_AFTER_F4        8U
+#define DCEP_UTF8_STATE_MAX       DCEP_UTF8_AFTER_F4
+
+/* High bit of each byte of a 64-bit word. */
+#define DCEP_UTF8_HIGH_BITS       ( ( ( uint64_t ) 0x80808080UL << 32 ) | ( uint64_t ) 0x80808080UL )
+
+#define DCEP_UTF8_ASCII_MAX       0x7FU
+
+/*-----------------------------------------------------------*/
+
+typedef struct DcepUtf8Transition
+{
+    uint8_t lowest;
+    uint8_t highest;
+    uint8_t nextState;
+} DcepUtf8Transition_t;
+
+/* Byte range accepted in each state from DCEP_UTF8_CONT1 onwards and the
+ * state that follows it. */
+static const DcepUtf8Transition_t utf8Transitions[ DCEP_UTF8_STATE_MAX - DCEP_UTF8_CONT1 + 1 ] =
+{
+    { 0x80, 0xBF, DCEP_UTF8_ACCEPT }, /* DCEP_UTF8_CONT1 */
+    { 0x80, 0xBF, DCEP_UTF8_CONT1  }, /* DCEP_UTF8_CONT2 */
+    { 0x80, 0xBF, DCEP_UTF8_CONT2  }, /* DCEP_UTF8_CONT3 */
+    { 0xA0, 0xBF, DCEP_UTF8_CONT1  }, /* DCEP_UTF8_AFTER_E0 */
+    { 0x80, 0x9F, DCEP_UTF8_CONT1  }, /* DCEP_UTF8_AFTER_ED */
+    { 0x90, 0xBF, DCEP_UTF8_CONT2  }, /* DCEP_UTF8_AFTER_F0 */
+    { 0x80, 0x8F, DCEP_UTF8_CONT2  }  /* DCEP_UTF8_AFTER_F4 */
+};
+
+/*-----------------------------------------------------------*/
+
+static uint32_t GetLeadByteState( uint8_t leadByte )
+{
+    uint32_t state = DCEP_UTF8_REJECT;
+
+    /* 0x80 - 0xC1 are continuation bytes or overlong two byte leads and
+     * 0xF5 - 0xFF are never valid, so they stay rejected. */
+    if( ( leadByte >= 0xC2U ) && ( leadByte <= 0xDFU ) )
+    {
+        state = DCEP_UTF8_CONT1;
+    }
+    else if( leadByte == 0xE0U )
+    {
+        state = DCEP_UTF8_AFTER_E0;
+    }
+    else if( leadByte == 0xEDU )
+    {
+        state = DCEP_UTF8_AFTER_ED;
+    }
+    else if( ( leadByte >= 0xE1U ) && ( leadByte <= 0xEFU ) )
+    {
+        state = DCEP_UTF8_CONT2;
+    }
+    else if( leadByte == 0xF0U )
+    {
+        state = DCEP_UTF8_AFTER_F0;
+    }
+    else if( leadByte == 0xF4U )
+    {
+        state = DCEP_UTF8_AFTER_F4;
+    }
+    else if( ( leadByte >= 0xF1U ) && ( leadByte <= 0xF3U ) )
+    {
+        state = DCEP_UTF8_CONT3;
+    }
+    else
+    {
+        /* Not a lead byte. */
+    }
+
+    return state;
+}
+
+/*-----------------------------------------------------------*/
+
+uint32_t Dcep_ValidateUtf8Scalar( uint32_t state,
+                                  const uint8_t * pData,
+                                  size_t length )
+{
+    const DcepUtf8Transition_t * pTransition;
+    uint64_t word;
+    uint8_t byte;
+    size_t i = 0;
+
+    if( state > DCEP_UTF8_STATE_MAX )
+    {
+        state = DCEP_UTF8_REJECT;
+    }
+
+    while( ( i < length ) && ( state != DCEP_UTF8_REJECT ) )
+    {
+        if( state == DCEP_UTF8_ACCEPT )
+        {
+            /* Skip ASCII eight bytes at a time. */
+            while( ( length - i ) >= sizeof( word ) )
+            {
+                memcpy( &( word ), &( pData[ i ] ), sizeof( word ) );
+
+                if( ( word & DCEP_UTF8_HIGH_BITS ) != 0U )
+                {
+                    break;
+                }
+
+                i += sizeof( word );
+            }
+
+            if( i < length )
+            {
+                byte = pData[ i ];
+                i++;
+
+                if( byte > DCEP_UTF8_ASCII_MAX )
+                {
+                    state = GetLeadByteState( byte );
+                }
+            }
+        }
+        else
+        {
+            byte = pData[ i ];
+            i++;
+
+            pTransition = &( utf8Transitions[ state - DCEP_UTF8_CONT1 ] );
+
+            if( ( byte >= pTransition->lowest ) && ( byte <= pTransition->highest ) )
+            {
+                state = pTransition->nextState;
+            }
+            else
+            {
+                state = DCEP_UTF8_REJECT;
+            }
+        }
+    }
+
+    return state;
+}
+
+/*-----------------------------------------------------------*/
+
+#if defined( DCEP_SIMD_X86 ) || defined( DCEP_SIMD_NEON )
+
+/* Errors found by the vector kernels, one bit each, from the first two bytes
+ * of every pair of adjacent bytes (Keiser and Lemire, "Validating UTF-8 In
+ * Less Than One Instruction Per Byte"). Each of the three tables below maps a
+ * nibble of the pair to the errors that nibble allows; an error is present
+ * if all three allow it. */
+#define DCEP_UTF8_ERROR_TOO_SHORT         0x01U /* 11______ 0_______ or 11______ 11______ */
+#define DCEP_UTF8_ERROR_TOO_LONG          0x02U /* 0_______ 10______ */
+#define DCEP_UTF8_ERROR_OVERLONG_3        0x04U /* 11100000 100_____ */
+#define DCEP_UTF8_ERROR_TOO_LARGE         0x08U /* 11110100 1001____ to 11111___ 101_____ */
+#define DCEP_UTF8_ERROR_SURROGATE         0x10U /* 11101101 101_____ */
+#define DCEP_UTF8_ERROR_OVERLONG_2        0x20U /* 1100000_ 10______ */
+#define DCEP_UTF8_ERROR_TOO_LARGE_1000    0x40U /* 11110101 1000____ to 11111___ 1000____ */
+#define DCEP_UTF8_ERROR_OVERLONG_4        0x40U /* 11110000 1000____ */
+#define DCEP_UTF8_ERROR_TWO_CONTS         0x80U /* 10______ 10______ */
+
+/* Errors that do not depend on the low nibble of the first byte. */
+#define DCEP_UTF8_ERROR_CARRY \
+    ( DCEP_UTF8_ERROR_TOO_SHORT | DCEP_UTF8_ERROR_TOO_LONG | DCEP_UTF8_ERROR_TWO_CONTS )
+
+/* A continuation byte that follows another one is only valid as the third
+ * byte after a lead byte of E0 or above, or the fourth byte after a lead
+ * byte of F0 or above. Subtracting these, with saturation, from the bytes
+ * two and three positions earlier leaves the high bit set exactly there. */
+#define DCEP_UTF8_THIRD_BYTE_OFFSET       ( 0xE0U - 0x80U )
+#define DCEP_UTF8_FOURTH_BYTE_OFFSET      ( 0xF0U - 0x80U )
+
+/* Indexed by the high nibble of the first byte. */
+static const uint8_t utf8Byte1High[ 16 ] =
+{
+    /* 0_______ ASCII. */
+    DCEP_UTF8_ERROR_TOO_LONG,  DCEP_UTF8_ERROR_TOO_LONG,  DCEP_UTF8_ERROR_TOO_LONG,  DCEP_UTF8_ERROR_TOO_LONG,
+    DCEP_UTF8_ERROR_TOO_LONG,  DCEP_UTF8_ERROR_TOO_LONG,  DCEP_UTF8_ERROR_TOO_LONG,  DCEP_UTF8_ERROR_TOO_LONG,
+    /* 10______ continuation. */
+    DCEP_UTF8_ERROR_TWO_CONTS, DCEP_UTF8_ERROR_TWO_CONTS, DCEP_UTF8_ERROR_TWO_CONTS, DCEP_UTF8_ERROR_TWO_CONTS,
+    /* 1100____ and 1101____ two byte lead. */
+    DCEP_UTF8_ERROR_TOO_SHORT | DCEP_UTF8_ERROR_OVERLONG_2,
+    DCEP_UTF8_ERROR_TOO_SHORT,
+    /* 1110____ three byte lead. */
+    DCEP_UTF8_ERROR_TOO_SHORT | DCEP_UTF8_ERROR_OVERLONG_3 | DCEP_UTF8_ERROR_SURROGATE,
+    /* 1111____ four byte lead. */
+    DCEP_UTF8_ERROR_TOO_SHORT | DCEP_UTF8_ERROR_TOO_LARGE | DCEP_UTF8_ERROR_TOO_LARGE_1000 | DCEP_UTF8_ERROR_OVERLONG_4
+};
+
+/* Indexed by the low nibble of the first byte. */
+static const uint8_t utf8Byte1Low[ 16 ] =
+{
+    /* ____0000 */
+    DCEP_UTF8_ERROR_CARRY | DCEP_UTF8_ERROR_OVERLONG_3 | DCEP_UTF8_ERROR_OVERLONG_2 | DCEP_UTF8_ERROR_OVERLONG_4,
+    /* ____0001 */
+    DCEP_UTF8_ERROR_CARRY | DCEP_UTF8_ERROR_OVERLONG_2,
+    /* ____001_ */
+    DCEP_UTF8_ERROR_CARRY,
+    DCEP_UTF8_ERROR_CARRY,
+    /* ____0100 */
+    DCEP_UTF8_ERROR_CARRY | DCEP_UTF8_ERROR_TOO_LARGE,
+    /* ____0101 to ____1100 */
+    DCEP_UTF8_ERROR_CARRY | DCEP_UTF8_ERROR_TOO_LARGE | DCEP_UTF8_ERROR_TOO_LARGE_1000,
+    DCEP_UTF8_ERROR_CARRY | DCEP_UTF8_ERROR_TOO_LARGE | DCEP_UTF8_ERROR_TOO_LARGE_1000,
+    DCEP_UTF8_ERROR_CARRY | DCEP_UTF8_ERROR_TOO_LARGE | DCEP_UTF8_ERROR_TOO_LARGE_1000,
+    DCEP_UTF8_ERROR_CARRY | DCEP_UTF8_ERROR_TOO_LARGE | DCEP_UTF8_ERROR_TOO_LARGE_1000,
+    DCEP_UTF8_ERROR_CARRY | DCEP_UTF8_ERROR_TOO_LARGE | DCEP_UTF8_ERROR_TOO_LARGE_1000,
+    DCEP_UTF8_ERROR_CARRY | DCEP_UTF8_ERROR_TOO_LARGE | DCEP_UTF8_ERROR_TOO_LARGE_1000,
+    DCEP_UTF8_ERROR_CARRY | DCEP_UTF8_ERROR_TOO_LARGE | DCEP_UTF8_ERROR_TOO_LARGE_1000,
+    DCEP_UTF8_ERROR_CARRY | DCEP_UTF8_ERROR_TOO_LARGE | DCEP_UTF8_ERROR_TOO_LARGE_1000,
+    /* ____1101 */
+    DCEP_UTF8_ERROR_CARRY | DCEP_UTF8_ERROR_TOO_LARGE | DCEP_UTF8_ERROR_TOO_LARGE_1000 | DCEP_UTF8_ERROR_SURROGATE,
+    /* ____111_ */
+    DCEP_UTF8_ERROR_CARRY | DCEP_UTF8_ERROR_TOO_LARGE | DCEP_UTF8_ERROR_TOO_LARGE_1000,
+    DCEP_UTF8_ERROR_CARRY | DCEP_UTF8_ERROR_TOO_LARGE | DCEP_UTF8_ERROR_TOO_LARGE_1000
+};
+
+/* Indexed by the high nibble of the second byte. */
+static const uint8_t utf8Byte2High[ 16 ] =
+{
+    /* 0_______ ASCII. */
+    DCEP_UTF8_ERROR_TOO_SHORT, DCEP_UTF8_ERROR_TOO_SHORT, DCEP_UTF8_ERROR_TOO_SHORT, DCEP_UTF8_ERROR_TOO_SHORT,
+    DCEP_UTF8_ERROR_TOO_SHORT, DCEP_UTF8_ERROR_TOO_SHORT, DCEP_UTF8_ERROR_TOO_SHORT, DCEP_UTF8_ERROR_TOO_SHORT,
+    /* 1000____ */
+    DCEP_UTF8_ERROR_TOO_LONG | DCEP_UTF8_ERROR_OVERLONG_2 | DCEP_UTF8_ERROR_TWO_CONTS |
+    DCEP_UTF8_ERROR_OVERLONG_3 | DCEP_UTF8_ERROR_TOO_LARGE_1000 | DCEP_UTF8_ERROR_OVERLONG_4,
+    /* 1001____ */
+    DCEP_UTF8_ERROR_TOO_LONG | DCEP_UTF8_ERROR_OVERLONG_2 | DCEP_UTF8_ERROR_TWO_CONTS |
+    DCEP_UTF8_ERROR_OVERLONG_3 | DCEP_UTF8_ERROR_TOO_LARGE,
+    /* 101_____ */
+    DCEP_UTF8_ERROR_TOO_LONG | DCEP_UTF8_ERROR_OVERLONG_2 | DCEP_UTF8_ERROR_TWO_CONTS |
+    DCEP_UTF8_ERROR_SURROGATE | DCEP_UTF8_ERROR_TOO_LARGE,
+    DCEP_UTF8_ERROR_TOO_LONG | DCEP_UTF8_ERROR_OVERLONG_2 | DCEP_UTF8_ERROR_TWO_CONTS |
+    DCEP_UTF8_ERROR_SURROGATE | DCEP_UTF8_ERROR_TOO_LARGE,
+    /* 11______ lead. */
+    DCEP_UTF8_ERROR_TOO_SHORT, DCEP_UTF8_ERROR_TOO_SHORT, DCEP_UTF8_ERROR_TOO_SHORT, DCEP_UTF8_ERROR_TOO_SHORT
+};
+
+/*-----------------------------------------------------------*/
+
+/* Validates the bytes that complete a character left open by the previous
+ * piece of the input, one at a time, so that the vector kernels start on a
+ * character boundary. Returns the number of bytes validated. */
+static size_t ValidateOpenCharacter( uint32_t * pState,
+                                     const uint8_t * pData,
+                                     size_t length )
+{
+    size_t i = 0;
+
+    while( ( i < length ) &&
+           ( *pState != DCEP_UTF8_ACCEPT ) &&
+           ( *pState != DCEP_UTF8_REJECT ) )
+    {
+        *pState = Dcep_ValidateUtf8Scalar( *pState, &( pData[ i ] ), 1 );
+        i++;
+    }
+
+    return i;
+}
+
+/*-----------------------------------------------------------*/
+
+/* The vector kernels validate the bytes before end, which are known to be
+ * well-formed up to a character that may still be open at end. Returns where
+ * that character starts, or end if there is none, so that it is validated
+ * again together with the rest of the input. At least one vector of input
+ * precedes end. */
+static size_t GetOpenCharacterStart( const uint8_t * pData,
+                                     size_t end )
+{
+    size_t start = end;
+    size_t back = 1;
+    uint8_t leadByte;
+    size_t characterLength;
+
+    /* Step back over at most three continuation bytes to the lead byte. */
+    while( ( back <= 3U ) && ( ( pData[ end - back ] & 0xC0U ) == 0x80U ) )
+    {
+        back++;
+    }
+
+    if( ( back <= 3U ) && ( pData[ end - back ] >= 0xC0U ) )
+    {
+        leadByte = pData[ end - back ];
+        characterLength = ( leadByte >= 0xF0U ) ? 4U : ( ( leadByte >= 0xE0U ) ? 3U : 2U );
+
+        if( characterLength > back )
+        {
+            start = end - back;
+        }
+    }
+
+    return start;
+}
+
+#endif /* DCEP_SIMD_X86 || DCEP_SIMD_NEON */
+
+/*-----------------------------------------------------------*/
+
+#if defined( DCEP_SIMD_X86 )
+
+/* Returns non-zero if the length bytes at pData, a multiple of 16 that starts
+ * on a character boundary, are not well-formed up to a character that may be
+ * open at the end. */
+__attribute__( ( target( "ssse3" ) ) )
+static int HasUtf8ErrorsSsse3( const uint8_t * pData,
+                               size_t length )
+{
+    const __m128i byte1HighTable = _mm_loadu_si128( ( const __m128i * ) &( utf8Byte1High[ 0 ] ) );
+    const __m128i byte1LowTable = _mm_loadu_si128( ( const __m128i * ) &( utf8Byte1Low[ 0 ] ) );
+    const __m128i byte2HighTable = _mm_loadu_si128( ( const __m128i * ) &( utf8Byte2High[ 0 ] ) );
+    const __m128i nibbleMask = _mm_set1_epi8( 0x0F );
+    /* Bytes that leave a character open when they come last, second to last
+     * or third to last are above these. */
+    const __m128i openMax = _mm_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                           ( char ) ( 0xF0U - 1U ), ( char ) ( 0xE0U - 1U ), ( char ) ( 0xC0U - 1U ) );
+    __m128i input, previous = _mm_setzero_si128(), previousOpen = _mm_setzero_si128();
+    __m128i error = _mm_setzero_si128();
+    __m128i prev1, prev2, prev3, special, mustBeContinuation;
+    size_t i;
+
+    for( i = 0; i < length; i += sizeof( __m128i ) )
+    {
+        input = _mm_loadu_si128( ( const __m128i * ) &( pData[ i ] ) );
+
+        if( _mm_movemask_epi8( input ) == 0 )
+        {
+            /* ASCII, which is only an error after an open character. */
+            error = _mm_or_si128( error, previousOpen );
+        }
+        else
+        {
+            prev1 = _mm_alignr_epi8( input, previous, 16 - 1 );
+            prev2 = _mm_alignr_epi8( input, previous, 16 - 2 );
+            prev3 = _mm_alignr_epi8( input, previous, 16 - 3 );
+
+            special = _mm_and_si128( _mm_and_si128( _mm_shuffle_epi8( byte1HighTable, _mm_and_si128( _mm_srli_epi16( prev1, 4 ), nibbleMask ) ),
+                                                    _mm_shuffle_epi8( byte1LowTable, _mm_and_si128( prev1, nibbleMask ) ) ),
+                                     _mm_shuffle_epi8( byte2HighTable, _mm_and_si128( _mm_srli_epi16( input, 4 ), nibbleMask ) ) );
+
+            mustBeContinuation = _mm_or_si128( _mm_subs_epu8( prev2, _mm_set1_epi8( DCEP_UTF8_THIRD_BYTE_OFFSET ) ),
+                                               _mm_subs_epu8( prev3, _mm_set1_epi8( DCEP_UTF8_FOURTH_BYTE_OFFSET ) ) );
+
+            error = _mm_or_si128( error,
+                                  _mm_xor_si128( special, _mm_and_si128( mustBeContinuation, _mm_set1_epi8( ( char ) DCEP_UTF8_ERROR_TWO_CONTS ) ) ) );
+
+            previousOpen = _mm_subs_epu8( input, openMax );
+        }
+
+        previous = input;
+    }
+
+    return _mm_movemask_epi8( _mm_cmpeq_epi8( error, _mm_setzero_si128() ) ) != 0xFFFF;
+}
+
+/*-----------------------------------------------------------*/
+
+__attribute__( ( target( "ssse3" ) ) )
+uint32_t Dcep_ValidateUtf8Ssse3( uint32_t state,
+                                 const uint8_t * pData,
+                                 size_t length )
+{
+    size_t i, end;
+
+    if( state > DCEP_UTF8_STATE_MAX )
+    {
+        state = DCEP_UTF8_REJECT;
+    }
+
+    i = ValidateOpenCharacter( &( state ), pData, length );
+
+    if( ( state == DCEP_UTF8_ACCEPT ) && ( ( length - i ) >= sizeof( __m128i ) ) )
+    {
+        end = length - ( ( length - i ) % sizeof( __m128i ) );
+
+        if( HasUtf8ErrorsSsse3( &( pData[ i ] ), end - i ) != 0 )
+        {
+            state = DCEP_UTF8_REJECT;
+        }
+        else
+        {
+            i = GetOpenCharacterStart( pData, end );
+        }
+    }
+
+    if( i < length )
+    {
+        state = Dcep_ValidateUtf8Scalar( state, &( pData[ i ] ), length - i );
+    }
+
+    return state;
+}
+
+/*-----------------------------------------------------------*/
+
+/* As HasUtf8ErrorsSsse3, for a multiple of 32 bytes. */
+__attribute__( ( target( "avx2" ) ) )
+static int HasUtf8ErrorsAvx2( const uint8_t * pData,
+                              size_t length )
+{
+    const __m256i byte1HighTable = _mm256_broadcastsi128_si256( _mm_loadu_si128( ( const __m128i * ) &( utf8Byte1High[ 0 ] ) ) );
+    const __m256i byte1LowTable = _mm256_broadcastsi128_si256( _mm_loadu_si128( ( const __m128i * ) &( utf8Byte1Low[ 0 ] ) ) );
+    const __m256i byte2HighTable = _mm256_broadcastsi128_si256( _mm_loadu_si128( ( const __m128i * ) &( utf8Byte2High[ 0 ] ) ) );
+    const __m256i nibbleMask = _mm256_set1_epi8( 0x0F );
+    const __m256i openMax = _mm256_setr_epi8( -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                              -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                              ( char ) ( 0xF0U - 1U ), ( char ) ( 0xE0U - 1U ), ( char ) ( 0xC0U - 1U ) );
+    __m256i input, previous = _mm256_setzero_si256(), previousOpen = _mm256_setzero_si256();
+    __m256i error = _mm256_setzero_si256();
+    __m256i carried, prev1, prev2, prev3, special, mustBeContinuation;
+    size_t i;
+
+    for( i = 0; i < length; i += sizeof( __m256i ) )
+    {
+        input = _mm256_loadu_si256( ( const __m256i * ) &( pData[ i ] ) );
+
+        if( _mm256_movemask_epi8( input ) == 0 )
+        {
+            /* ASCII, which is only an error after an open character. */
+            error = _mm256_or_si256( error, previousOpen );
+        }
+        else
+        {
+            /* The high lane of the previous vector and the low lane of this
+             * one, so that alignr can shift bytes across the lanes. */
+            carried = _mm256_permute2x128_si256( previous, input, 0x21 );
+            prev1 = _mm256_alignr_epi8( input, carried, 16 - 1 );
+            prev2 = _mm256_alignr_epi8( input, carried, 16 - 2 );
+            prev3 = _mm256_alignr_epi8( input, carried, 16 - 3 );
+
+            special = _mm256_and_si256( _mm256_and_si256( _mm256_shuffle_epi8( byte1HighTable, _mm256_and_si256( _mm256_srli_epi16( prev1, 4 ), nibbleMask ) ),
+                                                          _mm256_shuffle_epi8( byte1LowTable, _mm256_and_si256( prev1, nibbleMask ) ) ),
+                                        _mm256_shuffle_epi8( byte2HighTable, _mm256_and_si256( _mm256_srli_epi16( input, 4 ), nibbleMask ) ) );
+
+            mustBeContinuation = _mm256_or_si256( _mm256_subs_epu8( prev2, _mm256_set1_epi8( DCEP_UTF8_THIRD_BYTE_OFFSET ) ),
+                                                  _mm256_subs_epu8( prev3, _mm256_set1_epi8( DCEP_UTF8_FOURTH_BYTE_OFFSET ) ) );
+
+            error = _mm256_or_si256( error,
+                                     _mm256_xor_si256( special, _mm256_and_si256( mustBeContinuation, _mm256_set1_epi8( ( char ) DCEP_UTF8_ERROR_TWO_CONTS ) ) ) );
+
+            previousOpen = _mm256_subs_epu8( input, openMax );
+        }
+
+        previous = input;
+    }
+
+    return _mm256_testz_si256( error, error ) == 0;
+}
+
+/*-----------------------------------------------------------*/
+
+__attribute__( ( target( "avx2" ) ) )
+uint32_t Dcep_ValidateUtf8Avx2( uint32_t state,
+                                const uint8_t * pData,
+                                size_t length )
+{
+    size_t i, end;
+
+    if( state > DCEP_UTF8_STATE_MAX )
+    {
+        state = DCEP_UTF8_REJECT;
+    }
+
+    i = ValidateOpenCharacter( &( state ), pData, length );
+
+    if( ( state == DCEP_UTF8_ACCEPT ) && ( ( length - i ) >= sizeof( __m256i ) ) )
+    {
+        end = length - ( ( length - i ) % sizeof( __m256i ) );
+
+        if( HasUtf8ErrorsAvx2( &( pData[ i ] ), end - i ) != 0 )
+        {
+            state = DCEP_UTF8_REJECT;
+        }
+        else
+        {
+            i = GetOpenCharacterStart( pData, end );
+        }
+    }
+
+    if( i < length )
+    {
+        state = Dcep_ValidateUtf8Scalar( state, &( pData[ i ] ), length - i );
+    }
+
+    return state;
+}
+
+#endif /* DCEP_SIMD_X86 */
+
+/*-----------------------------------------------------------*/
+
+#if defined( DCEP_SIMD_NEON )
+
+/* As HasUtf8ErrorsSsse3, with NEON. */
+static int HasUtf8ErrorsNeon( const uint8_t * pData,
+                              size_t length )
+{
+    static const uint8_t openMaxBytes[ 16 ] =
+    {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xF0 - 1, 0xE0 - 1, 0xC0 - 1
+    };
+    const uint8x16_t byte1HighTable = vld1q_u8( &( utf8Byte1High[ 0 ] ) );
+    const uint8x16_t byte1LowTable = vld1q_u8( &( utf8Byte1Low[ 0 ] ) );
+    const uint8x16_t byte2HighTable = vld1q_u8( &( utf8Byte2High[ 0 ] ) );
+    const uint8x16_t nibbleMask = vdupq_n_u8( 0x0F );
+    const uint8x16_t openMax = vld1q_u8( &( openMaxBytes[ 0 ] ) );
+    uint8x16_t input, previous = vdupq_n_u8( 0 ), previousOpen = vdupq_n_u8( 0 );
+    uint8x16_t error = vdupq_n_u8( 0 );
+    uint8x16_t prev1, prev2, prev3, special, mustBeContinuation;
+    size_t i;
+
+    for( i = 0; i < length; i += sizeof( uint8x16_t ) )
+    {
+        input = vld1q_u8( &( pData[ i ] ) );
+
+        if( vmaxvq_u8( input ) <= DCEP_UTF8_ASCII_MAX )
+        {
+            /* ASCII, which is only an error after an open character. */
+            error = vorrq_u8( error, previousOpen );
+        }
+        else
+        {
+            prev1 = vextq_u8( previous, input, 16 - 1 );
+            prev2 = vextq_u8( previous, input, 16 - 2 );
+            prev3 = vextq_u8( previous, input, 16 - 3 );
+
+            special = vandq_u8( vandq_u8( vqtbl1q_u8( byte1HighTable, vshrq_n_u8( prev1, 4 ) ),
+                                          vqtbl1q_u8( byte1LowTable, vandq_u8( prev1, nibbleMask ) ) ),
+                                vqtbl1q_u8( byte2HighTable, vshrq_n_u8( input, 4 ) ) );
+
+            mustBeContinuation = vorrq_u8( vqsubq_u8( prev2, vdupq_n_u8( DCEP_UTF8_THIRD_BYTE_OFFSET ) ),
+                                           vqsubq_u8( prev3, vdupq_n_u8( DCEP_UTF8_FOURTH_BYTE_OFFSET ) ) );
+
+            error = vorrq_u8( error,
+                              veorq_u8( special, vandq_u8( mustBeContinuation, vdupq_n_u8( DCEP_UTF8_ERROR_TWO_CONTS ) ) ) );
+
+            previousOpen = vqsubq_u8( input, openMax );
+        }
+
+        previous = input;
+    }
+
+    return vmaxvq_u8( error ) != 0U;
+}
+
+/*-----------------------------------------------------------*/
+
+uint32_t Dcep_ValidateUtf8Neon( uint32_t state,
+                                const uint8_t * pData,
+                                size_t length )
+{
+    size_t i, end;
+
+    if( state > DCEP_UTF8_STATE_MAX )
+    {
+        state = DCEP_UTF8_REJECT;
+    }
+
+    i = ValidateOpenCharacter( &( state ), pData, length );
+
+    if( ( state == DCEP_UTF8_ACCEPT ) && ( ( length - i ) >= sizeof( uint8x16_t ) ) )
+    {
+        end = length - ( ( length - i ) % sizeof( uint8x16_t ) );
+
+        if( HasUtf8ErrorsNeon( &( pData[ i ] ), end - i ) != 0 )
+        {
+            state = DCEP_UTF8_REJECT;
+        }
+        else
+        {
+            i = GetOpenCharacterStart( pData, end );
+        }
+    }
+
+    if( i < length )
+    {
+        state = Dcep_ValidateUtf8Scalar( state, &( pData[ i ] ), length - i );
+    }
+
+    return state;
+}
+
+#endif /* DCEP_SIMD_NEON */
+
+/*-----------------------------------------------------------*/
+
+DcepValidateUtf8_t Dcep_SelectValidateUtf8Function( void )
+{
+    DcepValidateUtf8_t validateFn = Dcep_ValidateUtf8Scalar;
+
+    #if defined( DCEP_SIMD_X86 )
+        __builtin_cpu_init();
+
+        /* The validator selected depends on the CPU running the tests. */
+        /* LCOV_EXCL_START */
+        if( __builtin_cpu_supports( "avx2" ) )
+        {
+            validateFn = Dcep_ValidateUtf8Avx2;
+        }
+        else if( __builtin_cpu_supports( "ssse3" ) )
+        {
+            validateFn = Dcep_ValidateUtf8Ssse3;
+        }
+        else
+        {
+            /* Use the scalar kernel. */
+        }
+        /* LCOV_EXCL_STOP */
+    #elif defined( DCEP_SIMD_NEON )
+        validateFn = Dcep_ValidateUtf8Neon;
+    #endif
+
+    return validateFn;
+}
+
+/*-----------------------------------------------------------*/
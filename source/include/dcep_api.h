@@ -4,6 +4,12 @@
 /* Data types includes. */
 #include "dcep_data_types.h"
 
+/* Channel open view includes. */
+#include "dcep_channel_open_view.h"
+
+/* Protocol table includes. */
+#include "dcep_protocol_table.h"
+
 /*-----------------------------------------------------------*/
 
 DcepResult_t Dcep_Init( DcepContext_t * pCtx );
@@ -13,20 +19,114 @@ DcepResult_t Dcep_SerializeChannelOpenMessage( DcepContext_t * pCtx,
                                                uint8_t * pBuffer,
                                                size_t * pBufferLength );
 
+DcepResult_t Dcep_GetChannelOpenMessageLength( DcepContext_t * pCtx,
+                                               const DcepChannelOpenMessage_t * pChannelOpenMessage,
+                                               size_t * pMessageLength );
+
+DcepResult_t Dcep_SerializeChannelOpenMessageIoVec( DcepContext_t * pCtx,
+                                                    const DcepChannelOpenMessage_t * pChannelOpenMessage,
+                                                    uint8_t * pHeaderBuffer,
+                                                    size_t headerBufferLength,
+                                                    DcepIoVec_t * pIoVecs,
+                                                    size_t * pIoVecCount );
+
+DcepResult_t Dcep_PrepareChannelOpenMessage( DcepContext_t * pCtx,
+                                             const DcepChannelOpenMessage_t * pChannelOpenMessage,
+                                             uint8_t * pTemplateBuffer,
+                                             size_t templateBufferLength,
+                                             DcepPreparedChannelOpenMessage_t * pPreparedMessage );
+
+DcepResult_t Dcep_SerializePreparedChannelOpenMessage( DcepContext_t * pCtx,
+                                                       const DcepPreparedChannelOpenMessage_t * pPreparedMessage,
+                                                       uint16_t priority,
+                                                       uint32_t reliabilityParameter,
+                                                       uint8_t * pBuffer,
+                                                       size_t * pBufferLength );
+
 DcepResult_t Dcep_SerializeChannelAckMessage( DcepContext_t * pCtx,
                                               uint8_t * pBuffer,
                                               size_t * pBufferLength );
 
+/* Writes the DATA_CHANNEL_ACK of each of the numStreamIds streams back to
+ * back into pBuffer and describes ACK i, sent on pStreamIds[ i ], in
+ * pEntries[ i ]. On input, pBufferLength holds the size of pBuffer; on
+ * output, the number of bytes written. */
+DcepResult_t Dcep_SerializeChannelAckBatch( DcepContext_t * pCtx,
+                                            const uint16_t * pStreamIds,
+                                            size_t numStreamIds,
+                                            uint8_t * pBuffer,
+                                            size_t * pBufferLength,
+                                            DcepAckBatchEntry_t * pEntries );
+
 DcepResult_t Dcep_DeserializeChannelOpenMessage( DcepContext_t * pCtx,
                                                  const uint8_t * pDcepMessage,
                                                  size_t dcepMessageLength,
                                                  DcepChannelOpenMessage_t * pChannelOpenMessage );
 
+/* Deserializes like Dcep_DeserializeChannelOpenMessage and looks the protocol
+ * up in pProtocolTable. On success, pHandlerId is set to the id registered
+ * for the protocol, or to DCEP_PROTOCOL_TABLE_NO_HANDLER if there is none. */
+DcepResult_t Dcep_DeserializeAndRouteChannelOpenMessage( DcepContext_t * pCtx,
+                                                         const DcepProtocolTable_t * pProtocolTable,
+                                                         const uint8_t * pDcepMessage,
+                                                         size_t dcepMessageLength,
+                                                         DcepChannelOpenMessage_t * pChannelOpenMessage,
+                                                         uint16_t * pHandlerId );
+
+/* Validates a DATA_CHANNEL_OPEN message like
+ * Dcep_DeserializeChannelOpenMessage and, on success, points pView at it
+ * without decoding any field. */
+DcepResult_t Dcep_InitChannelOpenView( DcepContext_t * pCtx,
+                                       const uint8_t * pDcepMessage,
+                                       size_t dcepMessageLength,
+                                       DcepChannelOpenView_t * pView );
+
+DcepResult_t Dcep_StreamingParserInit( DcepContext_t * pCtx,
+                                       DcepStreamingParser_t * pParser );
+
+DcepResult_t Dcep_StreamingParserFeed( DcepContext_t * pCtx,
+                                       DcepStreamingParser_t * pParser,
+                                       const uint8_t * pChunk,
+                                       size_t chunkLength,
+                                       DcepStreamingParserOutput_t * pOutput );
+
 DcepResult_t Dcep_GetMessageType( DcepContext_t * pCtx,
                                   const uint8_t * pDcepMessage,
                                   size_t dcepMessageLength,
                                   DcepMessageType_t * pDcepMessageType );
 
+/* Classifies an SCTP payload from its PPID and, for DCEP payloads, its message
+ * type. Only the first byte of a DCEP payload is inspected, so a
+ * DATA_CHANNEL_OPEN must still be validated by the deserializer. String and
+ * binary payloads must not be empty, while the payload of the empty PPIDs is
+ * ignored. */
+DcepPayloadClass_t Dcep_ClassifyPayload( uint32_t ppid,
+                                         const uint8_t * pPayload,
+                                         size_t payloadLength );
+
+DcepResult_t Dcep_DeserializeBatch( DcepContext_t * pCtx,
+                                    const DcepBatchEntry_t * pEntries,
+                                    size_t numEntries,
+                                    DcepBatchResult_t * pResults );
+
+#if defined( DCEP_ENABLE_METRICS )
+
+DcepResult_t Dcep_GetMetrics( DcepContext_t * pCtx,
+                              DcepMetrics_t * pMetrics );
+
+DcepResult_t Dcep_ResetMetrics( DcepContext_t * pCtx );
+
+#endif /* DCEP_ENABLE_METRICS */
+
+#if defined( DCEP_ENABLE_PROFILING )
+
+DcepResult_t Dcep_GetProfile( DcepContext_t * pCtx,
+                              DcepProfile_t * pProfile );
+
+DcepResult_t Dcep_ResetProfile( DcepContext_t * pCtx );
+
+#endif /* DCEP_ENABLE_PROFILING */
+
 /*-----------------------------------------------------------*/
 
 #endif /* DCEP_API_H */
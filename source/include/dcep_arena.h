@@ -0,0 +1,48 @@
+#ifndef DCEP_ARENA_H
+#define DCEP_ARENA_H
+
+/* Data types includes. */
+#include "dcep_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/* Bump allocator over a caller-provided slab.
+ *
+ * Dcep_DeserializeChannelOpenMessage returns the label and protocol as
+ * pointers into the received message. Dcep_ArenaCopyChannelOpenMessage
+ * copies them into the slab instead, so that the receive buffer can be
+ * reused while the channel is open. Allocations are byte aligned and are
+ * never freed one by one; Dcep_ArenaReset releases all of them at once, for
+ * example when the association is torn down. */
+typedef struct DcepArena
+{
+    uint8_t * pMemory;
+    size_t size;
+    size_t used;
+} DcepArena_t;
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ArenaInit( DcepArena_t * pArena,
+                             void * pMemory,
+                             size_t memorySize );
+
+DcepResult_t Dcep_ArenaAllocate( DcepArena_t * pArena,
+                                 size_t length,
+                                 uint8_t ** ppAllocation );
+
+/* Copies pSrc to pDst with the label and protocol moved into the arena, in
+ * one allocation of channelNameLength + protocolLength bytes. pSrc and pDst
+ * may point to the same message. Nothing is allocated and pDst is left
+ * unchanged if the arena does not have enough space. */
+DcepResult_t Dcep_ArenaCopyChannelOpenMessage( DcepArena_t * pArena,
+                                               const DcepChannelOpenMessage_t * pSrc,
+                                               DcepChannelOpenMessage_t * pDst );
+
+/* Releases every allocation. Messages copied into the arena must not be used
+ * afterwards. */
+DcepResult_t Dcep_ArenaReset( DcepArena_t * pArena );
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_ARENA_H */
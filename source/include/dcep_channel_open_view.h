@@ -0,0 +1,106 @@
+#ifndef DCEP_CHANNEL_OPEN_VIEW_H
+#define DCEP_CHANNEL_OPEN_VIEW_H
+
+/* Data types includes. */
+#include "dcep_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/* Offsets of the DCEP header fields. See DCEP_HEADER_LENGTH for the layout. */
+#define DCEP_MESSAGE_TYPE_OFFSET             0
+#define DCEP_MESSAGE_TYPE_LENGTH             1
+#define DCEP_CHANNEL_TYPE_OFFSET             1
+#define DCEP_PRIORITY_OFFSET                 2
+#define DCEP_RELIABILITY_PARAMETER_OFFSET    4
+#define DCEP_LABEL_LENGTH_OFFSET             8
+#define DCEP_PROTOCOL_LENGTH_OFFSET          10
+
+/* Zero-copy view of a DATA_CHANNEL_OPEN message.
+ *
+ * Dcep_InitChannelOpenView validates the message once, after which the
+ * accessors below decode single fields from the wire on demand. Unlike
+ * DcepChannelOpenMessage_t, the view is a single pointer, and a caller that
+ * only needs the label does not pay for decoding the other fields. The
+ * message buffer must remain valid and unmodified for as long as the view is
+ * used. */
+typedef struct DcepChannelOpenView
+{
+    const uint8_t * pDcepMessage;
+} DcepChannelOpenView_t;
+
+/*-----------------------------------------------------------*/
+
+/* The accessors read network byte order with shifts so that they do not need
+ * a context. Compilers reduce these to a load and a byte swap. */
+static DCEP_INLINE uint16_t Dcep_ChannelOpenViewReadUint16( const uint8_t * pSrc )
+{
+    return ( uint16_t ) ( ( ( uint16_t ) pSrc[ 0 ] << 8 ) |
+                          ( uint16_t ) pSrc[ 1 ] );
+}
+
+static DCEP_INLINE uint32_t Dcep_ChannelOpenViewReadUint32( const uint8_t * pSrc )
+{
+    return ( ( uint32_t ) pSrc[ 0 ] << 24 ) |
+           ( ( uint32_t ) pSrc[ 1 ] << 16 ) |
+           ( ( uint32_t ) pSrc[ 2 ] << 8 ) |
+           ( uint32_t ) pSrc[ 3 ];
+}
+
+/*-----------------------------------------------------------*/
+
+static DCEP_INLINE DcepChannelType_t Dcep_ChannelOpenViewGetChannelType( const DcepChannelOpenView_t * pView )
+{
+    return ( DcepChannelType_t ) pView->pDcepMessage[ DCEP_CHANNEL_TYPE_OFFSET ];
+}
+
+static DCEP_INLINE uint16_t Dcep_ChannelOpenViewGetPriority( const DcepChannelOpenView_t * pView )
+{
+    return Dcep_ChannelOpenViewReadUint16( &( pView->pDcepMessage[ DCEP_PRIORITY_OFFSET ] ) );
+}
+
+/* Returns 0 unless the channel type is a partial reliable rexmit type. */
+static DCEP_INLINE uint32_t Dcep_ChannelOpenViewGetNumRetransmissions( const DcepChannelOpenView_t * pView )
+{
+    uint8_t descriptor = DCEP_GET_DESCRIPTOR( pView->pDcepMessage[ DCEP_CHANNEL_TYPE_OFFSET ] );
+
+    return Dcep_ChannelOpenViewReadUint32( &( pView->pDcepMessage[ DCEP_RELIABILITY_PARAMETER_OFFSET ] ) ) &
+           DCEP_DESCRIPTOR_MASK( descriptor, DCEP_DESCRIPTOR_REXMIT );
+}
+
+/* Returns 0 unless the channel type is a partial reliable timed type. */
+static DCEP_INLINE uint32_t Dcep_ChannelOpenViewGetMaxLifetimeInMilliseconds( const DcepChannelOpenView_t * pView )
+{
+    uint8_t descriptor = DCEP_GET_DESCRIPTOR( pView->pDcepMessage[ DCEP_CHANNEL_TYPE_OFFSET ] );
+
+    return Dcep_ChannelOpenViewReadUint32( &( pView->pDcepMessage[ DCEP_RELIABILITY_PARAMETER_OFFSET ] ) ) &
+           DCEP_DESCRIPTOR_MASK( descriptor, DCEP_DESCRIPTOR_TIMED );
+}
+
+/* Returns the label and writes its length to pChannelNameLength. Like
+ * Dcep_DeserializeChannelOpenMessage, an empty label is returned as NULL. */
+static DCEP_INLINE const uint8_t * Dcep_ChannelOpenViewGetChannelName( const DcepChannelOpenView_t * pView,
+                                                                       uint16_t * pChannelNameLength )
+{
+    uint16_t channelNameLength = Dcep_ChannelOpenViewReadUint16( &( pView->pDcepMessage[ DCEP_LABEL_LENGTH_OFFSET ] ) );
+
+    *pChannelNameLength = channelNameLength;
+
+    return ( channelNameLength > 0U ) ? &( pView->pDcepMessage[ DCEP_HEADER_LENGTH ] ) : NULL;
+}
+
+/* Returns the protocol and writes its length to pProtocolLength. An empty
+ * protocol is returned as NULL. */
+static DCEP_INLINE const uint8_t * Dcep_ChannelOpenViewGetProtocol( const DcepChannelOpenView_t * pView,
+                                                                    uint16_t * pProtocolLength )
+{
+    uint16_t channelNameLength = Dcep_ChannelOpenViewReadUint16( &( pView->pDcepMessage[ DCEP_LABEL_LENGTH_OFFSET ] ) );
+    uint16_t protocolLength = Dcep_ChannelOpenViewReadUint16( &( pView->pDcepMessage[ DCEP_PROTOCOL_LENGTH_OFFSET ] ) );
+
+    *pProtocolLength = protocolLength;
+
+    return ( protocolLength > 0U ) ? &( pView->pDcepMessage[ DCEP_HEADER_LENGTH + channelNameLength ] ) : NULL;
+}
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_CHANNEL_OPEN_VIEW_H */
@@ -0,0 +1,75 @@
+#ifndef DCEP_CHANNEL_POOL_H
+#define DCEP_CHANNEL_POOL_H
+
+/* Data types includes. */
+#include "dcep_data_types.h"
+
+/* Channel state includes. */
+#include "dcep_channel_registry.h"
+
+/*-----------------------------------------------------------*/
+
+/* Every channel record starts on its own cache line so that records of
+ * different channels never share a line. Override to match the target. */
+#if !defined( DCEP_CACHE_LINE_SIZE )
+    #define DCEP_CACHE_LINE_SIZE    64
+#endif
+
+/* One channel per usable stream id. */
+#define DCEP_CHANNEL_POOL_MAX_CAPACITY    65535
+
+/* Per-channel record. channelOpenMessage holds the decoded DATA_CHANNEL_OPEN
+ * fields; its label and protocol are not copied, see DcepArena_t to keep
+ * them past the lifetime of the received message. */
+typedef struct DcepChannel
+{
+    DcepChannelOpenMessage_t channelOpenMessage;
+    uint16_t streamId;
+    uint8_t state;
+    uint8_t allocated;
+    struct DcepChannel * pNextFree;
+} DcepChannel_t;
+
+/* Size of one block of the pool: a record rounded up to whole cache lines. */
+#define DCEP_CHANNEL_POOL_BLOCK_SIZE                                              \
+    ( ( ( sizeof( DcepChannel_t ) + DCEP_CACHE_LINE_SIZE - 1 ) / DCEP_CACHE_LINE_SIZE ) * \
+      DCEP_CACHE_LINE_SIZE )
+
+/* Fixed-block pool of channel records.
+ *
+ * All blocks are carved out of a single caller-provided buffer, aligned to
+ * DCEP_CACHE_LINE_SIZE, whose size is given by Dcep_ChannelPoolGetMemorySize.
+ * Reserving the worst case number of channels when the association is set
+ * up means that an allocation never calls malloc and fails only when every
+ * block is in use. Free blocks are kept on an intrusive list, so allocate
+ * and free are O(1). */
+typedef struct DcepChannelPool
+{
+    uint8_t * pBlocks;
+    DcepChannel_t * pFreeList;
+    size_t capacity;
+    size_t freeCount;
+} DcepChannelPool_t;
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelPoolGetMemorySize( size_t capacity,
+                                            size_t * pMemorySize );
+
+DcepResult_t Dcep_ChannelPoolInit( DcepChannelPool_t * pPool,
+                                   void * pMemory,
+                                   size_t memorySize,
+                                   size_t capacity );
+
+/* Returns a zeroed record in the CLOSED state. */
+DcepResult_t Dcep_ChannelPoolAllocate( DcepChannelPool_t * pPool,
+                                       DcepChannel_t ** ppChannel );
+
+/* Returns DCEP_RESULT_BAD_PARAM if pChannel is not a block of the pool and
+ * DCEP_RESULT_INVALID_STATE if it is already free. */
+DcepResult_t Dcep_ChannelPoolFree( DcepChannelPool_t * pPool,
+                                   DcepChannel_t * pChannel );
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_CHANNEL_POOL_H */
@@ -0,0 +1,129 @@
+#ifndef DCEP_CHANNEL_REGISTRY_H
+#define DCEP_CHANNEL_REGISTRY_H
+
+/* Data types includes. */
+#include "dcep_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/* SCTP stream id 65535 is reserved and is never assigned to a data channel.
+ * The registry uses it to mark empty slots. */
+#define DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID    0xFFFF
+
+/* Largest registry capacity. A registry of this capacity can hold every
+ * usable stream id of an association. */
+#define DCEP_CHANNEL_REGISTRY_MAX_CAPACITY       65536
+
+typedef enum DcepChannelState
+{
+    DCEP_CHANNEL_STATE_CLOSED = 0,
+    DCEP_CHANNEL_STATE_OPENING,
+    DCEP_CHANNEL_STATE_OPEN
+} DcepChannelState_t;
+
+/* Label and protocol of a registered channel. These are only needed when a
+ * channel is opened or reported to the application, so they are kept apart
+ * from the fields read on every inbound message. The registry does not copy
+ * the label and protocol bytes; they must remain valid for as long as the
+ * channel is registered. */
+typedef struct DcepChannelRegistryLabel
+{
+    const uint8_t * pChannelName;
+    uint16_t channelNameLength;
+    const uint8_t * pProtocol;
+    uint16_t protocolLength;
+} DcepChannelRegistryLabel_t;
+
+/* Optional reverse index from label to stream id.
+ *
+ * An open addressing hash table with linear probing and the same capacity as
+ * the registry. Each slot holds the hash of a label next to the stream id of
+ * the channel, so a lookup only reads the label of channels whose hash
+ * matches instead of scanning every channel. Several channels may share a
+ * label. */
+typedef struct DcepChannelLabelIndex
+{
+    uint32_t * pHashes;
+    uint16_t * pStreamIds;
+} DcepChannelLabelIndex_t;
+
+/* Channel table of one SCTP association, keyed by stream id.
+ *
+ * The table is an open addressing hash table with linear probing. Each field
+ * is stored in its own array so that a lookup only touches the stream id
+ * array and the field being read. All arrays are carved out of a single
+ * caller-provided buffer, aligned for a pointer, whose size is given by
+ * Dcep_ChannelRegistryGetMemorySize. The capacity must be a power of two;
+ * one slot is always kept empty, so a registry holds at most capacity - 1
+ * channels. Lookups stay short when the capacity is at least twice the
+ * number of open channels. Once enabled with
+ * Dcep_ChannelRegistryEnableLabelIndex, labelIndex is kept up to date as
+ * channels are inserted and removed. */
+typedef struct DcepChannelRegistry
+{
+    uint16_t * pStreamIds;
+    uint8_t * pStates;
+    uint8_t * pChannelTypes;
+    uint16_t * pPriorities;
+    uint32_t * pReliabilityParameters;
+    DcepChannelRegistryLabel_t * pLabels;
+    DcepChannelLabelIndex_t labelIndex;
+    size_t capacity;
+    size_t count;
+    uint32_t hashShift;
+} DcepChannelRegistry_t;
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ChannelRegistryGetMemorySize( size_t capacity,
+                                                size_t * pMemorySize );
+
+DcepResult_t Dcep_ChannelRegistryInit( DcepChannelRegistry_t * pRegistry,
+                                       void * pMemory,
+                                       size_t memorySize,
+                                       size_t capacity );
+
+DcepResult_t Dcep_ChannelRegistryInsert( DcepChannelRegistry_t * pRegistry,
+                                         uint16_t streamId,
+                                         DcepChannelState_t state,
+                                         const DcepChannelOpenMessage_t * pChannelOpenMessage );
+
+DcepResult_t Dcep_ChannelRegistryFind( const DcepChannelRegistry_t * pRegistry,
+                                       uint16_t streamId,
+                                       size_t * pIndex );
+
+DcepResult_t Dcep_ChannelRegistryGetState( const DcepChannelRegistry_t * pRegistry,
+                                           uint16_t streamId,
+                                           DcepChannelState_t * pState );
+
+DcepResult_t Dcep_ChannelRegistrySetState( DcepChannelRegistry_t * pRegistry,
+                                           uint16_t streamId,
+                                           DcepChannelState_t state );
+
+DcepResult_t Dcep_ChannelRegistryGetChannel( const DcepChannelRegistry_t * pRegistry,
+                                             uint16_t streamId,
+                                             DcepChannelOpenMessage_t * pChannelOpenMessage );
+
+DcepResult_t Dcep_ChannelRegistryRemove( DcepChannelRegistry_t * pRegistry,
+                                         uint16_t streamId );
+
+DcepResult_t Dcep_ChannelRegistryGetLabelIndexMemorySize( size_t capacity,
+                                                          size_t * pMemorySize );
+
+/* Builds the label index of the channels already registered in a
+ * caller-provided buffer, aligned for a uint32_t, whose size is given by
+ * Dcep_ChannelRegistryGetLabelIndexMemorySize for the registry capacity. */
+DcepResult_t Dcep_ChannelRegistryEnableLabelIndex( DcepChannelRegistry_t * pRegistry,
+                                                   void * pMemory,
+                                                   size_t memorySize );
+
+/* Finds a channel by label. If several channels have the label, any one of
+ * them is returned. Without a label index, every channel is scanned. */
+DcepResult_t Dcep_ChannelRegistryFindByLabel( const DcepChannelRegistry_t * pRegistry,
+                                              const uint8_t * pChannelName,
+                                              size_t channelNameLength,
+                                              uint16_t * pStreamId );
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_CHANNEL_REGISTRY_H */
@@ -8,6 +8,18 @@
 /* Endianness includes. */
 #include "dcep_endianness.h"
 
+/* Header block kernel includes. */
+#include "dcep_simd.h"
+
+/* UTF-8 validator includes. */
+#include "dcep_utf8.h"
+
+/* Latency histogram includes. */
+#include "dcep_profiling.h"
+
+/* Wire byte descriptor includes. */
+#include "dcep_descriptors.h"
+
 /*-----------------------------------------------------------*/
 
 /* DCEP Header:
@@ -24,6 +36,18 @@
  */
 #define DCEP_HEADER_LENGTH                      12
 
+/* DCEP DATA_CHANNEL_ACK Message:
+ *
+ * RFC - https://datatracker.ietf.org/doc/html/draft-ietf-rtcweb-data-protocol-09#section-5.2
+ *
+ *  0                   1                   2                   3
+ *  0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1 2 3 4 5 6 7 8 9 0 1
+ * +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ * |  Message Type |
+ * +-+-+-+-+-+-+-+-+
+ */
+#define DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH    1
+
 /*-----------------------------------------------------------*/
 
 typedef enum DcepResult
@@ -31,7 +55,10 @@ typedef enum DcepResult
     DCEP_RESULT_OK,
     DCEP_RESULT_BAD_PARAM,
     DCEP_RESULT_OUT_OF_MEMORY,
-    DCEP_RESULT_MALFORMED_MESSAGE
+    DCEP_RESULT_MALFORMED_MESSAGE,
+    DCEP_RESULT_NOT_FOUND,
+    DCEP_RESULT_ALREADY_EXISTS,
+    DCEP_RESULT_INVALID_STATE
 } DcepResult_t;
 
 typedef enum DcepMessageType
@@ -50,11 +77,91 @@ typedef enum DcepChannelType
     DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED  = 0x82
 } DcepChannelType_t;
 
+/* SCTP Payload Protocol Identifiers of WebRTC data channels (RFC 8831). The
+ * deprecated partial string (52) and partial binary (54) identifiers are not
+ * supported. */
+typedef enum DcepPpid
+{
+    DCEP_PPID_DCEP         = 50,
+    DCEP_PPID_STRING       = 51,
+    DCEP_PPID_BINARY       = 53,
+    DCEP_PPID_STRING_EMPTY = 56,
+    DCEP_PPID_BINARY_EMPTY = 57
+} DcepPpid_t;
+
+/* Kind of an SCTP payload as returned by Dcep_ClassifyPayload. */
+typedef enum DcepPayloadClass
+{
+    DCEP_PAYLOAD_CLASS_INVALID = 0,
+    DCEP_PAYLOAD_CLASS_DATA_CHANNEL_OPEN,
+    DCEP_PAYLOAD_CLASS_DATA_CHANNEL_ACK,
+    DCEP_PAYLOAD_CLASS_STRING,
+    DCEP_PAYLOAD_CLASS_BINARY,
+    DCEP_PAYLOAD_CLASS_STRING_EMPTY,
+    DCEP_PAYLOAD_CLASS_BINARY_EMPTY
+} DcepPayloadClass_t;
+
 /*-----------------------------------------------------------*/
 
+/* Per-context counters, compiled in when DCEP_ENABLE_METRICS is defined.
+ *
+ * Counters are plain increments and are not safe to update from multiple
+ * threads that share a context. A DATA_CHANNEL_ACK is counted as
+ * deserialized when Dcep_GetMessageType, Dcep_DeserializeBatch or
+ * Dcep_ProcessMessage identifies it, and a DATA_CHANNEL_OPEN when
+ * Dcep_InitChannelOpenView validates it. A message rejected as malformed is
+ * counted under the first check it fails. */
+#if defined( DCEP_ENABLE_METRICS )
+
+typedef struct DcepMetrics
+{
+    uint32_t channelOpenMessagesSerialized;
+    uint32_t channelAckMessagesSerialized;
+    uint32_t channelOpenMessagesDeserialized;
+    uint32_t channelAckMessagesDeserialized;
+    uint64_t bytesSerialized;
+    uint64_t bytesDeserialized;
+
+    /* Messages shorter than the DCEP header. */
+    uint32_t malformedTruncatedHeader;
+    /* Messages of an unknown or unexpected message type. */
+    uint32_t malformedMessageType;
+    uint32_t malformedChannelType;
+    uint32_t malformedLabelOverrun;
+    uint32_t malformedProtocolOverrun;
+    /* Labels or protocols that are not UTF-8, only checked when
+     * DCEP_ENABLE_STRICT_UTF8 is defined. */
+    uint32_t malformedUtf8;
+
+    uint32_t outOfMemory;
+} DcepMetrics_t;
+
+    #define DCEP_METRICS_INCREMENT( pCtx, counter )     ( ( pCtx )->metrics.counter++ )
+    #define DCEP_METRICS_ADD( pCtx, counter, value )    ( ( pCtx )->metrics.counter += ( value ) )
+
+#else
+
+    #define DCEP_METRICS_INCREMENT( pCtx, counter )
+    #define DCEP_METRICS_ADD( pCtx, counter, value )
+
+#endif /* DCEP_ENABLE_METRICS */
+
 typedef struct DcepContext
 {
     DcepReadWriteFunctions_t readWriteFunctions;
+    DcepValidateHeaderBlock_t validateHeaderBlockFn;
+    DcepValidateUtf8_t validateUtf8Fn;
+
+    #if defined( DCEP_ENABLE_METRICS )
+        DcepMetrics_t metrics;
+    #endif
+
+    /* Latency of each public function of dcep_api.c, compiled in when
+     * DCEP_ENABLE_PROFILING is defined. Like the metrics, the histograms are
+     * not safe to update from multiple threads that share a context. */
+    #if defined( DCEP_ENABLE_PROFILING )
+        DcepProfile_t profile;
+    #endif
 } DcepContext_t;
 
 /* DCEP DATA_CHANNEL_OPEN Message:
@@ -99,6 +206,100 @@ typedef struct DcepChannelOpenMessage
     uint16_t protocolLength;
 } DcepChannelOpenMessage_t;
 
+/* Scatter-gather element describing one contiguous part of a serialized
+ * message. The layout mirrors struct iovec so that an array of these can be
+ * translated one-to-one for a gather send. */
+typedef struct DcepIoVec
+{
+    const uint8_t * pBase;
+    size_t length;
+} DcepIoVec_t;
+
+/* DATA_CHANNEL_OPEN message serialized once by Dcep_PrepareChannelOpenMessage.
+ * Dcep_SerializePreparedChannelOpenMessage copies the template and patches
+ * only the priority and reliability parameter. The template buffer must
+ * remain valid and unmodified for as long as the prepared message is used. */
+typedef struct DcepPreparedChannelOpenMessage
+{
+    const uint8_t * pTemplate;
+    size_t templateLength;
+    uint8_t hasReliabilityParameter;
+} DcepPreparedChannelOpenMessage_t;
+
+/* State of a DcepStreamingParser_t. */
+typedef enum DcepStreamingParserState
+{
+    DCEP_STREAMING_PARSER_STATE_HEADER,
+    DCEP_STREAMING_PARSER_STATE_LABEL,
+    DCEP_STREAMING_PARSER_STATE_PROTOCOL,
+    DCEP_STREAMING_PARSER_STATE_COMPLETE,
+    DCEP_STREAMING_PARSER_STATE_ERROR
+} DcepStreamingParserState_t;
+
+/* Resumable parser for a DATA_CHANNEL_OPEN message delivered in multiple
+ * chunks. Only the 12-byte header is buffered; label and protocol bytes are
+ * returned as views into the chunks passed to Dcep_StreamingParserFeed.
+ * Once the header is decoded, channelOpenMessage holds the header fields and
+ * its pChannelName and pProtocol members are NULL. */
+typedef struct DcepStreamingParser
+{
+    DcepStreamingParserState_t state;
+    uint8_t header[ DCEP_HEADER_LENGTH ];
+    size_t headerLength;
+    size_t remainingFieldLength;
+    DcepChannelOpenMessage_t channelOpenMessage;
+
+    /* Validator state of the field being parsed, so that a character split
+     * across chunks is validated as a whole. */
+    #if defined( DCEP_ENABLE_STRICT_UTF8 )
+        uint32_t utf8State;
+    #endif
+} DcepStreamingParser_t;
+
+/* What one call to Dcep_StreamingParserFeed produced. The label and protocol
+ * segments point into the chunk and have zero length when the chunk does not
+ * contain any bytes of that field. */
+typedef struct DcepStreamingParserOutput
+{
+    uint8_t headerDecoded;
+    uint8_t messageComplete;
+    DcepIoVec_t labelSegment;
+    DcepIoVec_t protocolSegment;
+    size_t consumedLength;
+} DcepStreamingParserOutput_t;
+
+/* One inbound DCEP message handed to Dcep_DeserializeBatch. */
+typedef struct DcepBatchEntry
+{
+    const uint8_t * pDcepMessage;
+    size_t dcepMessageLength;
+    uint16_t streamId;
+} DcepBatchEntry_t;
+
+/* Per-message outcome of Dcep_DeserializeBatch. messageType is valid when
+ * result is DCEP_RESULT_OK, and channelOpenMessage is valid only when
+ * messageType is DCEP_MESSAGE_DATA_CHANNEL_OPEN. */
+typedef struct DcepBatchResult
+{
+    DcepResult_t result;
+    uint16_t streamId;
+    DcepMessageType_t messageType;
+    DcepChannelOpenMessage_t channelOpenMessage;
+} DcepBatchResult_t;
+
+/* One DATA_CHANNEL_ACK written by Dcep_SerializeChannelAckBatch. payload
+ * points into the contiguous output buffer, so the entries can be turned
+ * into the messages of a single batched SCTP send. */
+typedef struct DcepAckBatchEntry
+{
+    uint16_t streamId;
+    DcepIoVec_t payload;
+} DcepAckBatchEntry_t;
+
+/* A DATA_CHANNEL_OPEN message is described by at most three scatter-gather
+ * elements: header, label and protocol. */
+#define DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS    3
+
 /*-----------------------------------------------------------*/
 
 #endif /* DCEP_DATA_TYPES_H */
@@ -0,0 +1,34 @@
+#ifndef DCEP_DESCRIPTORS_H
+#define DCEP_DESCRIPTORS_H
+
+/* Standard includes. */
+#include <stdint.h>
+
+/*-----------------------------------------------------------*/
+
+/* Descriptor bits of a wire byte.
+ *
+ * Dcep_WireByteDescriptors is indexed by a byte read from the wire and tells,
+ * in one load, whether it is a valid channel type and which reliability
+ * parameter and ordering the channel type selects, and whether it is a valid
+ * message type. Both fields share the table as their values do not clash. */
+#define DCEP_DESCRIPTOR_CHANNEL_TYPE_VALID    0x01U
+#define DCEP_DESCRIPTOR_REXMIT                0x02U
+#define DCEP_DESCRIPTOR_TIMED                 0x04U
+#define DCEP_DESCRIPTOR_UNORDERED             0x08U
+#define DCEP_DESCRIPTOR_MESSAGE_TYPE_VALID    0x10U
+
+#define DCEP_DESCRIPTOR_PARTIAL_RELIABLE      ( DCEP_DESCRIPTOR_REXMIT | DCEP_DESCRIPTOR_TIMED )
+
+extern const uint8_t Dcep_WireByteDescriptors[ 256 ];
+
+#define DCEP_GET_DESCRIPTOR( wireByte )    ( Dcep_WireByteDescriptors[ ( uint8_t ) ( wireByte ) ] )
+
+/* All ones if the descriptor has the bit set, zero otherwise. Used to select
+ * the reliability parameter without branching on the channel type. */
+#define DCEP_DESCRIPTOR_MASK( descriptor, bit ) \
+    ( ( uint32_t ) 0U - ( uint32_t ) ( ( ( descriptor ) & ( bit ) ) != 0U ) )
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_DESCRIPTORS_H */
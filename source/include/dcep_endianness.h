@@ -3,6 +3,7 @@
 
 /* Standard includes. */
 #include <stdint.h>
+#include <string.h>
 
 /* Endianness Function types. */
 typedef void ( * DcepWriteUint16_t ) ( uint8_t * pDst, uint16_t val );
@@ -20,4 +21,89 @@ typedef struct DcepReadWriteFunctions
 
 void Dcep_InitReadWriteFunctions( DcepReadWriteFunctions_t * pReadWriteFunctions );
 
+/*-----------------------------------------------------------*/
+
+/* Compile-time endianness:
+ *
+ * By default, the host byte order is detected at runtime and the library
+ * reads and writes multi-byte fields through the function pointers in
+ * DcepReadWriteFunctions_t. Define DCEP_HOST_ENDIANNESS to either
+ * DCEP_ENDIANNESS_LITTLE or DCEP_ENDIANNESS_BIG to fix the host byte order
+ * at compile time instead. The library then uses the inline accessors below,
+ * which the compiler can reduce to a single load/store and byte swap.
+ */
+#define DCEP_ENDIANNESS_LITTLE    1
+#define DCEP_ENDIANNESS_BIG       2
+
+#if defined( __STDC_VERSION__ ) && ( __STDC_VERSION__ >= 199901L )
+    #define DCEP_INLINE    inline
+#elif defined( __GNUC__ )
+    #define DCEP_INLINE    __inline__
+#else
+    #define DCEP_INLINE
+#endif
+
+#if defined( DCEP_HOST_ENDIANNESS )
+
+#if ( DCEP_HOST_ENDIANNESS != DCEP_ENDIANNESS_LITTLE ) && ( DCEP_HOST_ENDIANNESS != DCEP_ENDIANNESS_BIG )
+    #error "DCEP_HOST_ENDIANNESS must be DCEP_ENDIANNESS_LITTLE or DCEP_ENDIANNESS_BIG."
+#endif
+
+#if ( DCEP_HOST_ENDIANNESS == DCEP_ENDIANNESS_LITTLE )
+    #if defined( __GNUC__ )
+        #define DCEP_HOST_TO_NETWORK_16( value )    __builtin_bswap16( value )
+        #define DCEP_HOST_TO_NETWORK_32( value )    __builtin_bswap32( value )
+    #else
+        #define DCEP_HOST_TO_NETWORK_16( value )                \
+            ( ( uint16_t ) ( ( ( ( value ) >> 8 ) & 0xFF ) |    \
+                             ( ( ( value ) & 0xFF ) << 8 ) ) )
+        #define DCEP_HOST_TO_NETWORK_32( value )                \
+            ( ( uint32_t ) ( ( ( ( value ) >> 24 ) & 0xFF ) |   \
+                             ( ( ( value ) >> 8 ) & 0xFF00 ) |  \
+                             ( ( ( value ) & 0xFF00 ) << 8 ) |  \
+                             ( ( ( value ) & 0xFF ) << 24 ) ) )
+    #endif
+#else
+    #define DCEP_HOST_TO_NETWORK_16( value )    ( value )
+    #define DCEP_HOST_TO_NETWORK_32( value )    ( value )
+#endif
+
+static DCEP_INLINE void Dcep_WriteUint16( uint8_t * pDst,
+                                          uint16_t val )
+{
+    uint16_t networkValue = DCEP_HOST_TO_NETWORK_16( val );
+
+    memcpy( pDst, &( networkValue ), sizeof( networkValue ) );
+}
+
+static DCEP_INLINE void Dcep_WriteUint32( uint8_t * pDst,
+                                          uint32_t val )
+{
+    uint32_t networkValue = DCEP_HOST_TO_NETWORK_32( val );
+
+    memcpy( pDst, &( networkValue ), sizeof( networkValue ) );
+}
+
+static DCEP_INLINE uint16_t Dcep_ReadUint16( const uint8_t * pSrc )
+{
+    uint16_t networkValue;
+
+    memcpy( &( networkValue ), pSrc, sizeof( networkValue ) );
+
+    return DCEP_HOST_TO_NETWORK_16( networkValue );
+}
+
+static DCEP_INLINE uint32_t Dcep_ReadUint32( const uint8_t * pSrc )
+{
+    uint32_t networkValue;
+
+    memcpy( &( networkValue ), pSrc, sizeof( networkValue ) );
+
+    return DCEP_HOST_TO_NETWORK_32( networkValue );
+}
+
+#endif /* DCEP_HOST_ENDIANNESS */
+
+/*-----------------------------------------------------------*/
+
 #endif /* DCEP_ENDIANNESS_H */
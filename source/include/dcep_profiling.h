@@ -0,0 +1,86 @@
+#ifndef DCEP_PROFILING_H
+#define DCEP_PROFILING_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/*-----------------------------------------------------------*/
+
+/* Number of buckets of a latency histogram. Bucket 0 counts calls that took
+ * 0 or 1 ticks, bucket i counts calls that took [ 2^i, 2^(i+1) ) ticks and
+ * the last bucket also counts all longer calls. */
+#define DCEP_LATENCY_HISTOGRAM_BUCKETS    32
+
+/* Source of the timestamps used by the profiling hooks. It can be defined to
+ * any expression returning a monotonic uint64_t count of ticks. By default,
+ * the time stamp counter is read on x86 with GCC or Clang and the monotonic
+ * clock in nanoseconds is read on POSIX systems. */
+#if !defined( DCEP_PROFILING_TIMESTAMP )
+    #if ( defined( __x86_64__ ) || defined( __i386__ ) ) && defined( __GNUC__ )
+        #define DCEP_PROFILING_TIMESTAMP()    ( ( uint64_t ) __builtin_ia32_rdtsc() )
+    #elif defined( __unix__ ) || defined( __APPLE__ )
+        #define DCEP_PROFILING_POSIX_CLOCK    1
+        #define DCEP_PROFILING_TIMESTAMP()    Dcep_GetMonotonicTimestamp()
+    #elif defined( DCEP_ENABLE_PROFILING )
+        #error "Define DCEP_PROFILING_TIMESTAMP() to profile on this platform."
+    #endif
+#endif
+
+/* Public functions of dcep_api.c that are timed when DCEP_ENABLE_PROFILING is
+ * defined. */
+typedef enum DcepProfiledFunction
+{
+    DCEP_PROFILED_FUNCTION_SERIALIZE_CHANNEL_OPEN_MESSAGE = 0,
+    DCEP_PROFILED_FUNCTION_GET_CHANNEL_OPEN_MESSAGE_LENGTH,
+    DCEP_PROFILED_FUNCTION_SERIALIZE_CHANNEL_OPEN_MESSAGE_IOVEC,
+    DCEP_PROFILED_FUNCTION_PREPARE_CHANNEL_OPEN_MESSAGE,
+    DCEP_PROFILED_FUNCTION_SERIALIZE_PREPARED_CHANNEL_OPEN_MESSAGE,
+    DCEP_PROFILED_FUNCTION_SERIALIZE_CHANNEL_ACK_MESSAGE,
+    DCEP_PROFILED_FUNCTION_SERIALIZE_CHANNEL_ACK_BATCH,
+    DCEP_PROFILED_FUNCTION_DESERIALIZE_CHANNEL_OPEN_MESSAGE,
+    DCEP_PROFILED_FUNCTION_DESERIALIZE_AND_ROUTE_CHANNEL_OPEN_MESSAGE,
+    DCEP_PROFILED_FUNCTION_INIT_CHANNEL_OPEN_VIEW,
+    DCEP_PROFILED_FUNCTION_STREAMING_PARSER_INIT,
+    DCEP_PROFILED_FUNCTION_STREAMING_PARSER_FEED,
+    DCEP_PROFILED_FUNCTION_GET_MESSAGE_TYPE,
+    DCEP_PROFILED_FUNCTION_DESERIALIZE_BATCH,
+    DCEP_PROFILED_FUNCTION_COUNT
+} DcepProfiledFunction_t;
+
+typedef struct DcepLatencyHistogram
+{
+    uint32_t buckets[ DCEP_LATENCY_HISTOGRAM_BUCKETS ];
+    uint32_t count;
+    uint64_t totalTicks;
+    uint64_t maxTicks;
+} DcepLatencyHistogram_t;
+
+/* One histogram per profiled function, indexed by DcepProfiledFunction_t. */
+typedef struct DcepProfile
+{
+    DcepLatencyHistogram_t histograms[ DCEP_PROFILED_FUNCTION_COUNT ];
+} DcepProfile_t;
+
+/*-----------------------------------------------------------*/
+
+void Dcep_LatencyHistogramRecord( DcepLatencyHistogram_t * pHistogram,
+                                  uint64_t ticks );
+
+/* Returns an upper bound of the latency below which quantilePpm parts per
+ * million of the recorded calls fall, e.g. 999000 for p99.9. The bound is the
+ * end of the bucket that holds the quantile, capped at maxTicks. Returns 0 if
+ * nothing is recorded. */
+uint64_t Dcep_LatencyHistogramGetQuantile( const DcepLatencyHistogram_t * pHistogram,
+                                           uint32_t quantilePpm );
+
+#if defined( DCEP_PROFILING_POSIX_CLOCK )
+
+/* Monotonic clock in nanoseconds. */
+uint64_t Dcep_GetMonotonicTimestamp( void );
+
+#endif /* DCEP_PROFILING_POSIX_CLOCK */
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_PROFILING_H */
@@ -0,0 +1,70 @@
+#ifndef DCEP_PROTOCOL_TABLE_H
+#define DCEP_PROTOCOL_TABLE_H
+
+/* Data types includes. */
+#include "dcep_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/* Largest number of protocols in a table. Must be a power of two. Override
+ * to trade the size of DcepProtocolTable_t for more protocols. */
+#if !defined( DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS )
+    #define DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS    64
+#endif
+
+/* The table is at most half full so that a perfect hash is quick to find. */
+#define DCEP_PROTOCOL_TABLE_MAX_SLOTS      ( 2 * DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS )
+#define DCEP_PROTOCOL_TABLE_MAX_BUCKETS    DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS
+
+/* Handler id of an empty slot, and of a protocol that is not in the table.
+ * It can not be registered. */
+#define DCEP_PROTOCOL_TABLE_NO_HANDLER     0xFFFF
+
+/* A subprotocol and the id of the handler that serves its channels. The
+ * empty protocol can be registered with a protocolLength of 0. */
+typedef struct DcepProtocolHandler
+{
+    const uint8_t * pProtocol;
+    uint16_t protocolLength;
+    uint16_t handlerId;
+} DcepProtocolHandler_t;
+
+/* Read-only map from protocol string to handler id.
+ *
+ * Dcep_ProtocolTableInit builds a perfect hash of the registered protocols
+ * (hash and displace): a protocol is hashed once, the hash picks a bucket,
+ * and the displacement of that bucket sends every protocol of the bucket to
+ * its own slot. A lookup therefore hashes the protocol and compares it with
+ * a single slot, however many protocols are registered. The table does not
+ * copy the protocol bytes; they must remain valid for as long as the table
+ * is used. */
+typedef struct DcepProtocolTable
+{
+    const uint8_t * pProtocols[ DCEP_PROTOCOL_TABLE_MAX_SLOTS ];
+    uint16_t protocolLengths[ DCEP_PROTOCOL_TABLE_MAX_SLOTS ];
+    uint16_t handlerIds[ DCEP_PROTOCOL_TABLE_MAX_SLOTS ];
+    uint16_t displacements[ DCEP_PROTOCOL_TABLE_MAX_BUCKETS ];
+    uint32_t seed;
+    uint32_t slotMask;
+    uint32_t bucketMask;
+} DcepProtocolTable_t;
+
+/*-----------------------------------------------------------*/
+
+/* Builds the table from numHandlers protocols. Returns
+ * DCEP_RESULT_ALREADY_EXISTS if a protocol is registered twice and
+ * DCEP_RESULT_OUT_OF_MEMORY in the unlikely case that no perfect hash is
+ * found. */
+DcepResult_t Dcep_ProtocolTableInit( DcepProtocolTable_t * pTable,
+                                     const DcepProtocolHandler_t * pHandlers,
+                                     size_t numHandlers );
+
+/* Returns DCEP_RESULT_NOT_FOUND if the protocol is not registered. */
+DcepResult_t Dcep_ProtocolTableLookup( const DcepProtocolTable_t * pTable,
+                                       const uint8_t * pProtocol,
+                                       size_t protocolLength,
+                                       uint16_t * pHandlerId );
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_PROTOCOL_TABLE_H */
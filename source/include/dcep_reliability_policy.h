@@ -0,0 +1,53 @@
+#ifndef DCEP_RELIABILITY_POLICY_H
+#define DCEP_RELIABILITY_POLICY_H
+
+/* Data types includes. */
+#include "dcep_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/* Partial reliability limits of one channel (RFC 8832 section 5.1, RFC 3758).
+ *
+ * Dcep_ReliabilityPolicyInit fills in the limit that the channel type uses
+ * from the reliability parameter of the DATA_CHANNEL_OPEN message and sets
+ * the other one to UINT32_MAX, which is never reached. Both limits are then
+ * checked for every channel type without branching on it. */
+typedef struct DcepReliabilityPolicy
+{
+    uint32_t maxRetransmissions;
+    uint32_t maxLifetimeInMilliseconds;
+} DcepReliabilityPolicy_t;
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_ReliabilityPolicyInit( DcepReliabilityPolicy_t * pPolicy,
+                                         const DcepChannelOpenMessage_t * pChannelOpenMessage );
+
+/* Returns 1 if a message that is due for retransmission is abandoned
+ * instead: it was first sent at sendTimeMs and has already been
+ * retransmitted numRetransmissions times. Times are in milliseconds on the
+ * caller's monotonic clock, which may wrap around. */
+static DCEP_INLINE uint32_t Dcep_ReliabilityPolicyShouldAbandon( const DcepReliabilityPolicy_t * pPolicy,
+                                                                 uint32_t sendTimeMs,
+                                                                 uint32_t numRetransmissions,
+                                                                 uint32_t currentTimeMs )
+{
+    return ( uint32_t ) ( numRetransmissions >= pPolicy->maxRetransmissions ) |
+           ( uint32_t ) ( ( currentTimeMs - sendTimeMs ) > pPolicy->maxLifetimeInMilliseconds );
+}
+
+/* Applies Dcep_ReliabilityPolicyShouldAbandon to numMessages outstanding
+ * messages of a channel, given as arrays of send times and retransmission
+ * counts. Sets pAbandoned[ i ] to 1 for the messages to abandon and 0 for
+ * the others, and writes their number to pNumAbandoned. */
+DcepResult_t Dcep_ReliabilityPolicySweep( const DcepReliabilityPolicy_t * pPolicy,
+                                          uint32_t currentTimeMs,
+                                          const uint32_t * pSendTimesMs,
+                                          const uint32_t * pNumRetransmissions,
+                                          size_t numMessages,
+                                          uint8_t * pAbandoned,
+                                          size_t * pNumAbandoned );
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_RELIABILITY_POLICY_H */
@@ -0,0 +1,67 @@
+#ifndef DCEP_SIMD_H
+#define DCEP_SIMD_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/*-----------------------------------------------------------*/
+
+/* Number of DCEP headers validated together by one header block kernel. */
+#define DCEP_HEADER_BLOCK_SIZE    16
+
+/* The x86 SSE4.1 and AVX2 kernels are built when the compiler supports
+ * per-function target attributes. They are selected at runtime based on the
+ * CPU features. Define DCEP_DISABLE_SIMD to build only the scalar kernel. */
+#if ( defined( __x86_64__ ) || defined( __i386__ ) ) && defined( __GNUC__ ) && !defined( DCEP_DISABLE_SIMD )
+    #define DCEP_SIMD_X86    1
+#endif
+
+/* Headers of up to DCEP_HEADER_BLOCK_SIZE DATA_CHANNEL_OPEN messages, stored
+ * one array per field so that each field can be processed with a few vector
+ * instructions.
+ *
+ * On input to a kernel, priority, reliabilityParameter, labelLength and
+ * protocolLength hold the raw network byte order values copied from the
+ * wire, and messageLength holds the total length of each message. On output,
+ * these fields are converted to host byte order. Unused slots must be zero. */
+typedef struct DcepHeaderBlock
+{
+    uint8_t messageType[ DCEP_HEADER_BLOCK_SIZE ];
+    uint8_t channelType[ DCEP_HEADER_BLOCK_SIZE ];
+    uint16_t priority[ DCEP_HEADER_BLOCK_SIZE ];
+    uint32_t reliabilityParameter[ DCEP_HEADER_BLOCK_SIZE ];
+    uint16_t labelLength[ DCEP_HEADER_BLOCK_SIZE ];
+    uint16_t protocolLength[ DCEP_HEADER_BLOCK_SIZE ];
+    uint32_t messageLength[ DCEP_HEADER_BLOCK_SIZE ];
+} DcepHeaderBlock_t;
+
+/* Header block kernel type.
+ *
+ * Converts the first numHeaders headers of the block to host byte order and
+ * returns a mask in which bit i is set if header i is a well-formed
+ * DATA_CHANNEL_OPEN header: the message type is DATA_CHANNEL_OPEN, the
+ * channel type is one of DcepChannelType_t and the label and protocol fit in
+ * the message. */
+typedef uint16_t ( * DcepValidateHeaderBlock_t ) ( DcepHeaderBlock_t * pBlock,
+                                                   size_t numHeaders );
+
+uint16_t Dcep_ValidateHeaderBlockScalar( DcepHeaderBlock_t * pBlock,
+                                         size_t numHeaders );
+
+#if defined( DCEP_SIMD_X86 )
+
+uint16_t Dcep_ValidateHeaderBlockSse41( DcepHeaderBlock_t * pBlock,
+                                        size_t numHeaders );
+
+uint16_t Dcep_ValidateHeaderBlockAvx2( DcepHeaderBlock_t * pBlock,
+                                       size_t numHeaders );
+
+#endif /* DCEP_SIMD_X86 */
+
+/* Returns the fastest header block kernel supported by the running CPU. */
+DcepValidateHeaderBlock_t Dcep_SelectValidateHeaderBlockFunction( void );
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_SIMD_H */
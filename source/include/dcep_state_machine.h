@@ -0,0 +1,52 @@
+#ifndef DCEP_STATE_MACHINE_H
+#define DCEP_STATE_MACHINE_H
+
+/* API includes. */
+#include "dcep_api.h"
+#include "dcep_channel_registry.h"
+
+/*-----------------------------------------------------------*/
+
+/* Outcome of Dcep_ProcessMessage. channelOpenMessage is only filled in for a
+ * DATA_CHANNEL_OPEN message; its label and protocol point into the processed
+ * message. */
+typedef struct DcepProcessedMessage
+{
+    DcepMessageType_t messageType;
+    DcepChannelState_t channelState;
+    DcepChannelOpenMessage_t channelOpenMessage;
+} DcepProcessedMessage_t;
+
+/*-----------------------------------------------------------*/
+
+/* Handshake state machine:
+ *
+ * Opening side                             Receiving side
+ * CLOSED --Dcep_OpenChannel--> OPENING     CLOSED --DATA_CHANNEL_OPEN--> OPEN
+ * OPENING --DATA_CHANNEL_ACK--> OPEN                (ACK written to output)
+ *
+ * Channels are registered in pRegistry. A DATA_CHANNEL_OPEN registers its
+ * label and protocol as views into the inbound message, so the message must
+ * remain valid for as long as those are read from the registry. */
+DcepResult_t Dcep_OpenChannel( DcepContext_t * pCtx,
+                               DcepChannelRegistry_t * pRegistry,
+                               uint16_t streamId,
+                               const DcepChannelOpenMessage_t * pChannelOpenMessage,
+                               uint8_t * pBuffer,
+                               size_t * pBufferLength );
+
+DcepResult_t Dcep_ProcessMessage( DcepContext_t * pCtx,
+                                  DcepChannelRegistry_t * pRegistry,
+                                  uint16_t streamId,
+                                  const uint8_t * pDcepMessage,
+                                  size_t dcepMessageLength,
+                                  uint8_t * pAckBuffer,
+                                  size_t * pAckBufferLength,
+                                  DcepProcessedMessage_t * pProcessedMessage );
+
+DcepResult_t Dcep_CloseChannel( DcepChannelRegistry_t * pRegistry,
+                                uint16_t streamId );
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_STATE_MACHINE_H */
@@ -0,0 +1,68 @@
+#ifndef DCEP_STREAM_ID_ALLOCATOR_H
+#define DCEP_STREAM_ID_ALLOCATOR_H
+
+/* Data types includes. */
+#include "dcep_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+#define DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD    32
+#define DCEP_STREAM_ID_ALLOCATOR_NUM_WORDS        ( 65536 / DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD )
+#define DCEP_STREAM_ID_ALLOCATOR_NUM_GROUPS       ( DCEP_STREAM_ID_ALLOCATOR_NUM_WORDS / DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD )
+#define DCEP_STREAM_ID_ALLOCATOR_NUM_GROUP_WORDS  ( DCEP_STREAM_ID_ALLOCATOR_NUM_GROUPS / DCEP_STREAM_ID_ALLOCATOR_BITS_PER_WORD )
+
+/* Stream id 65535 is reserved and is never allocated. */
+#define DCEP_STREAM_ID_RESERVED                   0xFFFF
+
+/* DTLS role of the local endpoint. The DTLS client uses even stream ids and
+ * the DTLS server uses odd stream ids for the channels it opens (RFC 8832
+ * section 6). */
+typedef enum DcepDtlsRole
+{
+    DCEP_DTLS_ROLE_CLIENT,
+    DCEP_DTLS_ROLE_SERVER
+} DcepDtlsRole_t;
+
+/* Stream id allocator of one SCTP association.
+ *
+ * Bit i of usedBits is set when stream id i is in use. Bit w of
+ * nonFullWords is set when word w of usedBits has a free bit of the local
+ * parity, and bit g of nonFullGroups is set when word g of nonFullWords is
+ * non-zero. Allocation takes the first such word at or after searchHint,
+ * the word of the most recent allocation or release, wrapping around. It
+ * finds it with at most one count of trailing zeros in nonFullWords and a
+ * scan of the two words of nonFullGroups, so allocation, release and the
+ * reservation of one word take O(1) time. freeCount is the number of free
+ * stream ids of the local parity. */
+typedef struct DcepStreamIdAllocator
+{
+    uint32_t usedBits[ DCEP_STREAM_ID_ALLOCATOR_NUM_WORDS ];
+    uint32_t nonFullWords[ DCEP_STREAM_ID_ALLOCATOR_NUM_GROUPS ];
+    uint32_t nonFullGroups[ DCEP_STREAM_ID_ALLOCATOR_NUM_GROUP_WORDS ];
+    uint32_t parityMask;
+    size_t searchHint;
+    size_t freeCount;
+} DcepStreamIdAllocator_t;
+
+/*-----------------------------------------------------------*/
+
+DcepResult_t Dcep_StreamIdAllocatorInit( DcepStreamIdAllocator_t * pAllocator,
+                                         DcepDtlsRole_t dtlsRole );
+
+DcepResult_t Dcep_StreamIdAllocatorAllocate( DcepStreamIdAllocator_t * pAllocator,
+                                             uint16_t * pStreamId );
+
+DcepResult_t Dcep_StreamIdAllocatorRelease( DcepStreamIdAllocator_t * pAllocator,
+                                            uint16_t streamId );
+
+/* Marks stream ids [ firstStreamId, firstStreamId + count ) as in use, for
+ * example the ids of channels opened by the peer or negotiated out of band.
+ * Ids of either parity can be reserved, and ids already in use are left
+ * as they are. */
+DcepResult_t Dcep_StreamIdAllocatorReserve( DcepStreamIdAllocator_t * pAllocator,
+                                            uint16_t firstStreamId,
+                                            size_t count );
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_STREAM_ID_ALLOCATOR_H */
@@ -0,0 +1,82 @@
+#ifndef DCEP_TIMER_WHEEL_H
+#define DCEP_TIMER_WHEEL_H
+
+/* Data types includes. */
+#include "dcep_data_types.h"
+
+/*-----------------------------------------------------------*/
+
+/* Each level has 2^DCEP_TIMER_WHEEL_SLOT_BITS slots of 64^level ticks, so
+ * four levels cover timeouts of up to 2^24 - 1 ticks. Longer timeouts are
+ * clamped. */
+#define DCEP_TIMER_WHEEL_SLOT_BITS       6
+#define DCEP_TIMER_WHEEL_SLOTS           ( 1U << DCEP_TIMER_WHEEL_SLOT_BITS )
+#define DCEP_TIMER_WHEEL_LEVELS          4
+#define DCEP_TIMER_WHEEL_BUCKETS         ( DCEP_TIMER_WHEEL_LEVELS * DCEP_TIMER_WHEEL_SLOTS )
+#define DCEP_TIMER_WHEEL_MAX_TIMEOUT     ( ( 1UL << ( DCEP_TIMER_WHEEL_LEVELS * DCEP_TIMER_WHEEL_SLOT_BITS ) ) - 1 )
+
+/* Stream id 65535 is reserved, so a wheel covers at most stream ids
+ * 0 - 65534. It also marks the end of a bucket list and an unarmed timer. */
+#define DCEP_TIMER_WHEEL_MAX_CAPACITY    65535
+#define DCEP_TIMER_WHEEL_NONE            0xFFFF
+
+/* Hierarchical timer wheel of DATA_CHANNEL_OPEN timeouts, one timer per
+ * stream id.
+ *
+ * Timers are linked into the bucket of the wheel that covers their expiry
+ * tick through the pNext and pPrev arrays, indexed by stream id, so arming
+ * and cancelling a timer is O(1). Timers of the higher levels are moved down
+ * a level each time the level below wraps around, and expire from level 0
+ * on the tick they were armed for. The wheel has no clock of its own:
+ * Dcep_TimerWheelAdvance is called with the current value of a monotonic
+ * tick counter chosen by the caller, for example milliseconds. All arrays are
+ * carved out of a single caller-provided buffer, aligned for a uint32_t,
+ * whose size is given by Dcep_TimerWheelGetMemorySize. */
+typedef struct DcepTimerWheel
+{
+    uint32_t * pExpiryTicks;
+    uint16_t * pNext;
+    uint16_t * pPrev;
+    uint16_t * pBuckets;
+    uint16_t heads[ DCEP_TIMER_WHEEL_BUCKETS ];
+    size_t capacity;
+    size_t count;
+    uint32_t currentTick;
+} DcepTimerWheel_t;
+
+/*-----------------------------------------------------------*/
+
+/* A wheel of the given capacity holds timers of stream ids below it. */
+DcepResult_t Dcep_TimerWheelGetMemorySize( size_t capacity,
+                                           size_t * pMemorySize );
+
+DcepResult_t Dcep_TimerWheelInit( DcepTimerWheel_t * pWheel,
+                                  void * pMemory,
+                                  size_t memorySize,
+                                  size_t capacity,
+                                  uint32_t currentTick );
+
+/* Arms the timer of streamId to expire timeoutTicks after the current tick,
+ * replacing the timer already armed for it, if any. A timer armed with a
+ * timeout of 0 expires on the next call to Dcep_TimerWheelAdvance. */
+DcepResult_t Dcep_TimerWheelArm( DcepTimerWheel_t * pWheel,
+                                 uint16_t streamId,
+                                 uint32_t timeoutTicks );
+
+/* Returns DCEP_RESULT_NOT_FOUND if no timer is armed for streamId. */
+DcepResult_t Dcep_TimerWheelCancel( DcepTimerWheel_t * pWheel,
+                                    uint16_t streamId );
+
+/* Advances the wheel to currentTick and writes the stream ids of the timers
+ * that expired to pExpiredStreamIds. At most maxExpired timers expire per
+ * call; when *pNumExpired is maxExpired, the wheel may stop short of
+ * currentTick and the caller calls again for the rest. */
+DcepResult_t Dcep_TimerWheelAdvance( DcepTimerWheel_t * pWheel,
+                                     uint32_t currentTick,
+                                     uint16_t * pExpiredStreamIds,
+                                     size_t maxExpired,
+                                     size_t * pNumExpired );
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_TIMER_WHEEL_H */
@@ -0,0 +1,69 @@
+#ifndef DCEP_UTF8_H
+#define DCEP_UTF8_H
+
+/* Standard includes. */
+#include <stdint.h>
+#include <stddef.h>
+
+/*-----------------------------------------------------------*/
+
+/* The AArch64 kernel uses NEON, which every AArch64 CPU has, so it is not
+ * selected at runtime. The x86 kernels follow DCEP_SIMD_X86 from dcep_simd.h.
+ * Define DCEP_DISABLE_SIMD to build only the scalar kernel. */
+#if defined( __aarch64__ ) && defined( __GNUC__ ) && !defined( DCEP_DISABLE_SIMD )
+    #define DCEP_SIMD_NEON    1
+#endif
+
+/* States of the UTF-8 validator. A validator returns DCEP_UTF8_ACCEPT when the
+ * input ends on a character boundary, DCEP_UTF8_REJECT as soon as the input
+ * is not UTF-8 and any other value in the middle of a multi-byte character. */
+#define DCEP_UTF8_ACCEPT    0U
+#define DCEP_UTF8_REJECT    1U
+
+/* UTF-8 validator type.
+ *
+ * Validates length bytes that follow input that left the validator in state
+ * and returns the new state. Pass DCEP_UTF8_ACCEPT for the start of the
+ * input; a buffer is valid UTF-8 (RFC 3629) if validating all of it returns
+ * DCEP_UTF8_ACCEPT. Overlong encodings, surrogates and code points above
+ * U+10FFFF are rejected. The input can be validated in any number of pieces,
+ * for example as it arrives in chunks. */
+typedef uint32_t ( * DcepValidateUtf8_t ) ( uint32_t state,
+                                            const uint8_t * pData,
+                                            size_t length );
+
+uint32_t Dcep_ValidateUtf8Scalar( uint32_t state,
+                                  const uint8_t * pData,
+                                  size_t length );
+
+/* The vector kernels check every pair of adjacent bytes for the errors that
+ * the lead byte allows with a few table lookups, a whole vector at a time,
+ * whether or not the input is ASCII. The scalar kernel only validates the
+ * bytes that finish a character left open by the previous piece and the
+ * last partial vector. */
+#if defined( DCEP_SIMD_X86 )
+
+uint32_t Dcep_ValidateUtf8Ssse3( uint32_t state,
+                                 const uint8_t * pData,
+                                 size_t length );
+
+uint32_t Dcep_ValidateUtf8Avx2( uint32_t state,
+                                const uint8_t * pData,
+                                size_t length );
+
+#endif /* DCEP_SIMD_X86 */
+
+#if defined( DCEP_SIMD_NEON )
+
+uint32_t Dcep_ValidateUtf8Neon( uint32_t state,
+                                const uint8_t * pData,
+                                size_t length );
+
+#endif /* DCEP_SIMD_NEON */
+
+/* Returns the fastest UTF-8 validator supported by the running CPU. */
+DcepValidateUtf8_t Dcep_SelectValidateUtf8Function( void );
+
+/*-----------------------------------------------------------*/
+
+#endif /* DCEP_UTF8_H */
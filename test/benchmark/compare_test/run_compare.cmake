@@ -0,0 +1,21 @@
+# Runs dcep_instruction_count_compare and checks its exit code and output.
+#
+# Usage: cmake -DCOMPARE=<tool> -DBASELINE=<csv> -DCURRENT=<csv> -DTHRESHOLD=<percent>
+#              -DEXPECT_FAILURE=<ON|OFF> -DEXPECT_OUTPUT=<regex> -P run_compare.cmake
+
+execute_process( COMMAND ${COMPARE} ${BASELINE} ${CURRENT} ${THRESHOLD}
+                 RESULT_VARIABLE result
+                 OUTPUT_VARIABLE output
+                 ERROR_VARIABLE output )
+
+message( "${output}" )
+
+if( EXPECT_FAILURE AND ( result EQUAL 0 ) )
+    message( FATAL_ERROR "Expected dcep_instruction_count_compare to fail." )
+elseif( NOT EXPECT_FAILURE AND NOT ( result EQUAL 0 ) )
+    message( FATAL_ERROR "Expected dcep_instruction_count_compare to succeed, got ${result}." )
+endif()
+
+if( NOT output MATCHES "${EXPECT_OUTPUT}" )
+    message( FATAL_ERROR "Output does not match \"${EXPECT_OUTPUT}\"." )
+endif()
@@ -0,0 +1,1002 @@
+/* Needed for clock_gettime. */
+#define _POSIX_C_SOURCE    199309L
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <time.h>
+
+/* API includes. */
+#include "dcep_api.h"
+#include "dcep_channel_registry.h"
+#include "dcep_timer_wheel.h"
+#include "dcep_reliability_policy.h"
+
+/*-----------------------------------------------------------*/
+
+/* Each benchmark is run with a doubling number of iterations until one run
+ * takes at least this long. */
+#define DEFAULT_MIN_TIME_MS    100
+
+#define MAX_FIELD_LENGTH       1024
+#define MAX_MESSAGE_LENGTH     ( DCEP_HEADER_LENGTH + ( 2 * MAX_FIELD_LENGTH ) )
+
+/* Mixed traffic cycles through this many messages of random channel types,
+ * too many for the branch predictor to learn the sequence. */
+#define MIXED_MESSAGE_COUNT    4096
+#define MIXED_FIELD_LENGTH     16
+#define MIXED_MESSAGE_LENGTH   ( DCEP_HEADER_LENGTH + ( 2 * MIXED_FIELD_LENGTH ) )
+
+/* Routed traffic cycles through messages whose protocol is one of this many
+ * registered protocols, picked at random. */
+#define ROUTED_PROTOCOL_COUNT  32
+
+/* Label lookups pick one of this many registered channels at random, in a
+ * registry of twice the capacity. */
+#define LABELED_CHANNEL_COUNT  4096
+#define LABELED_CAPACITY       ( 2 * LABELED_CHANNEL_COUNT )
+
+/* The timer benchmarks keep this many OPEN timeouts pending. */
+#define PENDING_TIMER_COUNT    4096
+#define PENDING_TIMER_TIMEOUT  5000
+
+/* The reliability benchmarks decide for this many outstanding messages. */
+#define OUTSTANDING_MESSAGE_COUNT    1024
+
+/* Number of ACKs written per run by the ACK batch benchmarks. */
+#define ACK_BATCH_LENGTH       64
+
+/* U+1F600, U+20AC and 'l', repeated to fill the non-ASCII label. Every field
+ * length is a multiple of its length, so every label is valid UTF-8. */
+#define NON_ASCII_PATTERN           "\xF0\x9F\x98\x80\xE2\x82\xACl"
+#define NON_ASCII_PATTERN_LENGTH    8
+
+#define ARRAY_LENGTH( array )    ( sizeof( array ) / sizeof( ( array )[ 0 ] ) )
+
+typedef struct BenchmarkState
+{
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage;
+    uint8_t channelName[ MAX_FIELD_LENGTH ];
+    /* A label of the same length with characters of one, three and four
+     * bytes. */
+    uint8_t nonAsciiChannelName[ MAX_FIELD_LENGTH ];
+    uint8_t protocol[ MAX_FIELD_LENGTH ];
+    uint8_t serializedMessage[ MAX_MESSAGE_LENGTH ];
+    size_t serializedMessageLength;
+    uint8_t outputBuffer[ MAX_MESSAGE_LENGTH ];
+    DcepChannelOpenMessage_t mixedChannelOpenMessages[ MIXED_MESSAGE_COUNT ];
+    uint8_t mixedMessages[ MIXED_MESSAGE_COUNT ][ MIXED_MESSAGE_LENGTH ];
+    size_t mixedIndex;
+    uint8_t routedProtocols[ ROUTED_PROTOCOL_COUNT ][ MIXED_FIELD_LENGTH + 1 ];
+    DcepProtocolHandler_t protocolHandlers[ ROUTED_PROTOCOL_COUNT ];
+    DcepProtocolTable_t protocolTable;
+    uint16_t ackStreamIds[ ACK_BATCH_LENGTH ];
+    DcepAckBatchEntry_t ackEntries[ ACK_BATCH_LENGTH ];
+    uint8_t labels[ LABELED_CHANNEL_COUNT ][ MIXED_FIELD_LENGTH + 1 ];
+    /* Sized with the Dcep_*GetMemorySize functions by AllocateMemory. */
+    void * pRegistryMemory;
+    void * pIndexedRegistryMemory;
+    void * pLabelIndexMemory;
+    void * pTimerWheelMemory;
+    size_t registryMemorySize;
+    size_t labelIndexMemorySize;
+    size_t timerWheelMemorySize;
+    DcepChannelRegistry_t registry;
+    DcepChannelRegistry_t indexedRegistry;
+    DcepTimerWheel_t timerWheel;
+    uint16_t expiredStreamIds[ PENDING_TIMER_COUNT ];
+    DcepReliabilityPolicy_t reliabilityPolicy;
+    uint32_t sendTimesMs[ OUTSTANDING_MESSAGE_COUNT ];
+    uint32_t numRetransmissions[ OUTSTANDING_MESSAGE_COUNT ];
+    uint8_t abandoned[ OUTSTANDING_MESSAGE_COUNT ];
+} BenchmarkState_t;
+
+typedef enum BenchmarkInput
+{
+    BENCHMARK_INPUT_NONE,
+    /* Every channel type and field length, one at a time. */
+    BENCHMARK_INPUT_CHANNEL_OPEN,
+    /* Messages of random channel types. */
+    BENCHMARK_INPUT_MIXED_CHANNEL_OPEN,
+    /* Messages with one of the registered protocols at random. */
+    BENCHMARK_INPUT_ROUTED_CHANNEL_OPEN,
+    /* Registries of many channels with distinct labels. */
+    BENCHMARK_INPUT_LABELED_CHANNELS,
+    /* A timer wheel with many pending timers. */
+    BENCHMARK_INPUT_PENDING_TIMERS,
+    /* Outstanding messages of a partial reliable timed channel. */
+    BENCHMARK_INPUT_OUTSTANDING_MESSAGES
+} BenchmarkInput_t;
+
+/* Runs the operation under test once and returns a value derived from its
+ * output so that the compiler cannot drop the call. */
+typedef size_t ( * BenchmarkFunction_t ) ( BenchmarkState_t * pState );
+
+typedef struct Benchmark
+{
+    const char * pName;
+    BenchmarkFunction_t benchmarkFn;
+    BenchmarkInput_t input;
+} Benchmark_t;
+
+typedef struct FieldLengths
+{
+    uint16_t channelNameLength;
+    uint16_t protocolLength;
+} FieldLengths_t;
+
+/*-----------------------------------------------------------*/
+
+static BenchmarkState_t benchmarkState;
+static volatile size_t benchmarkSink;
+
+static const DcepChannelType_t channelTypes[] =
+{
+    DCEP_DATA_CHANNEL_RELIABLE,
+    DCEP_DATA_CHANNEL_RELIABLE_UNORDERED,
+    DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT,
+    DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED,
+    DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED,
+    DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED
+};
+
+static const FieldLengths_t fieldLengths[] =
+{
+    { 0,    0    },
+    { 8,    0    },
+    { 16,   16   },
+    { 64,   32   },
+    { 256,  256  },
+    { 1024, 1024 }
+};
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkSerializeChannelOpenMessage( BenchmarkState_t * pState )
+{
+    size_t bufferLength = sizeof( pState->outputBuffer );
+
+    ( void ) Dcep_SerializeChannelOpenMessage( &( pState->ctx ),
+                                               &( pState->channelOpenMessage ),
+                                               &( pState->outputBuffer[ 0 ] ),
+                                               &( bufferLength ) );
+
+    return bufferLength + pState->outputBuffer[ 1 ];
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkDeserializeChannelOpenMessage( BenchmarkState_t * pState )
+{
+    DcepChannelOpenMessage_t channelOpenMessage;
+
+    ( void ) Dcep_DeserializeChannelOpenMessage( &( pState->ctx ),
+                                                 &( pState->serializedMessage[ 0 ] ),
+                                                 pState->serializedMessageLength,
+                                                 &( channelOpenMessage ) );
+
+    return ( size_t ) channelOpenMessage.priority + channelOpenMessage.protocolLength;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkChannelOpenViewLabel( BenchmarkState_t * pState )
+{
+    DcepChannelOpenView_t view;
+    const uint8_t * pChannelName = NULL;
+    uint16_t channelNameLength = 0;
+
+    if( Dcep_InitChannelOpenView( &( pState->ctx ),
+                                  &( pState->serializedMessage[ 0 ] ),
+                                  pState->serializedMessageLength,
+                                  &( view ) ) == DCEP_RESULT_OK )
+    {
+        pChannelName = Dcep_ChannelOpenViewGetChannelName( &( view ), &( channelNameLength ) );
+    }
+
+    return ( size_t ) ( pChannelName != NULL ) + channelNameLength;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkGetMessageType( BenchmarkState_t * pState )
+{
+    DcepMessageType_t messageType;
+
+    ( void ) Dcep_GetMessageType( &( pState->ctx ),
+                                  &( pState->serializedMessage[ 0 ] ),
+                                  pState->serializedMessageLength,
+                                  &( messageType ) );
+
+    return ( size_t ) messageType;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkSerializeChannelAckMessage( BenchmarkState_t * pState )
+{
+    size_t bufferLength = sizeof( pState->outputBuffer );
+
+    ( void ) Dcep_SerializeChannelAckMessage( &( pState->ctx ),
+                                              &( pState->outputBuffer[ 0 ] ),
+                                              &( bufferLength ) );
+
+    return bufferLength + pState->outputBuffer[ 0 ];
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkSerializeChannelAckLoop( BenchmarkState_t * pState )
+{
+    size_t bufferLength, totalLength = 0;
+    size_t i;
+
+    for( i = 0; i < ACK_BATCH_LENGTH; i++ )
+    {
+        bufferLength = sizeof( pState->outputBuffer ) - totalLength;
+
+        ( void ) Dcep_SerializeChannelAckMessage( &( pState->ctx ),
+                                                  &( pState->outputBuffer[ totalLength ] ),
+                                                  &( bufferLength ) );
+
+        totalLength += bufferLength;
+    }
+
+    return totalLength + pState->outputBuffer[ 0 ];
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkSerializeChannelAckBatch( BenchmarkState_t * pState )
+{
+    size_t bufferLength = sizeof( pState->outputBuffer );
+
+    ( void ) Dcep_SerializeChannelAckBatch( &( pState->ctx ),
+                                            &( pState->ackStreamIds[ 0 ] ),
+                                            ACK_BATCH_LENGTH,
+                                            &( pState->outputBuffer[ 0 ] ),
+                                            &( bufferLength ),
+                                            &( pState->ackEntries[ 0 ] ) );
+
+    return bufferLength + pState->ackEntries[ ACK_BATCH_LENGTH - 1 ].streamId;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkSerializeMixedChannelOpenMessage( BenchmarkState_t * pState )
+{
+    size_t bufferLength = sizeof( pState->outputBuffer );
+    size_t index = pState->mixedIndex++ % MIXED_MESSAGE_COUNT;
+
+    ( void ) Dcep_SerializeChannelOpenMessage( &( pState->ctx ),
+                                               &( pState->mixedChannelOpenMessages[ index ] ),
+                                               &( pState->outputBuffer[ 0 ] ),
+                                               &( bufferLength ) );
+
+    return bufferLength + pState->outputBuffer[ 7 ];
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkDeserializeMixedChannelOpenMessage( BenchmarkState_t * pState )
+{
+    DcepChannelOpenMessage_t channelOpenMessage;
+    size_t index = pState->mixedIndex++ % MIXED_MESSAGE_COUNT;
+
+    ( void ) Dcep_DeserializeChannelOpenMessage( &( pState->ctx ),
+                                                 &( pState->mixedMessages[ index ][ 0 ] ),
+                                                 MIXED_MESSAGE_LENGTH,
+                                                 &( channelOpenMessage ) );
+
+    return ( size_t ) channelOpenMessage.numRetransmissions + channelOpenMessage.maxLifetimeInMilliseconds;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkValidateUtf8Scalar( BenchmarkState_t * pState )
+{
+    return ( size_t ) Dcep_ValidateUtf8Scalar( DCEP_UTF8_ACCEPT,
+                                               &( pState->channelName[ 0 ] ),
+                                               pState->channelOpenMessage.channelNameLength );
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkValidateUtf8( BenchmarkState_t * pState )
+{
+    return ( size_t ) pState->ctx.validateUtf8Fn( DCEP_UTF8_ACCEPT,
+                                                  &( pState->channelName[ 0 ] ),
+                                                  pState->channelOpenMessage.channelNameLength );
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkValidateUtf8ScalarNonAscii( BenchmarkState_t * pState )
+{
+    return ( size_t ) Dcep_ValidateUtf8Scalar( DCEP_UTF8_ACCEPT,
+                                               &( pState->nonAsciiChannelName[ 0 ] ),
+                                               pState->channelOpenMessage.channelNameLength );
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkValidateUtf8NonAscii( BenchmarkState_t * pState )
+{
+    return ( size_t ) pState->ctx.validateUtf8Fn( DCEP_UTF8_ACCEPT,
+                                                  &( pState->nonAsciiChannelName[ 0 ] ),
+                                                  pState->channelOpenMessage.channelNameLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/* What an application does without a protocol table: compare the protocol
+ * with every registered one in turn. */
+static size_t BenchmarkRouteChannelOpenCompare( BenchmarkState_t * pState )
+{
+    DcepChannelOpenMessage_t channelOpenMessage;
+    size_t index = pState->mixedIndex++ % MIXED_MESSAGE_COUNT;
+    size_t handlerId = DCEP_PROTOCOL_TABLE_NO_HANDLER;
+    size_t i;
+
+    if( Dcep_DeserializeChannelOpenMessage( &( pState->ctx ),
+                                            &( pState->mixedMessages[ index ][ 0 ] ),
+                                            MIXED_MESSAGE_LENGTH,
+                                            &( channelOpenMessage ) ) == DCEP_RESULT_OK )
+    {
+        for( i = 0; i < ROUTED_PROTOCOL_COUNT; i++ )
+        {
+            if( ( channelOpenMessage.protocolLength == pState->protocolHandlers[ i ].protocolLength ) &&
+                ( memcmp( channelOpenMessage.pProtocol,
+                          pState->protocolHandlers[ i ].pProtocol,
+                          channelOpenMessage.protocolLength ) == 0 ) )
+            {
+                handlerId = pState->protocolHandlers[ i ].handlerId;
+                break;
+            }
+        }
+    }
+
+    return handlerId;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkRouteChannelOpenTable( BenchmarkState_t * pState )
+{
+    DcepChannelOpenMessage_t channelOpenMessage;
+    size_t index = pState->mixedIndex++ % MIXED_MESSAGE_COUNT;
+    uint16_t handlerId = DCEP_PROTOCOL_TABLE_NO_HANDLER;
+
+    ( void ) Dcep_DeserializeAndRouteChannelOpenMessage( &( pState->ctx ),
+                                                         &( pState->protocolTable ),
+                                                         &( pState->mixedMessages[ index ][ 0 ] ),
+                                                         MIXED_MESSAGE_LENGTH,
+                                                         &( channelOpenMessage ),
+                                                         &( handlerId ) );
+
+    return handlerId;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkFindChannelByLabel( const DcepChannelRegistry_t * pRegistry,
+                                          BenchmarkState_t * pState )
+{
+    size_t index = ( pState->mixedIndex++ * 2654435761U ) % LABELED_CHANNEL_COUNT;
+    uint16_t streamId = DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID;
+
+    ( void ) Dcep_ChannelRegistryFindByLabel( pRegistry,
+                                              &( pState->labels[ index ][ 0 ] ),
+                                              MIXED_FIELD_LENGTH,
+                                              &( streamId ) );
+
+    return streamId;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkFindChannelByLabelScan( BenchmarkState_t * pState )
+{
+    return BenchmarkFindChannelByLabel( &( pState->registry ), pState );
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkFindChannelByLabelIndex( BenchmarkState_t * pState )
+{
+    return BenchmarkFindChannelByLabel( &( pState->indexedRegistry ), pState );
+}
+
+/*-----------------------------------------------------------*/
+
+/* Re-arms the timer of one channel, as when its OPEN is retransmitted, and
+ * cancels the timer of another, as when its ACK arrives. */
+static size_t BenchmarkTimerWheelArmCancel( BenchmarkState_t * pState )
+{
+    uint16_t streamId = ( uint16_t ) ( pState->mixedIndex++ % PENDING_TIMER_COUNT );
+
+    ( void ) Dcep_TimerWheelArm( &( pState->timerWheel ), streamId, PENDING_TIMER_TIMEOUT );
+    ( void ) Dcep_TimerWheelCancel( &( pState->timerWheel ),
+                                    ( uint16_t ) ( ( streamId + ( PENDING_TIMER_COUNT / 2 ) ) % PENDING_TIMER_COUNT ) );
+
+    return pState->timerWheel.count;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Advances one tick and re-arms the timers that expired, so that timers keep
+ * expiring at a steady rate. */
+static size_t BenchmarkTimerWheelAdvance( BenchmarkState_t * pState )
+{
+    size_t numExpired = 0, i;
+
+    ( void ) Dcep_TimerWheelAdvance( &( pState->timerWheel ),
+                                     pState->timerWheel.currentTick + 1U,
+                                     &( pState->expiredStreamIds[ 0 ] ),
+                                     PENDING_TIMER_COUNT,
+                                     &( numExpired ) );
+
+    for( i = 0; i < numExpired; i++ )
+    {
+        ( void ) Dcep_TimerWheelArm( &( pState->timerWheel ),
+                                     pState->expiredStreamIds[ i ],
+                                     PENDING_TIMER_TIMEOUT );
+    }
+
+    return numExpired;
+}
+
+/*-----------------------------------------------------------*/
+
+/* One decision per message, as an application checks each message when its
+ * retransmission timer fires. */
+static size_t BenchmarkReliabilityCheckLoop( BenchmarkState_t * pState )
+{
+    size_t numAbandoned = 0, i;
+
+    for( i = 0; i < OUTSTANDING_MESSAGE_COUNT; i++ )
+    {
+        if( Dcep_ReliabilityPolicyShouldAbandon( &( pState->reliabilityPolicy ),
+                                                 pState->sendTimesMs[ i ],
+                                                 pState->numRetransmissions[ i ],
+                                                 OUTSTANDING_MESSAGE_COUNT ) != 0U )
+        {
+            pState->abandoned[ i ] = 1;
+            numAbandoned++;
+        }
+        else
+        {
+            pState->abandoned[ i ] = 0;
+        }
+    }
+
+    return numAbandoned;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkReliabilitySweep( BenchmarkState_t * pState )
+{
+    size_t numAbandoned = 0;
+
+    ( void ) Dcep_ReliabilityPolicySweep( &( pState->reliabilityPolicy ),
+                                          OUTSTANDING_MESSAGE_COUNT,
+                                          &( pState->sendTimesMs[ 0 ] ),
+                                          &( pState->numRetransmissions[ 0 ] ),
+                                          OUTSTANDING_MESSAGE_COUNT,
+                                          &( pState->abandoned[ 0 ] ),
+                                          &( numAbandoned ) );
+
+    return numAbandoned;
+}
+
+/*-----------------------------------------------------------*/
+
+static size_t BenchmarkClassifyPayload( BenchmarkState_t * pState )
+{
+    return ( size_t ) Dcep_ClassifyPayload( DCEP_PPID_DCEP,
+                                            &( pState->serializedMessage[ 0 ] ),
+                                            pState->serializedMessageLength );
+}
+
+/*-----------------------------------------------------------*/
+
+static const Benchmark_t benchmarks[] =
+{
+    { "serialize_channel_open",           BenchmarkSerializeChannelOpenMessage,        BENCHMARK_INPUT_CHANNEL_OPEN         },
+    { "deserialize_channel_open",         BenchmarkDeserializeChannelOpenMessage,      BENCHMARK_INPUT_CHANNEL_OPEN         },
+    { "serialize_channel_open_mixed",     BenchmarkSerializeMixedChannelOpenMessage,   BENCHMARK_INPUT_MIXED_CHANNEL_OPEN   },
+    { "deserialize_channel_open_mixed",   BenchmarkDeserializeMixedChannelOpenMessage, BENCHMARK_INPUT_MIXED_CHANNEL_OPEN   },
+    { "channel_open_view_label",          BenchmarkChannelOpenViewLabel,               BENCHMARK_INPUT_CHANNEL_OPEN         },
+    { "get_message_type",                 BenchmarkGetMessageType,                     BENCHMARK_INPUT_CHANNEL_OPEN         },
+    { "serialize_channel_ack",            BenchmarkSerializeChannelAckMessage,         BENCHMARK_INPUT_NONE                 },
+    { "serialize_channel_ack_loop_64",    BenchmarkSerializeChannelAckLoop,            BENCHMARK_INPUT_NONE                 },
+    { "serialize_channel_ack_batch_64",   BenchmarkSerializeChannelAckBatch,           BENCHMARK_INPUT_NONE                 },
+    { "validate_utf8_scalar",             BenchmarkValidateUtf8Scalar,                 BENCHMARK_INPUT_CHANNEL_OPEN         },
+    { "validate_utf8",                    BenchmarkValidateUtf8,                       BENCHMARK_INPUT_CHANNEL_OPEN         },
+    { "validate_utf8_scalar_non_ascii",   BenchmarkValidateUtf8ScalarNonAscii,         BENCHMARK_INPUT_CHANNEL_OPEN         },
+    { "validate_utf8_non_ascii",          BenchmarkValidateUtf8NonAscii,               BENCHMARK_INPUT_CHANNEL_OPEN         },
+    { "route_channel_open_compare_32",    BenchmarkRouteChannelOpenCompare,            BENCHMARK_INPUT_ROUTED_CHANNEL_OPEN  },
+    { "route_channel_open_table_32",      BenchmarkRouteChannelOpenTable,              BENCHMARK_INPUT_ROUTED_CHANNEL_OPEN  },
+    { "find_channel_by_label_scan_4096",  BenchmarkFindChannelByLabelScan,             BENCHMARK_INPUT_LABELED_CHANNELS     },
+    { "find_channel_by_label_index_4096", BenchmarkFindChannelByLabelIndex,            BENCHMARK_INPUT_LABELED_CHANNELS     },
+    { "timer_wheel_arm_cancel_4096",      BenchmarkTimerWheelArmCancel,                BENCHMARK_INPUT_PENDING_TIMERS       },
+    { "timer_wheel_advance_4096",         BenchmarkTimerWheelAdvance,                  BENCHMARK_INPUT_PENDING_TIMERS       },
+    { "reliability_check_loop_1024",      BenchmarkReliabilityCheckLoop,               BENCHMARK_INPUT_OUTSTANDING_MESSAGES },
+    { "reliability_sweep_1024",           BenchmarkReliabilitySweep,                   BENCHMARK_INPUT_OUTSTANDING_MESSAGES },
+    { "classify_payload",                 BenchmarkClassifyPayload,                    BENCHMARK_INPUT_NONE                 }
+};
+
+/*-----------------------------------------------------------*/
+
+static uint64_t GetTimeNs( void )
+{
+    struct timespec now;
+
+    ( void ) clock_gettime( CLOCK_MONOTONIC, &( now ) );
+
+    return ( ( uint64_t ) now.tv_sec * 1000000000ULL ) + ( uint64_t ) now.tv_nsec;
+}
+
+/*-----------------------------------------------------------*/
+
+static void PrepareState( BenchmarkState_t * pState,
+                          DcepChannelType_t channelType,
+                          const FieldLengths_t * pFieldLengths )
+{
+    memset( &( pState->channelOpenMessage ), 0, sizeof( pState->channelOpenMessage ) );
+
+    pState->channelOpenMessage.channelType = channelType;
+    pState->channelOpenMessage.priority = 256;
+    pState->channelOpenMessage.numRetransmissions = 5;
+    pState->channelOpenMessage.maxLifetimeInMilliseconds = 3000;
+    pState->channelOpenMessage.pChannelName = &( pState->channelName[ 0 ] );
+    pState->channelOpenMessage.channelNameLength = pFieldLengths->channelNameLength;
+    pState->channelOpenMessage.pProtocol = &( pState->protocol[ 0 ] );
+    pState->channelOpenMessage.protocolLength = pFieldLengths->protocolLength;
+
+    pState->serializedMessageLength = sizeof( pState->serializedMessage );
+
+    if( Dcep_SerializeChannelOpenMessage( &( pState->ctx ),
+                                          &( pState->channelOpenMessage ),
+                                          &( pState->serializedMessage[ 0 ] ),
+                                          &( pState->serializedMessageLength ) ) != DCEP_RESULT_OK )
+    {
+        fprintf( stderr, "Failed to serialize the benchmark input.\n" );
+        exit( EXIT_FAILURE );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void PrepareMixedState( BenchmarkState_t * pState )
+{
+    static const FieldLengths_t mixedFieldLengths = { MIXED_FIELD_LENGTH, MIXED_FIELD_LENGTH };
+    uint32_t random = 1;
+    size_t i;
+
+    PrepareState( pState, DCEP_DATA_CHANNEL_RELIABLE, &( mixedFieldLengths ) );
+
+    for( i = 0; i < MIXED_MESSAGE_COUNT; i++ )
+    {
+        /* Fixed seed so that every run sees the same sequence. */
+        random = ( random * 1103515245U ) + 12345U;
+
+        pState->mixedChannelOpenMessages[ i ] = pState->channelOpenMessage;
+        pState->mixedChannelOpenMessages[ i ].channelType = channelTypes[ ( random >> 16 ) % ARRAY_LENGTH( channelTypes ) ];
+        pState->mixedChannelOpenMessages[ i ].numRetransmissions = random & 0xFF;
+        pState->mixedChannelOpenMessages[ i ].maxLifetimeInMilliseconds = random & 0xFFFF;
+
+        pState->serializedMessageLength = MIXED_MESSAGE_LENGTH;
+
+        if( Dcep_SerializeChannelOpenMessage( &( pState->ctx ),
+                                              &( pState->mixedChannelOpenMessages[ i ] ),
+                                              &( pState->mixedMessages[ i ][ 0 ] ),
+                                              &( pState->serializedMessageLength ) ) != DCEP_RESULT_OK )
+        {
+            fprintf( stderr, "Failed to serialize the benchmark input.\n" );
+            exit( EXIT_FAILURE );
+        }
+    }
+
+    pState->mixedIndex = 0;
+}
+
+/*-----------------------------------------------------------*/
+
+static void PrepareRoutedState( BenchmarkState_t * pState )
+{
+    uint32_t random = 1;
+    size_t i;
+
+    PrepareMixedState( pState );
+
+    for( i = 0; i < ROUTED_PROTOCOL_COUNT; i++ )
+    {
+        snprintf( ( char * ) &( pState->routedProtocols[ i ][ 0 ] ),
+                  sizeof( pState->routedProtocols[ i ] ),
+                  "subprotocol.%04u",
+                  ( unsigned int ) i );
+
+        pState->protocolHandlers[ i ].pProtocol = &( pState->routedProtocols[ i ][ 0 ] );
+        pState->protocolHandlers[ i ].protocolLength = MIXED_FIELD_LENGTH;
+        pState->protocolHandlers[ i ].handlerId = ( uint16_t ) i;
+    }
+
+    if( Dcep_ProtocolTableInit( &( pState->protocolTable ),
+                                &( pState->protocolHandlers[ 0 ] ),
+                                ROUTED_PROTOCOL_COUNT ) != DCEP_RESULT_OK )
+    {
+        fprintf( stderr, "Failed to build the protocol table.\n" );
+        exit( EXIT_FAILURE );
+    }
+
+    /* The protocol is the last field of every message. */
+    for( i = 0; i < MIXED_MESSAGE_COUNT; i++ )
+    {
+        random = ( random * 1103515245U ) + 12345U;
+
+        memcpy( &( pState->mixedMessages[ i ][ MIXED_MESSAGE_LENGTH - MIXED_FIELD_LENGTH ] ),
+                &( pState->routedProtocols[ ( random >> 16 ) % ROUTED_PROTOCOL_COUNT ][ 0 ] ),
+                MIXED_FIELD_LENGTH );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/* Allocates the caller-provided memory of the registries and the timer
+ * wheel, so that the sizes follow the layout of the library structures. */
+static void AllocateMemory( BenchmarkState_t * pState )
+{
+    DcepResult_t result;
+
+    result = Dcep_ChannelRegistryGetMemorySize( LABELED_CAPACITY, &( pState->registryMemorySize ) );
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = Dcep_ChannelRegistryGetLabelIndexMemorySize( LABELED_CAPACITY, &( pState->labelIndexMemorySize ) );
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = Dcep_TimerWheelGetMemorySize( PENDING_TIMER_COUNT, &( pState->timerWheelMemorySize ) );
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        pState->pRegistryMemory = malloc( pState->registryMemorySize );
+        pState->pIndexedRegistryMemory = malloc( pState->registryMemorySize );
+        pState->pLabelIndexMemory = malloc( pState->labelIndexMemorySize );
+        pState->pTimerWheelMemory = malloc( pState->timerWheelMemorySize );
+    }
+
+    if( ( result != DCEP_RESULT_OK ) ||
+        ( pState->pRegistryMemory == NULL ) ||
+        ( pState->pIndexedRegistryMemory == NULL ) ||
+        ( pState->pLabelIndexMemory == NULL ) ||
+        ( pState->pTimerWheelMemory == NULL ) )
+    {
+        fprintf( stderr, "Failed to allocate the benchmark memory.\n" );
+        exit( EXIT_FAILURE );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void FreeMemory( BenchmarkState_t * pState )
+{
+    free( pState->pRegistryMemory );
+    free( pState->pIndexedRegistryMemory );
+    free( pState->pLabelIndexMemory );
+    free( pState->pTimerWheelMemory );
+}
+
+/*-----------------------------------------------------------*/
+
+static void PrepareLabeledState( BenchmarkState_t * pState )
+{
+    static const FieldLengths_t labeledFieldLengths = { MIXED_FIELD_LENGTH, 0 };
+    DcepResult_t result;
+    size_t i;
+
+    PrepareState( pState, DCEP_DATA_CHANNEL_RELIABLE, &( labeledFieldLengths ) );
+
+    result = Dcep_ChannelRegistryInit( &( pState->registry ),
+                                       pState->pRegistryMemory,
+                                       pState->registryMemorySize,
+                                       LABELED_CAPACITY );
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = Dcep_ChannelRegistryInit( &( pState->indexedRegistry ),
+                                           pState->pIndexedRegistryMemory,
+                                           pState->registryMemorySize,
+                                           LABELED_CAPACITY );
+    }
+
+    if( result == DCEP_RESULT_OK )
+    {
+        result = Dcep_ChannelRegistryEnableLabelIndex( &( pState->indexedRegistry ),
+                                                       pState->pLabelIndexMemory,
+                                                       pState->labelIndexMemorySize );
+    }
+
+    for( i = 0; ( result == DCEP_RESULT_OK ) && ( i < LABELED_CHANNEL_COUNT ); i++ )
+    {
+        snprintf( ( char * ) &( pState->labels[ i ][ 0 ] ),
+                  sizeof( pState->labels[ i ] ),
+                  "channel.%08u",
+                  ( unsigned int ) i );
+
+        pState->channelOpenMessage.pChannelName = &( pState->labels[ i ][ 0 ] );
+
+        result = Dcep_ChannelRegistryInsert( &( pState->registry ),
+                                             ( uint16_t ) ( 2 * i ),
+                                             DCEP_CHANNEL_STATE_OPEN,
+                                             &( pState->channelOpenMessage ) );
+
+        if( result == DCEP_RESULT_OK )
+        {
+            result = Dcep_ChannelRegistryInsert( &( pState->indexedRegistry ),
+                                                 ( uint16_t ) ( 2 * i ),
+                                                 DCEP_CHANNEL_STATE_OPEN,
+                                                 &( pState->channelOpenMessage ) );
+        }
+    }
+
+    if( result != DCEP_RESULT_OK )
+    {
+        fprintf( stderr, "Failed to build the channel registries.\n" );
+        exit( EXIT_FAILURE );
+    }
+
+    pState->mixedIndex = 0;
+}
+
+/*-----------------------------------------------------------*/
+
+static void PrepareTimerState( BenchmarkState_t * pState )
+{
+    DcepResult_t result;
+    size_t i;
+
+    PrepareState( pState, DCEP_DATA_CHANNEL_RELIABLE, &( fieldLengths[ 0 ] ) );
+
+    result = Dcep_TimerWheelInit( &( pState->timerWheel ),
+                                  pState->pTimerWheelMemory,
+                                  pState->timerWheelMemorySize,
+                                  PENDING_TIMER_COUNT,
+                                  0 );
+
+    /* Spread the expiry ticks over one timeout. */
+    for( i = 0; ( result == DCEP_RESULT_OK ) && ( i < PENDING_TIMER_COUNT ); i++ )
+    {
+        result = Dcep_TimerWheelArm( &( pState->timerWheel ),
+                                     ( uint16_t ) i,
+                                     ( uint32_t ) ( ( i * PENDING_TIMER_TIMEOUT ) / PENDING_TIMER_COUNT ) );
+    }
+
+    if( result != DCEP_RESULT_OK )
+    {
+        fprintf( stderr, "Failed to build the timer wheel.\n" );
+        exit( EXIT_FAILURE );
+    }
+
+    pState->mixedIndex = 0;
+}
+
+/*-----------------------------------------------------------*/
+
+static void PrepareReliabilityState( BenchmarkState_t * pState )
+{
+    uint32_t random = 1;
+    size_t i;
+
+    PrepareState( pState, DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED, &( fieldLengths[ 0 ] ) );
+    pState->channelOpenMessage.maxLifetimeInMilliseconds = OUTSTANDING_MESSAGE_COUNT / 2;
+
+    if( Dcep_ReliabilityPolicyInit( &( pState->reliabilityPolicy ),
+                                    &( pState->channelOpenMessage ) ) != DCEP_RESULT_OK )
+    {
+        fprintf( stderr, "Failed to build the reliability policy.\n" );
+        exit( EXIT_FAILURE );
+    }
+
+    /* Random send times, so that about half of the messages are abandoned
+     * in no particular order. */
+    for( i = 0; i < OUTSTANDING_MESSAGE_COUNT; i++ )
+    {
+        random = ( random * 1103515245U ) + 12345U;
+
+        pState->sendTimesMs[ i ] = ( random >> 16 ) % OUTSTANDING_MESSAGE_COUNT;
+        pState->numRetransmissions[ i ] = random & 0x3U;
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void RunBenchmark( const Benchmark_t * pBenchmark,
+                          BenchmarkState_t * pState,
+                          const char * pChannelTypeName,
+                          uint64_t minTimeNs )
+{
+    uint64_t iterations = 1;
+    uint64_t elapsedNs = 0;
+    uint64_t startNs, i;
+    size_t sink = 0;
+    double nsPerOp, opsPerSec;
+
+    /* Warm up caches and branch predictors. */
+    for( i = 0; i < 1000; i++ )
+    {
+        sink += pBenchmark->benchmarkFn( pState );
+    }
+
+    for( ; ; )
+    {
+        startNs = GetTimeNs();
+
+        for( i = 0; i < iterations; i++ )
+        {
+            sink += pBenchmark->benchmarkFn( pState );
+        }
+
+        elapsedNs = GetTimeNs() - startNs;
+
+        if( elapsedNs >= minTimeNs )
+        {
+            break;
+        }
+
+        iterations *= 2;
+    }
+
+    benchmarkSink += sink;
+
+    nsPerOp = ( double ) elapsedNs / ( double ) iterations;
+    opsPerSec = ( nsPerOp > 0.0 ) ? ( 1e9 / nsPerOp ) : 0.0;
+
+    printf( "%s,%s,%u,%u,%llu,%.2f,%.0f\n",
+            pBenchmark->pName,
+            pChannelTypeName,
+            ( unsigned int ) pState->channelOpenMessage.channelNameLength,
+            ( unsigned int ) pState->channelOpenMessage.protocolLength,
+            ( unsigned long long ) iterations,
+            nsPerOp,
+            opsPerSec );
+}
+
+/*-----------------------------------------------------------*/
+
+static void PrintUsage( const char * pProgramName )
+{
+    fprintf( stderr,
+             "Usage: %s [--min-time-ms <ms>] [--filter <benchmark name>]\n"
+             "\n"
+             "Prints one CSV line per benchmark:\n"
+             "benchmark,channel_type,label_length,protocol_length,iterations,ns_per_op,ops_per_sec\n",
+             pProgramName );
+}
+
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char * argv[] )
+{
+    uint64_t minTimeNs = ( uint64_t ) DEFAULT_MIN_TIME_MS * 1000000ULL;
+    const char * pFilter = NULL;
+    char channelTypeName[ 8 ];
+    size_t b, t, f;
+    int i;
+
+    for( i = 1; i < argc; i++ )
+    {
+        if( ( strcmp( argv[ i ], "--min-time-ms" ) == 0 ) && ( ( i + 1 ) < argc ) )
+        {
+            minTimeNs = strtoull( argv[ ++i ], NULL, 10 ) * 1000000ULL;
+        }
+        else if( ( strcmp( argv[ i ], "--filter" ) == 0 ) && ( ( i + 1 ) < argc ) )
+        {
+            pFilter = argv[ ++i ];
+        }
+        else
+        {
+            PrintUsage( argv[ 0 ] );
+            return EXIT_FAILURE;
+        }
+    }
+
+    if( Dcep_Init( &( benchmarkState.ctx ) ) != DCEP_RESULT_OK )
+    {
+        fprintf( stderr, "Dcep_Init failed.\n" );
+        return EXIT_FAILURE;
+    }
+
+    AllocateMemory( &( benchmarkState ) );
+
+    memset( &( benchmarkState.channelName[ 0 ] ), 'l', sizeof( benchmarkState.channelName ) );
+    memset( &( benchmarkState.protocol[ 0 ] ), 'p', sizeof( benchmarkState.protocol ) );
+
+    for( b = 0; b < sizeof( benchmarkState.nonAsciiChannelName ); b += NON_ASCII_PATTERN_LENGTH )
+    {
+        memcpy( &( benchmarkState.nonAsciiChannelName[ b ] ), NON_ASCII_PATTERN, NON_ASCII_PATTERN_LENGTH );
+    }
+
+    for( b = 0; b < ACK_BATCH_LENGTH; b++ )
+    {
+        benchmarkState.ackStreamIds[ b ] = ( uint16_t ) ( 2 * b );
+    }
+
+    printf( "benchmark,channel_type,label_length,protocol_length,iterations,ns_per_op,ops_per_sec\n" );
+
+    for( b = 0; b < ARRAY_LENGTH( benchmarks ); b++ )
+    {
+        if( ( pFilter != NULL ) && ( strcmp( pFilter, benchmarks[ b ].pName ) != 0 ) )
+        {
+            continue;
+        }
+
+        if( benchmarks[ b ].input == BENCHMARK_INPUT_NONE )
+        {
+            PrepareState( &( benchmarkState ), DCEP_DATA_CHANNEL_RELIABLE, &( fieldLengths[ 0 ] ) );
+            RunBenchmark( &( benchmarks[ b ] ), &( benchmarkState ), "-", minTimeNs );
+            continue;
+        }
+
+        if( benchmarks[ b ].input == BENCHMARK_INPUT_MIXED_CHANNEL_OPEN )
+        {
+            PrepareMixedState( &( benchmarkState ) );
+            RunBenchmark( &( benchmarks[ b ] ), &( benchmarkState ), "mixed", minTimeNs );
+            continue;
+        }
+
+        if( benchmarks[ b ].input == BENCHMARK_INPUT_ROUTED_CHANNEL_OPEN )
+        {
+            PrepareRoutedState( &( benchmarkState ) );
+            RunBenchmark( &( benchmarks[ b ] ), &( benchmarkState ), "mixed", minTimeNs );
+            continue;
+        }
+
+        if( benchmarks[ b ].input == BENCHMARK_INPUT_LABELED_CHANNELS )
+        {
+            PrepareLabeledState( &( benchmarkState ) );
+            RunBenchmark( &( benchmarks[ b ] ), &( benchmarkState ), "-", minTimeNs );
+            continue;
+        }
+
+        if( benchmarks[ b ].input == BENCHMARK_INPUT_PENDING_TIMERS )
+        {
+            PrepareTimerState( &( benchmarkState ) );
+            RunBenchmark( &( benchmarks[ b ] ), &( benchmarkState ), "-", minTimeNs );
+            continue;
+        }
+
+        if( benchmarks[ b ].input == BENCHMARK_INPUT_OUTSTANDING_MESSAGES )
+        {
+            PrepareReliabilityState( &( benchmarkState ) );
+            RunBenchmark( &( benchmarks[ b ] ), &( benchmarkState ), "0x02", minTimeNs );
+            continue;
+        }
+
+        for( t = 0; t < ARRAY_LENGTH( channelTypes ); t++ )
+        {
+            for( f = 0; f < ARRAY_LENGTH( fieldLengths ); f++ )
+            {
+                PrepareState( &( benchmarkState ), channelTypes[ t ], &( fieldLengths[ f ] ) );
+
+                snprintf( channelTypeName, sizeof( channelTypeName ), "0x%02X", ( unsigned int ) channelTypes[ t ] );
+
+                RunBenchmark( &( benchmarks[ b ] ), &( benchmarkState ), channelTypeName, minTimeNs );
+            }
+        }
+    }
+
+    FreeMemory( &( benchmarkState ) );
+
+    return EXIT_SUCCESS;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,667 @@
+/* Needed for syscall. */
+#define _GNU_SOURCE
+
+/* Standard includes. */
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <signal.h>
+
+/* Linux includes. */
+#include <elf.h>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/ptrace.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <sys/user.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+/* API includes. */
+#include "dcep_api.h"
+
+/*-----------------------------------------------------------*/
+
+/* Calls per measurement. The per-call count is the measured count divided by
+ * this, so the fixed cost of enabling and disabling the counter is spread
+ * over many calls. */
+#define CALLS_PER_MEASUREMENT    1000
+
+/* The smallest of several measurements is reported to filter out counts
+ * added by interrupts and page faults. */
+#define NUM_MEASUREMENTS         5
+
+/* Calls per measurement in --single-step mode. Every workload is measured
+ * with this many calls and with twice as many, and the difference is
+ * divided by this, so the instructions that start and stop a measurement
+ * cancel out. */
+#define SINGLE_STEP_CALLS        10
+
+#define SMALL_FIELD_LENGTH       16
+#define LARGE_FIELD_LENGTH       256
+#define MAX_MESSAGE_LENGTH       ( DCEP_HEADER_LENGTH + ( 2 * LARGE_FIELD_LENGTH ) )
+
+#define ARRAY_LENGTH( array )    ( sizeof( array ) / sizeof( ( array )[ 0 ] ) )
+
+#if defined( __GNUC__ )
+    #define WORKLOAD_NOINLINE    __attribute__( ( noinline ) )
+#else
+    #define WORKLOAD_NOINLINE
+#endif
+
+/* Single stepping reads the program counter of the traced child. */
+#if defined( __x86_64__ )
+    #define SINGLE_STEP_PROGRAM_COUNTER( regs )    ( ( regs ).rip )
+#elif defined( __aarch64__ )
+    #define SINGLE_STEP_PROGRAM_COUNTER( regs )    ( ( regs ).pc )
+#endif
+
+typedef size_t ( * WorkloadFunction_t ) ( void );
+
+typedef struct Workload
+{
+    const char * pName;
+    WorkloadFunction_t workloadFn;
+} Workload_t;
+
+/*-----------------------------------------------------------*/
+
+static DcepContext_t ctx;
+static DcepChannelOpenMessage_t smallChannelOpenMessage;
+static DcepChannelOpenMessage_t largeChannelOpenMessage;
+static DcepPreparedChannelOpenMessage_t preparedMessage;
+static uint8_t fieldBuffer[ LARGE_FIELD_LENGTH ];
+static uint8_t smallMessage[ MAX_MESSAGE_LENGTH ];
+static size_t smallMessageLength;
+static uint8_t largeMessage[ MAX_MESSAGE_LENGTH ];
+static size_t largeMessageLength;
+static uint8_t templateBuffer[ MAX_MESSAGE_LENGTH ];
+static uint8_t outputBuffer[ MAX_MESSAGE_LENGTH ];
+static DcepBatchEntry_t batchEntries[ DCEP_HEADER_BLOCK_SIZE ];
+static DcepBatchResult_t batchResults[ DCEP_HEADER_BLOCK_SIZE ];
+static volatile size_t workloadSink;
+
+/* Start and end of the code of the executable, defined by the GNU linker.
+ * Only instructions in between, including those of the DCEP library linked
+ * into the executable, are counted in --single-step mode. The C library is
+ * left out because its memcpy and memset are picked for the CPU at load
+ * time. */
+extern const char __executable_start[];
+extern const char etext[];
+
+/*-----------------------------------------------------------*/
+
+/* Each workload performs exactly one call of the function under test with
+ * fixed inputs. Workloads are not inlined so that they also appear as
+ * separate functions under valgrind --tool=callgrind. */
+
+static WORKLOAD_NOINLINE size_t Workload_SerializeChannelOpenSmall( void )
+{
+    size_t bufferLength = sizeof( outputBuffer );
+
+    ( void ) Dcep_SerializeChannelOpenMessage( &( ctx ), &( smallChannelOpenMessage ), &( outputBuffer[ 0 ] ), &( bufferLength ) );
+
+    return bufferLength;
+}
+
+static WORKLOAD_NOINLINE size_t Workload_SerializeChannelOpenLarge( void )
+{
+    size_t bufferLength = sizeof( outputBuffer );
+
+    ( void ) Dcep_SerializeChannelOpenMessage( &( ctx ), &( largeChannelOpenMessage ), &( outputBuffer[ 0 ] ), &( bufferLength ) );
+
+    return bufferLength;
+}
+
+static WORKLOAD_NOINLINE size_t Workload_SerializeChannelOpenIoVec( void )
+{
+    DcepIoVec_t ioVecs[ DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS ];
+    size_t ioVecCount = DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS;
+
+    ( void ) Dcep_SerializeChannelOpenMessageIoVec( &( ctx ),
+                                                    &( largeChannelOpenMessage ),
+                                                    &( outputBuffer[ 0 ] ),
+                                                    sizeof( outputBuffer ),
+                                                    &( ioVecs[ 0 ] ),
+                                                    &( ioVecCount ) );
+
+    return ioVecCount;
+}
+
+static WORKLOAD_NOINLINE size_t Workload_SerializePreparedChannelOpen( void )
+{
+    size_t bufferLength = sizeof( outputBuffer );
+
+    ( void ) Dcep_SerializePreparedChannelOpenMessage( &( ctx ), &( preparedMessage ), 256, 5, &( outputBuffer[ 0 ] ), &( bufferLength ) );
+
+    return bufferLength;
+}
+
+static WORKLOAD_NOINLINE size_t Workload_GetChannelOpenMessageLength( void )
+{
+    size_t messageLength = 0;
+
+    ( void ) Dcep_GetChannelOpenMessageLength( &( ctx ), &( largeChannelOpenMessage ), &( messageLength ) );
+
+    return messageLength;
+}
+
+static WORKLOAD_NOINLINE size_t Workload_SerializeChannelAck( void )
+{
+    size_t bufferLength = sizeof( outputBuffer );
+
+    ( void ) Dcep_SerializeChannelAckMessage( &( ctx ), &( outputBuffer[ 0 ] ), &( bufferLength ) );
+
+    return bufferLength;
+}
+
+static WORKLOAD_NOINLINE size_t Workload_DeserializeChannelOpenSmall( void )
+{
+    DcepChannelOpenMessage_t channelOpenMessage;
+
+    ( void ) Dcep_DeserializeChannelOpenMessage( &( ctx ), &( smallMessage[ 0 ] ), smallMessageLength, &( channelOpenMessage ) );
+
+    return channelOpenMessage.channelNameLength;
+}
+
+static WORKLOAD_NOINLINE size_t Workload_DeserializeChannelOpenLarge( void )
+{
+    DcepChannelOpenMessage_t channelOpenMessage;
+
+    ( void ) Dcep_DeserializeChannelOpenMessage( &( ctx ), &( largeMessage[ 0 ] ), largeMessageLength, &( channelOpenMessage ) );
+
+    return channelOpenMessage.channelNameLength;
+}
+
+static WORKLOAD_NOINLINE size_t Workload_DeserializeBatch16( void )
+{
+    ( void ) Dcep_DeserializeBatch( &( ctx ), &( batchEntries[ 0 ] ), DCEP_HEADER_BLOCK_SIZE, &( batchResults[ 0 ] ) );
+
+    return batchResults[ DCEP_HEADER_BLOCK_SIZE - 1 ].streamId;
+}
+
+static WORKLOAD_NOINLINE size_t Workload_StreamingParserFeed( void )
+{
+    DcepStreamingParser_t parser;
+    DcepStreamingParserOutput_t output;
+
+    ( void ) Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    ( void ) Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( largeMessage[ 0 ] ), largeMessageLength, &( output ) );
+
+    return output.consumedLength;
+}
+
+static WORKLOAD_NOINLINE size_t Workload_GetMessageType( void )
+{
+    DcepMessageType_t messageType;
+
+    ( void ) Dcep_GetMessageType( &( ctx ), &( smallMessage[ 0 ] ), smallMessageLength, &( messageType ) );
+
+    return ( size_t ) messageType;
+}
+
+/*-----------------------------------------------------------*/
+
+static const Workload_t workloads[] =
+{
+    { "serialize_channel_open_small",     Workload_SerializeChannelOpenSmall     },
+    { "serialize_channel_open_large",     Workload_SerializeChannelOpenLarge     },
+    { "serialize_channel_open_iovec",     Workload_SerializeChannelOpenIoVec     },
+    { "serialize_prepared_channel_open",  Workload_SerializePreparedChannelOpen  },
+    { "get_channel_open_message_length",  Workload_GetChannelOpenMessageLength   },
+    { "serialize_channel_ack",            Workload_SerializeChannelAck           },
+    { "deserialize_channel_open_small",   Workload_DeserializeChannelOpenSmall   },
+    { "deserialize_channel_open_large",   Workload_DeserializeChannelOpenLarge   },
+    { "deserialize_batch_16",             Workload_DeserializeBatch16            },
+    { "streaming_parser_feed",            Workload_StreamingParserFeed           },
+    { "get_message_type",                 Workload_GetMessageType                }
+};
+
+/*-----------------------------------------------------------*/
+
+static int PrepareInputs( void )
+{
+    size_t i;
+    int ret = 0;
+
+    memset( &( fieldBuffer[ 0 ] ), 'x', sizeof( fieldBuffer ) );
+
+    smallChannelOpenMessage.channelType = DCEP_DATA_CHANNEL_RELIABLE;
+    smallChannelOpenMessage.priority = 256;
+    smallChannelOpenMessage.pChannelName = &( fieldBuffer[ 0 ] );
+    smallChannelOpenMessage.channelNameLength = SMALL_FIELD_LENGTH;
+    smallChannelOpenMessage.pProtocol = &( fieldBuffer[ 0 ] );
+    smallChannelOpenMessage.protocolLength = SMALL_FIELD_LENGTH / 2;
+
+    largeChannelOpenMessage.channelType = DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED;
+    largeChannelOpenMessage.priority = 512;
+    largeChannelOpenMessage.numRetransmissions = 5;
+    largeChannelOpenMessage.pChannelName = &( fieldBuffer[ 0 ] );
+    largeChannelOpenMessage.channelNameLength = LARGE_FIELD_LENGTH;
+    largeChannelOpenMessage.pProtocol = &( fieldBuffer[ 0 ] );
+    largeChannelOpenMessage.protocolLength = LARGE_FIELD_LENGTH;
+
+    smallMessageLength = sizeof( smallMessage );
+    largeMessageLength = sizeof( largeMessage );
+
+    if( ( Dcep_Init( &( ctx ) ) != DCEP_RESULT_OK ) ||
+        ( Dcep_SerializeChannelOpenMessage( &( ctx ), &( smallChannelOpenMessage ), &( smallMessage[ 0 ] ), &( smallMessageLength ) ) != DCEP_RESULT_OK ) ||
+        ( Dcep_SerializeChannelOpenMessage( &( ctx ), &( largeChannelOpenMessage ), &( largeMessage[ 0 ] ), &( largeMessageLength ) ) != DCEP_RESULT_OK ) ||
+        ( Dcep_PrepareChannelOpenMessage( &( ctx ), &( largeChannelOpenMessage ), &( templateBuffer[ 0 ] ), sizeof( templateBuffer ), &( preparedMessage ) ) != DCEP_RESULT_OK ) )
+    {
+        ret = -1;
+    }
+
+    for( i = 0; i < DCEP_HEADER_BLOCK_SIZE; i++ )
+    {
+        batchEntries[ i ].pDcepMessage = ( ( i % 2 ) == 0 ) ? &( smallMessage[ 0 ] ) : &( largeMessage[ 0 ] );
+        batchEntries[ i ].dcepMessageLength = ( ( i % 2 ) == 0 ) ? smallMessageLength : largeMessageLength;
+        batchEntries[ i ].streamId = ( uint16_t ) i;
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+static int OpenInstructionCounter( void )
+{
+    struct perf_event_attr attr;
+
+    memset( &( attr ), 0, sizeof( attr ) );
+    attr.type = PERF_TYPE_HARDWARE;
+    attr.size = sizeof( attr );
+    attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+    attr.disabled = 1;
+    attr.exclude_kernel = 1;
+    attr.exclude_hv = 1;
+
+    return ( int ) syscall( SYS_perf_event_open, &( attr ), 0, -1, -1, 0 );
+}
+
+/*-----------------------------------------------------------*/
+
+static int MeasureWorkload( int counterFd,
+                            const Workload_t * pWorkload,
+                            double * pInstructionsPerCall )
+{
+    uint64_t count, minCount = UINT64_MAX;
+    size_t sink = 0;
+    int m, i, ret = 0;
+
+    /* Warm up caches and lazy symbol binding. */
+    for( i = 0; i < CALLS_PER_MEASUREMENT; i++ )
+    {
+        sink += pWorkload->workloadFn();
+    }
+
+    for( m = 0; ( m < NUM_MEASUREMENTS ) && ( ret == 0 ); m++ )
+    {
+        ( void ) ioctl( counterFd, PERF_EVENT_IOC_RESET, 0 );
+        ( void ) ioctl( counterFd, PERF_EVENT_IOC_ENABLE, 0 );
+
+        for( i = 0; i < CALLS_PER_MEASUREMENT; i++ )
+        {
+            sink += pWorkload->workloadFn();
+        }
+
+        ( void ) ioctl( counterFd, PERF_EVENT_IOC_DISABLE, 0 );
+
+        if( read( counterFd, &( count ), sizeof( count ) ) != ( ssize_t ) sizeof( count ) )
+        {
+            ret = -1;
+        }
+        else if( count < minCount )
+        {
+            minCount = count;
+        }
+    }
+
+    workloadSink += sink;
+    *pInstructionsPerCall = ( double ) minCount / ( double ) CALLS_PER_MEASUREMENT;
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Runs in the traced child. Stops itself with SIGSTOP before and after the
+ * calls of every measurement, so that the parent only single steps the
+ * measurements. */
+static void RunSingleStepChild( void )
+{
+    size_t w, calls;
+    int i;
+
+    if( ptrace( PTRACE_TRACEME, 0, NULL, NULL ) == -1 )
+    {
+        perror( "ptrace" );
+        _exit( EXIT_FAILURE );
+    }
+
+    /* Resolve lazily bound symbols before the first measurement. */
+    for( w = 0; w < ARRAY_LENGTH( workloads ); w++ )
+    {
+        workloadSink += workloads[ w ].workloadFn();
+    }
+
+    for( w = 0; w < ARRAY_LENGTH( workloads ); w++ )
+    {
+        for( calls = SINGLE_STEP_CALLS; calls <= ( 2 * SINGLE_STEP_CALLS ); calls += SINGLE_STEP_CALLS )
+        {
+            ( void ) raise( SIGSTOP );
+
+            for( i = 0; i < ( int ) calls; i++ )
+            {
+                workloadSink += workloads[ w ].workloadFn();
+            }
+
+            ( void ) raise( SIGSTOP );
+        }
+    }
+
+    _exit( EXIT_SUCCESS );
+}
+
+/*-----------------------------------------------------------*/
+
+/* Waits until the traced child stops and returns the stopping signal, or -1
+ * if the child exited or was killed instead. */
+static int WaitForStop( pid_t child )
+{
+    int status, ret = -1;
+
+    if( ( waitpid( child, &( status ), 0 ) == child ) && WIFSTOPPED( status ) )
+    {
+        ret = WSTOPSIG( status );
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Single steps the traced child from one SIGSTOP to the next and counts the
+ * instructions it executes in the code of the executable. */
+static int CountSteppedInstructions( pid_t child,
+                                     uint64_t * pCount )
+{
+    #if defined( SINGLE_STEP_PROGRAM_COUNTER )
+        struct user_regs_struct regs;
+        struct iovec regsIoVec;
+        uintptr_t programCounter;
+        int stopSignal = SIGTRAP, ret = 0;
+
+        regsIoVec.iov_base = &( regs );
+        regsIoVec.iov_len = sizeof( regs );
+        *pCount = 0;
+
+        while( ( ret == 0 ) && ( stopSignal == SIGTRAP ) )
+        {
+            if( ptrace( PTRACE_SINGLESTEP, child, NULL, NULL ) == -1 )
+            {
+                ret = -1;
+            }
+            else
+            {
+                stopSignal = WaitForStop( child );
+            }
+
+            if( ( ret == 0 ) && ( stopSignal == SIGTRAP ) )
+            {
+                if( ptrace( PTRACE_GETREGSET, child, ( void * ) NT_PRSTATUS, &( regsIoVec ) ) == -1 )
+                {
+                    ret = -1;
+                }
+                else
+                {
+                    programCounter = ( uintptr_t ) SINGLE_STEP_PROGRAM_COUNTER( regs );
+
+                    if( ( programCounter >= ( uintptr_t ) __executable_start ) &&
+                        ( programCounter < ( uintptr_t ) etext ) )
+                    {
+                        ( *pCount )++;
+                    }
+                }
+            }
+        }
+
+        if( stopSignal != SIGSTOP )
+        {
+            ret = -1;
+        }
+
+        return ret;
+    #else /* if defined( SINGLE_STEP_PROGRAM_COUNTER ) */
+        ( void ) child;
+        ( void ) pCount;
+        fprintf( stderr, "--single-step is not supported on this architecture.\n" );
+
+        return -1;
+    #endif /* if defined( SINGLE_STEP_PROGRAM_COUNTER ) */
+}
+
+/*-----------------------------------------------------------*/
+
+/* Counts the instructions per call of every workload by single stepping a
+ * child process. Unlike hardware counters, the result does not change from
+ * run to run or from machine to machine, only with the compiler and its
+ * flags. */
+static int MeasureWorkloadsSingleStep( double * pInstructionsPerCall )
+{
+    uint64_t counts[ 2 ];
+    pid_t child;
+    size_t w, m;
+    int ret = 0;
+
+    child = fork();
+
+    if( child == 0 )
+    {
+        RunSingleStepChild();
+    }
+
+    if( child < 0 )
+    {
+        perror( "fork" );
+        ret = -1;
+    }
+
+    for( w = 0; ( w < ARRAY_LENGTH( workloads ) ) && ( ret == 0 ); w++ )
+    {
+        for( m = 0; ( m < 2 ) && ( ret == 0 ); m++ )
+        {
+            /* Run to the SIGSTOP before the calls, then step to the one after. */
+            if( ( ( ( w != 0 ) || ( m != 0 ) ) && ( ptrace( PTRACE_CONT, child, NULL, NULL ) == -1 ) ) ||
+                ( WaitForStop( child ) != SIGSTOP ) ||
+                ( CountSteppedInstructions( child, &( counts[ m ] ) ) != 0 ) )
+            {
+                fprintf( stderr, "Failed to single step the workload %s.\n", workloads[ w ].pName );
+                ret = -1;
+            }
+        }
+
+        if( ret == 0 )
+        {
+            pInstructionsPerCall[ w ] = ( double ) ( counts[ 1 ] - counts[ 0 ] ) / ( double ) SINGLE_STEP_CALLS;
+        }
+    }
+
+    if( child > 0 )
+    {
+        if( ret == 0 )
+        {
+            ( void ) ptrace( PTRACE_CONT, child, NULL, NULL );
+        }
+        else
+        {
+            ( void ) kill( child, SIGKILL );
+        }
+
+        ( void ) waitpid( child, NULL, 0 );
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Reads the instructions per call of every workload from the hardware
+ * counters. */
+static int MeasureWorkloadsPerf( double * pInstructionsPerCall )
+{
+    int counterFd, ret = 0;
+    size_t w;
+
+    counterFd = OpenInstructionCounter();
+
+    if( counterFd < 0 )
+    {
+        perror( "perf_event_open" );
+        fprintf( stderr,
+                 "Hardware instruction counters are not available. Check /proc/sys/kernel/perf_event_paranoid\n"
+                 "or run with --single-step.\n" );
+        ret = -1;
+    }
+
+    for( w = 0; ( w < ARRAY_LENGTH( workloads ) ) && ( ret == 0 ); w++ )
+    {
+        if( MeasureWorkload( counterFd, &( workloads[ w ] ), &( pInstructionsPerCall[ w ] ) ) != 0 )
+        {
+            fprintf( stderr, "Failed to read the instruction counter.\n" );
+            ret = -1;
+        }
+    }
+
+    if( counterFd >= 0 )
+    {
+        ( void ) close( counterFd );
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
+
+static void RunWorkloadsOnly( void )
+{
+    size_t w;
+    int i;
+
+    for( w = 0; w < ARRAY_LENGTH( workloads ); w++ )
+    {
+        for( i = 0; i < CALLS_PER_MEASUREMENT; i++ )
+        {
+            workloadSink += workloads[ w ].workloadFn();
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void PrintUsage( const char * pProgramName )
+{
+    fprintf( stderr,
+             "Usage: %s [--output <file>] [--single-step | --callgrind]\n"
+             "\n"
+             "Prints the user space instruction count of one call of each workload as CSV:\n"
+             "workload,instructions_per_call\n"
+             "\n"
+             "By default the count is read from the hardware counters. --single-step counts the\n"
+             "instructions executed in the code of this executable by single stepping it with ptrace,\n"
+             "which gives the same count on every run.\n"
+             "\n"
+             "--callgrind runs every workload %d times without reading hardware counters, for use with\n"
+             "valgrind --tool=callgrind --collect-atstart=no --toggle-collect='Workload_*'\n",
+             pProgramName,
+             CALLS_PER_MEASUREMENT );
+}
+
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char * argv[] )
+{
+    const char * pOutputPath = NULL;
+    FILE * pOutput = stdout;
+    int callgrindMode = 0, singleStepMode = 0;
+    double instructionsPerCall[ ARRAY_LENGTH( workloads ) ];
+    size_t w;
+    int i, ret;
+
+    for( i = 1; i < argc; i++ )
+    {
+        if( ( strcmp( argv[ i ], "--output" ) == 0 ) && ( ( i + 1 ) < argc ) )
+        {
+            pOutputPath = argv[ ++i ];
+        }
+        else if( strcmp( argv[ i ], "--callgrind" ) == 0 )
+        {
+            callgrindMode = 1;
+        }
+        else if( strcmp( argv[ i ], "--single-step" ) == 0 )
+        {
+            singleStepMode = 1;
+        }
+        else
+        {
+            PrintUsage( argv[ 0 ] );
+            return EXIT_FAILURE;
+        }
+    }
+
+    if( PrepareInputs() != 0 )
+    {
+        fprintf( stderr, "Failed to prepare the workload inputs.\n" );
+        return EXIT_FAILURE;
+    }
+
+    if( callgrindMode != 0 )
+    {
+        RunWorkloadsOnly();
+        return EXIT_SUCCESS;
+    }
+
+    if( singleStepMode != 0 )
+    {
+        ret = MeasureWorkloadsSingleStep( &( instructionsPerCall[ 0 ] ) );
+    }
+    else
+    {
+        ret = MeasureWorkloadsPerf( &( instructionsPerCall[ 0 ] ) );
+    }
+
+    if( ret != 0 )
+    {
+        return EXIT_FAILURE;
+    }
+
+    if( pOutputPath != NULL )
+    {
+        pOutput = fopen( pOutputPath, "w" );
+
+        if( pOutput == NULL )
+        {
+            perror( pOutputPath );
+            return EXIT_FAILURE;
+        }
+    }
+
+    fprintf( pOutput, "workload,instructions_per_call\n" );
+
+    for( w = 0; w < ARRAY_LENGTH( workloads ); w++ )
+    {
+        fprintf( pOutput, "%s,%.1f\n", workloads[ w ].pName, instructionsPerCall[ w ] );
+    }
+
+    if( pOutput != stdout )
+    {
+        ( void ) fclose( pOutput );
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,219 @@
+/* Standard includes. */
+#include <ctype.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*-----------------------------------------------------------*/
+
+#define MAX_WORKLOADS          64
+#define MAX_NAME_LENGTH        64
+#define MAX_LINE_LENGTH        256
+
+/* Return values of ReadCounts. */
+#define READ_COUNTS_INVALID    ( -1 )
+#define READ_COUNTS_NO_FILE    ( -2 )
+
+typedef struct WorkloadCount
+{
+    char name[ MAX_NAME_LENGTH ];
+    double instructionsPerCall;
+} WorkloadCount_t;
+
+/*-----------------------------------------------------------*/
+
+/* Parses a number that is neither negative nor NaN, surrounded by nothing
+ * but white space. Returns 0 on success and -1 otherwise. */
+static int ParseNonNegative( const char * pText,
+                             double * pValue )
+{
+    char * pEnd;
+    double value;
+
+    value = strtod( pText, &( pEnd ) );
+
+    while( isspace( ( unsigned char ) *pEnd ) != 0 )
+    {
+        pEnd++;
+    }
+
+    if( ( pEnd == pText ) ||
+        ( *pEnd != '\0' ) ||
+        !( value >= 0.0 ) )
+    {
+        return -1;
+    }
+
+    *pValue = value;
+
+    return 0;
+}
+
+/*-----------------------------------------------------------*/
+
+/* Reads a CSV file written by dcep_instruction_count. Returns the number of
+ * workloads read, READ_COUNTS_NO_FILE if the file can not be opened or
+ * READ_COUNTS_INVALID if it is not a valid instruction count file. */
+static int ReadCounts( const char * pPath,
+                       WorkloadCount_t * pCounts,
+                       int maxCounts )
+{
+    FILE * pFile;
+    char line[ MAX_LINE_LENGTH ];
+    char * pSeparator;
+    int numCounts = 0, lineNumber = 0;
+
+    pFile = fopen( pPath, "r" );
+
+    if( pFile == NULL )
+    {
+        perror( pPath );
+        return READ_COUNTS_NO_FILE;
+    }
+
+    while( fgets( line, sizeof( line ), pFile ) != NULL )
+    {
+        lineNumber++;
+
+        /* Skip the header. */
+        if( lineNumber == 1 )
+        {
+            continue;
+        }
+
+        pSeparator = strchr( line, ',' );
+
+        if( ( pSeparator == NULL ) ||
+            ( pSeparator == line ) ||
+            ( ( size_t ) ( pSeparator - line ) >= MAX_NAME_LENGTH ) ||
+            ( numCounts == maxCounts ) ||
+            ( ParseNonNegative( pSeparator + 1, &( pCounts[ numCounts ].instructionsPerCall ) ) != 0 ) )
+        {
+            fprintf( stderr, "%s:%d: invalid line.\n", pPath, lineNumber );
+            numCounts = READ_COUNTS_INVALID;
+            break;
+        }
+
+        *pSeparator = '\0';
+        strcpy( pCounts[ numCounts ].name, line );
+        numCounts++;
+    }
+
+    ( void ) fclose( pFile );
+
+    return numCounts;
+}
+
+/*-----------------------------------------------------------*/
+
+static const WorkloadCount_t * FindCount( const WorkloadCount_t * pCounts,
+                                          int numCounts,
+                                          const char * pName )
+{
+    const WorkloadCount_t * pFound = NULL;
+    int i;
+
+    for( i = 0; ( i < numCounts ) && ( pFound == NULL ); i++ )
+    {
+        if( strcmp( pCounts[ i ].name, pName ) == 0 )
+        {
+            pFound = &( pCounts[ i ] );
+        }
+    }
+
+    return pFound;
+}
+
+/*-----------------------------------------------------------*/
+
+int main( int argc,
+          char * argv[] )
+{
+    static WorkloadCount_t baselineCounts[ MAX_WORKLOADS ];
+    static WorkloadCount_t currentCounts[ MAX_WORKLOADS ];
+    const WorkloadCount_t * pMatch;
+    int numBaselineCounts, numCurrentCounts, i;
+    double thresholdPercent, changePercent;
+    int ret = EXIT_SUCCESS;
+
+    if( argc != 4 )
+    {
+        fprintf( stderr,
+                 "Usage: %s <baseline.csv> <current.csv> <threshold percent>\n"
+                 "\n"
+                 "Fails when a workload of the baseline is missing from the current counts or\n"
+                 "needs more than <threshold percent> more instructions per call.\n",
+                 argv[ 0 ] );
+        return EXIT_FAILURE;
+    }
+
+    if( ParseNonNegative( argv[ 3 ], &( thresholdPercent ) ) != 0 )
+    {
+        fprintf( stderr, "Invalid threshold \"%s\": expected a percentage of 0 or more.\n", argv[ 3 ] );
+        return EXIT_FAILURE;
+    }
+
+    numBaselineCounts = ReadCounts( argv[ 1 ], &( baselineCounts[ 0 ] ), MAX_WORKLOADS );
+
+    if( numBaselineCounts == READ_COUNTS_NO_FILE )
+    {
+        fprintf( stderr,
+                 "No instruction count baseline. Build the instruction_count_baseline target on this\n"
+                 "machine to generate %s.\n",
+                 argv[ 1 ] );
+        return EXIT_FAILURE;
+    }
+
+    numCurrentCounts = ReadCounts( argv[ 2 ], &( currentCounts[ 0 ] ), MAX_WORKLOADS );
+
+    if( ( numBaselineCounts < 0 ) || ( numCurrentCounts < 0 ) )
+    {
+        return EXIT_FAILURE;
+    }
+
+    printf( "%-36s %12s %12s %9s\n", "workload", "baseline", "current", "change" );
+
+    for( i = 0; i < numBaselineCounts; i++ )
+    {
+        pMatch = FindCount( &( currentCounts[ 0 ] ), numCurrentCounts, baselineCounts[ i ].name );
+
+        if( pMatch == NULL )
+        {
+            printf( "%-36s %12.1f %12s %9s  FAIL (missing)\n", baselineCounts[ i ].name, baselineCounts[ i ].instructionsPerCall, "-", "-" );
+            ret = EXIT_FAILURE;
+            continue;
+        }
+
+        changePercent = 0.0;
+
+        if( baselineCounts[ i ].instructionsPerCall > 0.0 )
+        {
+            changePercent = ( ( pMatch->instructionsPerCall - baselineCounts[ i ].instructionsPerCall ) * 100.0 ) /
+                            baselineCounts[ i ].instructionsPerCall;
+        }
+
+        printf( "%-36s %12.1f %12.1f %8.2f%%%s\n",
+                baselineCounts[ i ].name,
+                baselineCounts[ i ].instructionsPerCall,
+                pMatch->instructionsPerCall,
+                changePercent,
+                ( changePercent > thresholdPercent ) ? "  FAIL" : "" );
+
+        if( changePercent > thresholdPercent )
+        {
+            ret = EXIT_FAILURE;
+        }
+    }
+
+    for( i = 0; i < numCurrentCounts; i++ )
+    {
+        if( FindCount( &( baselineCounts[ 0 ] ), numBaselineCounts, currentCounts[ i ].name ) == NULL )
+        {
+            printf( "%-36s %12s %12.1f %9s  (not in baseline)\n", currentCounts[ i ].name, "-", currentCounts[ i ].instructionsPerCall, "-" );
+        }
+    }
+
+    return ret;
+}
+
+/*-----------------------------------------------------------*/
@@ -46,6 +46,7 @@ void test_dcepInit( void )
     TEST_ASSERT_NOT_NULL( ctx.readWriteFunctions.writeUint32Fn );
     TEST_ASSERT_NOT_NULL( ctx.readWriteFunctions.readUint16Fn );
     TEST_ASSERT_NOT_NULL( ctx.readWriteFunctions.readUint32Fn );
+    TEST_ASSERT_NOT_NULL( ctx.validateHeaderBlockFn );
 }
 
 /*-----------------------------------------------------------*/
@@ -571,6 +572,96 @@ void test_dcepSerializeChannelAckMessage_BadParams( void )
 
 /*-----------------------------------------------------------*/
 
+/**
+ * @brief Validate that Dcep_SerializeChannelAckBatch writes one ACK per
+ * stream back to back and describes each of them.
+ */
+void test_dcepSerializeChannelAckBatch( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    uint16_t streamIds[] = { 1, 3, 1022, 5 };
+    DcepAckBatchEntry_t entries[ 4 ];
+    size_t bufferLength = MAX_BUFFER_LENGTH;
+    size_t i;
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_SerializeChannelAckBatch( &( ctx ),
+                                            &( streamIds[ 0 ] ),
+                                            4,
+                                            &( testBuffer[ 0 ] ),
+                                            &( bufferLength ),
+                                            &( entries[ 0 ] ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 4, bufferLength );
+    TEST_ASSERT_EQUAL( 0, testBuffer[ 4 ] );
+
+    for( i = 0; i < 4; i++ )
+    {
+        TEST_ASSERT_EQUAL( DCEP_MESSAGE_DATA_CHANNEL_ACK, testBuffer[ i ] );
+        TEST_ASSERT_EQUAL( streamIds[ i ], entries[ i ].streamId );
+        TEST_ASSERT_EQUAL_PTR( &( testBuffer[ i ] ), entries[ i ].payload.pBase );
+        TEST_ASSERT_EQUAL( DCEP_DATA_CHANNEL_ACK_MESSAGE_LENGTH, entries[ i ].payload.length );
+    }
+
+    /* A buffer that fits exactly is enough. */
+    bufferLength = 4;
+    result = Dcep_SerializeChannelAckBatch( &( ctx ),
+                                            &( streamIds[ 0 ] ),
+                                            4,
+                                            &( testBuffer[ 0 ] ),
+                                            &( bufferLength ),
+                                            &( entries[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_SerializeChannelAckBatch with bad parameters.
+ */
+void test_dcepSerializeChannelAckBatch_BadParams( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    uint16_t streamIds[] = { 1, 3 };
+    DcepAckBatchEntry_t entries[ 2 ];
+    size_t bufferLength = MAX_BUFFER_LENGTH;
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_SerializeChannelAckBatch( NULL, &( streamIds[ 0 ] ), 2, &( testBuffer[ 0 ] ), &( bufferLength ), &( entries[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_SerializeChannelAckBatch( &( ctx ), NULL, 2, &( testBuffer[ 0 ] ), &( bufferLength ), &( entries[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_SerializeChannelAckBatch( &( ctx ), &( streamIds[ 0 ] ), 0, &( testBuffer[ 0 ] ), &( bufferLength ), &( entries[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_SerializeChannelAckBatch( &( ctx ), &( streamIds[ 0 ] ), 2, NULL, &( bufferLength ), &( entries[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_SerializeChannelAckBatch( &( ctx ), &( streamIds[ 0 ] ), 2, &( testBuffer[ 0 ] ), NULL, &( entries[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_SerializeChannelAckBatch( &( ctx ), &( streamIds[ 0 ] ), 2, &( testBuffer[ 0 ] ), &( bufferLength ), NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Buffer too short for every ACK. */
+    bufferLength = 1;
+    result = Dcep_SerializeChannelAckBatch( &( ctx ), &( streamIds[ 0 ] ), 2, &( testBuffer[ 0 ] ), &( bufferLength ), &( entries[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+    TEST_ASSERT_EQUAL( 1, bufferLength );
+    TEST_ASSERT_EQUAL( 0, testBuffer[ 0 ] );
+}
+
+/*-----------------------------------------------------------*/
+
 /* ==============================  Test Cases for Channel Open Message Deserialization ============================== */
 
 /**
@@ -978,6 +1069,322 @@ void test_dcepDeserializeChannelOpenMessage_MalformedMessage_Protocol( void )
 
 /*-----------------------------------------------------------*/
 
+/* ==============================  Test Cases for Protocol Routing ============================== */
+
+/**
+ * @brief Validate that Dcep_DeserializeAndRouteChannelOpenMessage returns the
+ * handler registered for the protocol, and no handler for an unregistered
+ * protocol.
+ */
+void test_dcepDeserializeAndRouteChannelOpenMessage( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t deserializedMessage = { 0 };
+    DcepProtocolTable_t protocolTable;
+    const uint8_t chat[] = "chat";
+    const uint8_t file[] = "file";
+    const DcepProtocolHandler_t protocolHandlers[] =
+    {
+        { &( chat[ 0 ] ), 4, 7 },
+        { &( file[ 0 ] ), 4, 9 }
+    };
+    uint16_t handlerId = 0;
+    uint8_t serializedMessage[] =
+    {
+        DCEP_MESSAGE_DATA_CHANNEL_OPEN, /* Message Type: 0x03. */
+        DCEP_DATA_CHANNEL_RELIABLE,     /* Channel Type: 0x00. */
+        0x00, 0x01,                     /* Priority: 1. */
+        0x00, 0x00, 0x00, 0x00,         /* Reliability parameter: 0. */
+        0x00, 0x01,                     /* Channel name length: 1. */
+        0x00, 0x04,                     /* Protocol length: 4. */
+        0x61,                           /* Channel name: "a". */
+        0x66, 0x69, 0x6C, 0x65          /* Protocol: "file". */
+    };
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandlers[ 0 ] ), 2 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_DeserializeAndRouteChannelOpenMessage( &( ctx ),
+                                                         &( protocolTable ),
+                                                         &( serializedMessage[ 0 ] ),
+                                                         sizeof( serializedMessage ),
+                                                         &( deserializedMessage ),
+                                                         &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 9, handlerId );
+    TEST_ASSERT_EQUAL( 1, deserializedMessage.priority );
+    TEST_ASSERT_EQUAL_PTR( &( serializedMessage[ 13 ] ), deserializedMessage.pProtocol );
+
+    /* Protocol "filf" is not registered. */
+    serializedMessage[ 16 ] = 0x66;
+
+    result = Dcep_DeserializeAndRouteChannelOpenMessage( &( ctx ),
+                                                         &( protocolTable ),
+                                                         &( serializedMessage[ 0 ] ),
+                                                         sizeof( serializedMessage ),
+                                                         &( deserializedMessage ),
+                                                         &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_PROTOCOL_TABLE_NO_HANDLER, handlerId );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_DeserializeAndRouteChannelOpenMessage with bad
+ * parameters and a malformed message.
+ */
+void test_dcepDeserializeAndRouteChannelOpenMessage_BadParams( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t deserializedMessage = { 0 };
+    DcepProtocolTable_t protocolTable;
+    const DcepProtocolHandler_t protocolHandler = { NULL, 0, 1 };
+    uint16_t handlerId = 0;
+    uint8_t serializedMessage[] =
+    {
+        DCEP_MESSAGE_DATA_CHANNEL_OPEN, /* Message Type: 0x03. */
+        DCEP_DATA_CHANNEL_RELIABLE,     /* Channel Type: 0x00. */
+        0x00, 0x00,                     /* Priority: 0. */
+        0x00, 0x00, 0x00, 0x00,         /* Reliability parameter: 0. */
+        0x00, 0x00,                     /* Channel name length: 0. */
+        0x00, 0x00,                     /* Protocol length: 0. */
+    };
+    size_t serializedMessageLength = sizeof( serializedMessage );
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandler ), 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_DeserializeAndRouteChannelOpenMessage( NULL, &( protocolTable ), &( serializedMessage[ 0 ] ), serializedMessageLength, &( deserializedMessage ), &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_DeserializeAndRouteChannelOpenMessage( &( ctx ), NULL, &( serializedMessage[ 0 ] ), serializedMessageLength, &( deserializedMessage ), &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_DeserializeAndRouteChannelOpenMessage( &( ctx ), &( protocolTable ), NULL, serializedMessageLength, &( deserializedMessage ), &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_DeserializeAndRouteChannelOpenMessage( &( ctx ), &( protocolTable ), &( serializedMessage[ 0 ] ), serializedMessageLength, NULL, &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_DeserializeAndRouteChannelOpenMessage( &( ctx ), &( protocolTable ), &( serializedMessage[ 0 ] ), serializedMessageLength, &( deserializedMessage ), NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_DeserializeAndRouteChannelOpenMessage( &( ctx ), &( protocolTable ), &( serializedMessage[ 0 ] ), DCEP_HEADER_LENGTH - 1, &( deserializedMessage ), &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    serializedMessage[ 0 ] = DCEP_MESSAGE_DATA_CHANNEL_ACK;
+    result = Dcep_DeserializeAndRouteChannelOpenMessage( &( ctx ), &( protocolTable ), &( serializedMessage[ 0 ] ), serializedMessageLength, &( deserializedMessage ), &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Label does not fit. */
+    serializedMessage[ 0 ] = DCEP_MESSAGE_DATA_CHANNEL_OPEN;
+    serializedMessage[ 9 ] = 0x01;
+    result = Dcep_DeserializeAndRouteChannelOpenMessage( &( ctx ), &( protocolTable ), &( serializedMessage[ 0 ] ), serializedMessageLength, &( deserializedMessage ), &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+    TEST_ASSERT_EQUAL( 0, handlerId );
+}
+
+/*-----------------------------------------------------------*/
+
+/* ==============================  Test Cases for Channel Open Views ============================== */
+
+/**
+ * @brief Validate that the view accessors return the same fields as
+ * Dcep_DeserializeChannelOpenMessage for every channel type.
+ */
+void test_dcepInitChannelOpenView_AllChannelTypes( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenView_t view;
+    DcepChannelOpenMessage_t channelOpenMessage, deserializedMessage;
+    uint8_t channelTypes[] =
+    {
+        DCEP_DATA_CHANNEL_RELIABLE,
+        DCEP_DATA_CHANNEL_RELIABLE_UNORDERED,
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT,
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED,
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED,
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED
+    };
+    const uint8_t * pField;
+    uint16_t fieldLength;
+    size_t bufferLength;
+    size_t i;
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    memcpy( &( channelNameBuffer[ 0 ] ), "label", 5 );
+    memcpy( &( protocolBuffer[ 0 ] ), "chat", 4 );
+
+    for( i = 0; i < sizeof( channelTypes ); i++ )
+    {
+        memset( &( channelOpenMessage ), 0, sizeof( channelOpenMessage ) );
+        channelOpenMessage.channelType = ( DcepChannelType_t ) channelTypes[ i ];
+        channelOpenMessage.priority = 0x1234;
+        channelOpenMessage.numRetransmissions = 0x01020304;
+        channelOpenMessage.maxLifetimeInMilliseconds = 0x05060708;
+        channelOpenMessage.pChannelName = &( channelNameBuffer[ 0 ] );
+        channelOpenMessage.channelNameLength = 5;
+        channelOpenMessage.pProtocol = &( protocolBuffer[ 0 ] );
+        channelOpenMessage.protocolLength = 4;
+
+        bufferLength = sizeof( testBuffer );
+        result = Dcep_SerializeChannelOpenMessage( &( ctx ), &( channelOpenMessage ), &( testBuffer[ 0 ] ), &( bufferLength ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+        result = Dcep_DeserializeChannelOpenMessage( &( ctx ), &( testBuffer[ 0 ] ), bufferLength, &( deserializedMessage ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+        result = Dcep_InitChannelOpenView( &( ctx ), &( testBuffer[ 0 ] ), bufferLength, &( view ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        TEST_ASSERT_EQUAL_PTR( &( testBuffer[ 0 ] ), view.pDcepMessage );
+
+        TEST_ASSERT_EQUAL( deserializedMessage.channelType, Dcep_ChannelOpenViewGetChannelType( &( view ) ) );
+        TEST_ASSERT_EQUAL( deserializedMessage.priority, Dcep_ChannelOpenViewGetPriority( &( view ) ) );
+        TEST_ASSERT_EQUAL( deserializedMessage.numRetransmissions, Dcep_ChannelOpenViewGetNumRetransmissions( &( view ) ) );
+        TEST_ASSERT_EQUAL( deserializedMessage.maxLifetimeInMilliseconds, Dcep_ChannelOpenViewGetMaxLifetimeInMilliseconds( &( view ) ) );
+
+        pField = Dcep_ChannelOpenViewGetChannelName( &( view ), &( fieldLength ) );
+        TEST_ASSERT_EQUAL_PTR( deserializedMessage.pChannelName, pField );
+        TEST_ASSERT_EQUAL( deserializedMessage.channelNameLength, fieldLength );
+
+        pField = Dcep_ChannelOpenViewGetProtocol( &( view ), &( fieldLength ) );
+        TEST_ASSERT_EQUAL_PTR( deserializedMessage.pProtocol, pField );
+        TEST_ASSERT_EQUAL( deserializedMessage.protocolLength, fieldLength );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the view returns NULL for an empty label and protocol.
+ */
+void test_dcepInitChannelOpenView_EmptyNameAndProtocol( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenView_t view;
+    uint8_t serializedMessage[] =
+    {
+        DCEP_MESSAGE_DATA_CHANNEL_OPEN, /* Message Type: 0x03. */
+        DCEP_DATA_CHANNEL_RELIABLE,     /* Channel Type: 0x00. */
+        0x00, 0x01,                     /* Priority: 1. */
+        0x00, 0x00, 0x00, 0x00,         /* Reliability parameter: 0. */
+        0x00, 0x00,                     /* Channel name length: 0. */
+        0x00, 0x00,                     /* Protocol length: 0. */
+    };
+    uint16_t fieldLength = 0xFFFF;
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_InitChannelOpenView( &( ctx ), &( serializedMessage[ 0 ] ), sizeof( serializedMessage ), &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    TEST_ASSERT_NULL( Dcep_ChannelOpenViewGetChannelName( &( view ), &( fieldLength ) ) );
+    TEST_ASSERT_EQUAL( 0, fieldLength );
+
+    fieldLength = 0xFFFF;
+    TEST_ASSERT_NULL( Dcep_ChannelOpenViewGetProtocol( &( view ), &( fieldLength ) ) );
+    TEST_ASSERT_EQUAL( 0, fieldLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_InitChannelOpenView with bad parameters.
+ */
+void test_dcepInitChannelOpenView_BadParams( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenView_t view;
+    uint8_t serializedMessage[] =
+    {
+        DCEP_MESSAGE_DATA_CHANNEL_OPEN, /* Message Type: 0x03. */
+        DCEP_DATA_CHANNEL_RELIABLE,     /* Channel Type: 0x00. */
+        0x00, 0x00,                     /* Priority: 0. */
+        0x00, 0x00, 0x00, 0x00,         /* Reliability parameter: 0. */
+        0x00, 0x00,                     /* Channel name length: 0. */
+        0x00, 0x00,                     /* Protocol length: 0. */
+    };
+    size_t serializedMessageLength = sizeof( serializedMessage );
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_InitChannelOpenView( NULL, &( serializedMessage[ 0 ] ), serializedMessageLength, &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_InitChannelOpenView( &( ctx ), NULL, serializedMessageLength, &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_InitChannelOpenView( &( ctx ), &( serializedMessage[ 0 ] ), serializedMessageLength, NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_InitChannelOpenView( &( ctx ), &( serializedMessage[ 0 ] ), DCEP_HEADER_LENGTH - 1, &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    serializedMessage[ 0 ] = DCEP_MESSAGE_DATA_CHANNEL_ACK;
+    result = Dcep_InitChannelOpenView( &( ctx ), &( serializedMessage[ 0 ] ), serializedMessageLength, &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Dcep_InitChannelOpenView rejects malformed messages
+ * and leaves the view untouched.
+ */
+void test_dcepInitChannelOpenView_MalformedMessage( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenView_t view = { NULL };
+    uint8_t serializedMessage[] =
+    {
+        DCEP_MESSAGE_DATA_CHANNEL_OPEN, /* Message Type: 0x03. */
+        0x03,                           /* Channel Type: invalid. */
+        0x00, 0x00,                     /* Priority: 0. */
+        0x00, 0x00, 0x00, 0x00,         /* Reliability parameter: 0. */
+        0x00, 0x02,                     /* Channel name length: 2. */
+        0x00, 0x02,                     /* Protocol length: 2. */
+        0x61, 0x62,                     /* Channel name: "ab". */
+        0x63, 0x64                      /* Protocol: "cd". */
+    };
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Invalid channel type. */
+    result = Dcep_InitChannelOpenView( &( ctx ), &( serializedMessage[ 0 ] ), sizeof( serializedMessage ), &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    /* Label does not fit. */
+    serializedMessage[ 1 ] = DCEP_DATA_CHANNEL_RELIABLE;
+    result = Dcep_InitChannelOpenView( &( ctx ), &( serializedMessage[ 0 ] ), DCEP_HEADER_LENGTH + 1, &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    /* Protocol does not fit. */
+    result = Dcep_InitChannelOpenView( &( ctx ), &( serializedMessage[ 0 ] ), sizeof( serializedMessage ) - 1, &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    TEST_ASSERT_NULL( view.pDcepMessage );
+}
+
+/*-----------------------------------------------------------*/
+
 /* ==============================  Test Cases for Message Type Detection ============================== */
 
 /**
@@ -1310,3 +1717,1478 @@ void test_dcepRoundTrip_PartialReliableRetransmit( void )
 }
 
 /*-----------------------------------------------------------*/
+
+/* ==============================  Test Cases for Scatter-Gather Channel Open Message Serialization ============================== */
+
+/**
+ * @brief Validate Dcep_SerializeChannelOpenMessageIoVec happy path.
+ */
+void test_dcepSerializeChannelOpenMessageIoVec( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage = { 0 };
+    uint8_t headerBuffer[ DCEP_HEADER_LENGTH ];
+    DcepIoVec_t ioVecs[ DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS ];
+    size_t ioVecCount = DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS;
+    uint8_t channelName[] = "test-channel";
+    uint8_t protocol[] = "test-protocol";
+
+    uint8_t expectedHeader[] =
+    {
+        DCEP_MESSAGE_DATA_CHANNEL_OPEN,                         /* Message Type: 0x03. */
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED,     /* Channel Type: 0x82. */
+        0x12, 0x34,                                             /* Priority: 0x1234. */
+        0x00, 0x00, 0x07, 0xD0,                                 /* maxLifetimeInMilliseconds: 2000. */
+        0x00, 0x0C,                                             /* Channel name length: 12. */
+        0x00, 0x0D,                                             /* Protocol length: 13. */
+    };
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    channelOpenMessage.channelType = DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED;
+    channelOpenMessage.priority = 0x1234;
+    channelOpenMessage.maxLifetimeInMilliseconds = 2000;
+    channelOpenMessage.pChannelName = &( channelName[ 0 ] );
+    channelOpenMessage.channelNameLength = sizeof( channelName ) - 1;
+    channelOpenMessage.pProtocol = &( protocol[ 0 ] );
+    channelOpenMessage.protocolLength = sizeof( protocol ) - 1;
+
+    result = Dcep_SerializeChannelOpenMessageIoVec( &( ctx ),
+                                                    &( channelOpenMessage ),
+                                                    &( headerBuffer[ 0 ] ),
+                                                    sizeof( headerBuffer ),
+                                                    &( ioVecs[ 0 ] ),
+                                                    &( ioVecCount ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, ioVecCount );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedHeader[ 0 ] ),
+                                   &( headerBuffer[ 0 ] ),
+                                   sizeof( expectedHeader ) );
+
+    /* Header. */
+    TEST_ASSERT_EQUAL_PTR( &( headerBuffer[ 0 ] ), ioVecs[ 0 ].pBase );
+    TEST_ASSERT_EQUAL( DCEP_HEADER_LENGTH, ioVecs[ 0 ].length );
+
+    /* Label and protocol are referenced, not copied. */
+    TEST_ASSERT_EQUAL_PTR( &( channelName[ 0 ] ), ioVecs[ 1 ].pBase );
+    TEST_ASSERT_EQUAL( sizeof( channelName ) - 1, ioVecs[ 1 ].length );
+    TEST_ASSERT_EQUAL_PTR( &( protocol[ 0 ] ), ioVecs[ 2 ].pBase );
+    TEST_ASSERT_EQUAL( sizeof( protocol ) - 1, ioVecs[ 2 ].length );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_SerializeChannelOpenMessageIoVec produces the same
+ * bytes as Dcep_SerializeChannelOpenMessage once gathered.
+ */
+void test_dcepSerializeChannelOpenMessageIoVec_MatchesFlatSerialization( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage = { 0 };
+    uint8_t headerBuffer[ DCEP_HEADER_LENGTH ];
+    uint8_t gatheredBuffer[ MAX_BUFFER_LENGTH ];
+    DcepIoVec_t ioVecs[ DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS ];
+    size_t ioVecCount = DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS;
+    size_t bufferLength = MAX_BUFFER_LENGTH;
+    size_t gatheredLength = 0;
+    size_t i;
+    uint8_t channelName[] = "chat";
+    uint8_t protocol[] = "json";
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    channelOpenMessage.channelType = DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT;
+    channelOpenMessage.priority = 0x0100;
+    channelOpenMessage.numRetransmissions = 3;
+    channelOpenMessage.pChannelName = &( channelName[ 0 ] );
+    channelOpenMessage.channelNameLength = sizeof( channelName ) - 1;
+    channelOpenMessage.pProtocol = &( protocol[ 0 ] );
+    channelOpenMessage.protocolLength = sizeof( protocol ) - 1;
+
+    result = Dcep_SerializeChannelOpenMessage( &( ctx ),
+                                               &( channelOpenMessage ),
+                                               &( testBuffer[ 0 ] ),
+                                               &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_SerializeChannelOpenMessageIoVec( &( ctx ),
+                                                    &( channelOpenMessage ),
+                                                    &( headerBuffer[ 0 ] ),
+                                                    sizeof( headerBuffer ),
+                                                    &( ioVecs[ 0 ] ),
+                                                    &( ioVecCount ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    for( i = 0; i < ioVecCount; i++ )
+    {
+        memcpy( &( gatheredBuffer[ gatheredLength ] ), ioVecs[ i ].pBase, ioVecs[ i ].length );
+        gatheredLength += ioVecs[ i ].length;
+    }
+
+    TEST_ASSERT_EQUAL( bufferLength, gatheredLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( testBuffer[ 0 ] ),
+                                   &( gatheredBuffer[ 0 ] ),
+                                   bufferLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_SerializeChannelOpenMessageIoVec with empty channel
+ * name and protocol.
+ */
+void test_dcepSerializeChannelOpenMessageIoVec_EmptyNameAndProtocol( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage = { 0 };
+    uint8_t headerBuffer[ DCEP_HEADER_LENGTH ];
+    DcepIoVec_t ioVecs[ DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS ];
+    size_t ioVecCount = DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS;
+
+    uint8_t expectedHeader[] =
+    {
+        DCEP_MESSAGE_DATA_CHANNEL_OPEN,     /* Message Type: 0x03. */
+        DCEP_DATA_CHANNEL_RELIABLE,         /* Channel Type: 0x00. */
+        0x00, 0x00,                         /* Priority: 0. */
+        0x00, 0x00, 0x00, 0x00,             /* Reliability param: 0. */
+        0x00, 0x00,                         /* Channel name length: 0. */
+        0x00, 0x00,                         /* Protocol length: 0. */
+    };
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    channelOpenMessage.channelType = DCEP_DATA_CHANNEL_RELIABLE;
+    channelOpenMessage.pChannelName = NULL;
+    channelOpenMessage.channelNameLength = 0;
+    channelOpenMessage.pProtocol = NULL;
+    channelOpenMessage.protocolLength = 0;
+
+    result = Dcep_SerializeChannelOpenMessageIoVec( &( ctx ),
+                                                    &( channelOpenMessage ),
+                                                    &( headerBuffer[ 0 ] ),
+                                                    sizeof( headerBuffer ),
+                                                    &( ioVecs[ 0 ] ),
+                                                    &( ioVecCount ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, ioVecCount );
+    TEST_ASSERT_EQUAL_PTR( &( headerBuffer[ 0 ] ), ioVecs[ 0 ].pBase );
+    TEST_ASSERT_EQUAL( DCEP_HEADER_LENGTH, ioVecs[ 0 ].length );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedHeader[ 0 ] ),
+                                   &( headerBuffer[ 0 ] ),
+                                   sizeof( expectedHeader ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_SerializeChannelOpenMessageIoVec with bad parameters.
+ */
+void test_dcepSerializeChannelOpenMessageIoVec_BadParams( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage = { 0 };
+    uint8_t headerBuffer[ DCEP_HEADER_LENGTH ];
+    DcepIoVec_t ioVecs[ DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS ];
+    size_t ioVecCount = DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS;
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Test with NULL context. */
+    result = Dcep_SerializeChannelOpenMessageIoVec( NULL,
+                                                    &( channelOpenMessage ),
+                                                    &( headerBuffer[ 0 ] ),
+                                                    sizeof( headerBuffer ),
+                                                    &( ioVecs[ 0 ] ),
+                                                    &( ioVecCount ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL channel open message. */
+    result = Dcep_SerializeChannelOpenMessageIoVec( &( ctx ),
+                                                    NULL,
+                                                    &( headerBuffer[ 0 ] ),
+                                                    sizeof( headerBuffer ),
+                                                    &( ioVecs[ 0 ] ),
+                                                    &( ioVecCount ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL header buffer. */
+    result = Dcep_SerializeChannelOpenMessageIoVec( &( ctx ),
+                                                    &( channelOpenMessage ),
+                                                    NULL,
+                                                    sizeof( headerBuffer ),
+                                                    &( ioVecs[ 0 ] ),
+                                                    &( ioVecCount ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with header buffer too small. */
+    result = Dcep_SerializeChannelOpenMessageIoVec( &( ctx ),
+                                                    &( channelOpenMessage ),
+                                                    &( headerBuffer[ 0 ] ),
+                                                    DCEP_HEADER_LENGTH - 1,
+                                                    &( ioVecs[ 0 ] ),
+                                                    &( ioVecCount ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL iovec array. */
+    result = Dcep_SerializeChannelOpenMessageIoVec( &( ctx ),
+                                                    &( channelOpenMessage ),
+                                                    &( headerBuffer[ 0 ] ),
+                                                    sizeof( headerBuffer ),
+                                                    NULL,
+                                                    &( ioVecCount ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL iovec count. */
+    result = Dcep_SerializeChannelOpenMessageIoVec( &( ctx ),
+                                                    &( channelOpenMessage ),
+                                                    &( headerBuffer[ 0 ] ),
+                                                    sizeof( headerBuffer ),
+                                                    &( ioVecs[ 0 ] ),
+                                                    NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with too few iovecs. */
+    ioVecCount = DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS - 1;
+    result = Dcep_SerializeChannelOpenMessageIoVec( &( ctx ),
+                                                    &( channelOpenMessage ),
+                                                    &( headerBuffer[ 0 ] ),
+                                                    sizeof( headerBuffer ),
+                                                    &( ioVecs[ 0 ] ),
+                                                    &( ioVecCount ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/* ==============================  Test Cases for Batch Deserialization ============================== */
+
+/**
+ * @brief Validate Dcep_DeserializeBatch with a mix of valid and invalid messages.
+ */
+void test_dcepDeserializeBatch( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepBatchEntry_t entries[ 7 ];
+    DcepBatchResult_t results[ 7 ];
+    uint8_t ackMessage[] = { DCEP_MESSAGE_DATA_CHANNEL_ACK };
+    uint8_t unknownMessage[] = { 0x05 };
+    uint8_t truncatedOpenMessage[] = { DCEP_MESSAGE_DATA_CHANNEL_OPEN, DCEP_DATA_CHANNEL_RELIABLE };
+    uint8_t openMessage[] =
+    {
+        DCEP_MESSAGE_DATA_CHANNEL_OPEN,                 /* Message Type: 0x03. */
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT,      /* Channel Type: 0x01. */
+        0x00, 0x10,                                     /* Priority: 16. */
+        0x00, 0x00, 0x00, 0x07,                         /* Retransmissions: 7. */
+        0x00, 0x04,                                     /* Channel name length: 4. */
+        0x00, 0x03,                                     /* Protocol length: 3. */
+        'c', 'h', 'a', 't',
+        'x', 'y', 'z'
+    };
+    uint8_t invalidChannelTypeMessage[] =
+    {
+        DCEP_MESSAGE_DATA_CHANNEL_OPEN,                 /* Message Type: 0x03. */
+        0x55,                                           /* Channel Type: invalid. */
+        0x00, 0x00,                                     /* Priority: 0. */
+        0x00, 0x00, 0x00, 0x00,                         /* Reliability param: 0. */
+        0x00, 0x00,                                     /* Channel name length: 0. */
+        0x00, 0x00,                                     /* Protocol length: 0. */
+    };
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    entries[ 0 ].pDcepMessage = &( openMessage[ 0 ] );
+    entries[ 0 ].dcepMessageLength = sizeof( openMessage );
+    entries[ 0 ].streamId = 2;
+
+    entries[ 1 ].pDcepMessage = &( ackMessage[ 0 ] );
+    entries[ 1 ].dcepMessageLength = sizeof( ackMessage );
+    entries[ 1 ].streamId = 4;
+
+    entries[ 2 ].pDcepMessage = &( unknownMessage[ 0 ] );
+    entries[ 2 ].dcepMessageLength = sizeof( unknownMessage );
+    entries[ 2 ].streamId = 6;
+
+    entries[ 3 ].pDcepMessage = &( truncatedOpenMessage[ 0 ] );
+    entries[ 3 ].dcepMessageLength = sizeof( truncatedOpenMessage );
+    entries[ 3 ].streamId = 8;
+
+    entries[ 4 ].pDcepMessage = &( invalidChannelTypeMessage[ 0 ] );
+    entries[ 4 ].dcepMessageLength = sizeof( invalidChannelTypeMessage );
+    entries[ 4 ].streamId = 10;
+
+    entries[ 5 ].pDcepMessage = NULL;
+    entries[ 5 ].dcepMessageLength = 1;
+    entries[ 5 ].streamId = 12;
+
+    entries[ 6 ].pDcepMessage = &( ackMessage[ 0 ] );
+    entries[ 6 ].dcepMessageLength = 0;
+    entries[ 6 ].streamId = 14;
+
+    result = Dcep_DeserializeBatch( &( ctx ),
+                                    &( entries[ 0 ] ),
+                                    7,
+                                    &( results[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, results[ 0 ].result );
+    TEST_ASSERT_EQUAL( 2, results[ 0 ].streamId );
+    TEST_ASSERT_EQUAL( DCEP_MESSAGE_DATA_CHANNEL_OPEN, results[ 0 ].messageType );
+    TEST_ASSERT_EQUAL( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT, results[ 0 ].channelOpenMessage.channelType );
+    TEST_ASSERT_EQUAL( 16, results[ 0 ].channelOpenMessage.priority );
+    TEST_ASSERT_EQUAL( 7, results[ 0 ].channelOpenMessage.numRetransmissions );
+    TEST_ASSERT_EQUAL( 4, results[ 0 ].channelOpenMessage.channelNameLength );
+    TEST_ASSERT_EQUAL_PTR( &( openMessage[ DCEP_HEADER_LENGTH ] ), results[ 0 ].channelOpenMessage.pChannelName );
+    TEST_ASSERT_EQUAL( 3, results[ 0 ].channelOpenMessage.protocolLength );
+    TEST_ASSERT_EQUAL_PTR( &( openMessage[ DCEP_HEADER_LENGTH + 4 ] ), results[ 0 ].channelOpenMessage.pProtocol );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, results[ 1 ].result );
+    TEST_ASSERT_EQUAL( 4, results[ 1 ].streamId );
+    TEST_ASSERT_EQUAL( DCEP_MESSAGE_DATA_CHANNEL_ACK, results[ 1 ].messageType );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, results[ 2 ].result );
+    TEST_ASSERT_EQUAL( 6, results[ 2 ].streamId );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, results[ 3 ].result );
+    TEST_ASSERT_EQUAL( 8, results[ 3 ].streamId );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, results[ 4 ].result );
+    TEST_ASSERT_EQUAL( 10, results[ 4 ].streamId );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, results[ 5 ].result );
+    TEST_ASSERT_EQUAL( 12, results[ 5 ].streamId );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, results[ 6 ].result );
+    TEST_ASSERT_EQUAL( 14, results[ 6 ].streamId );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_DeserializeBatch with bad parameters.
+ */
+void test_dcepDeserializeBatch_BadParams( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepBatchEntry_t entry;
+    DcepBatchResult_t entryResult;
+    uint8_t ackMessage[] = { DCEP_MESSAGE_DATA_CHANNEL_ACK };
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    entry.pDcepMessage = &( ackMessage[ 0 ] );
+    entry.dcepMessageLength = sizeof( ackMessage );
+    entry.streamId = 1;
+
+    /* Test with NULL context. */
+    result = Dcep_DeserializeBatch( NULL,
+                                    &( entry ),
+                                    1,
+                                    &( entryResult ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL entries. */
+    result = Dcep_DeserializeBatch( &( ctx ),
+                                    NULL,
+                                    1,
+                                    &( entryResult ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with zero entries. */
+    result = Dcep_DeserializeBatch( &( ctx ),
+                                    &( entry ),
+                                    0,
+                                    &( entryResult ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL results. */
+    result = Dcep_DeserializeBatch( &( ctx ),
+                                    &( entry ),
+                                    1,
+                                    NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_DeserializeBatch with more entries than fit in one
+ * header block.
+ */
+void test_dcepDeserializeBatch_MultipleBlocks( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepBatchEntry_t entries[ DCEP_HEADER_BLOCK_SIZE + 4 ];
+    DcepBatchResult_t results[ DCEP_HEADER_BLOCK_SIZE + 4 ];
+    uint8_t ackMessage[] = { DCEP_MESSAGE_DATA_CHANNEL_ACK };
+    uint8_t openMessage[] =
+    {
+        DCEP_MESSAGE_DATA_CHANNEL_OPEN,                         /* Message Type: 0x03. */
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED,     /* Channel Type: 0x82. */
+        0x01, 0x02,                                             /* Priority: 0x0102. */
+        0x00, 0x01, 0x00, 0x00,                                 /* maxLifetimeInMilliseconds: 65536. */
+        0x00, 0x00,                                             /* Channel name length: 0. */
+        0x00, 0x02,                                             /* Protocol length: 2. */
+        'p', 'q'
+    };
+    size_t i;
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    for( i = 0; i < ( DCEP_HEADER_BLOCK_SIZE + 4 ); i++ )
+    {
+        if( ( i % 3 ) == 0 )
+        {
+            entries[ i ].pDcepMessage = &( ackMessage[ 0 ] );
+            entries[ i ].dcepMessageLength = sizeof( ackMessage );
+        }
+        else
+        {
+            entries[ i ].pDcepMessage = &( openMessage[ 0 ] );
+            entries[ i ].dcepMessageLength = sizeof( openMessage );
+        }
+
+        entries[ i ].streamId = ( uint16_t ) i;
+    }
+
+    /* The length is only compared against, never used to read. */
+    entries[ 1 ].dcepMessageLength = SIZE_MAX;
+
+    result = Dcep_DeserializeBatch( &( ctx ),
+                                    &( entries[ 0 ] ),
+                                    DCEP_HEADER_BLOCK_SIZE + 4,
+                                    &( results[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    for( i = 0; i < ( DCEP_HEADER_BLOCK_SIZE + 4 ); i++ )
+    {
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, results[ i ].result );
+        TEST_ASSERT_EQUAL( i, results[ i ].streamId );
+
+        if( ( i % 3 ) == 0 )
+        {
+            TEST_ASSERT_EQUAL( DCEP_MESSAGE_DATA_CHANNEL_ACK, results[ i ].messageType );
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL( DCEP_MESSAGE_DATA_CHANNEL_OPEN, results[ i ].messageType );
+            TEST_ASSERT_EQUAL( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED, results[ i ].channelOpenMessage.channelType );
+            TEST_ASSERT_EQUAL( 0x0102, results[ i ].channelOpenMessage.priority );
+            TEST_ASSERT_EQUAL( 65536, results[ i ].channelOpenMessage.maxLifetimeInMilliseconds );
+            TEST_ASSERT_EQUAL( 0, results[ i ].channelOpenMessage.channelNameLength );
+            TEST_ASSERT_NULL( results[ i ].channelOpenMessage.pChannelName );
+            TEST_ASSERT_EQUAL( 2, results[ i ].channelOpenMessage.protocolLength );
+            TEST_ASSERT_EQUAL_PTR( &( openMessage[ DCEP_HEADER_LENGTH ] ), results[ i ].channelOpenMessage.pProtocol );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Dcep_DeserializeBatch decodes every channel type the
+ * same way as Dcep_DeserializeChannelOpenMessage.
+ */
+void test_dcepDeserializeBatch_MatchesSingleMessageDeserialization( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage = { 0 };
+    DcepChannelOpenMessage_t expectedMessage;
+    DcepBatchEntry_t entries[ 6 ];
+    DcepBatchResult_t results[ 6 ];
+    uint8_t serializedMessages[ 6 ][ 32 ];
+    uint8_t channelName[] = "label";
+    DcepChannelType_t channelTypes[] =
+    {
+        DCEP_DATA_CHANNEL_RELIABLE,
+        DCEP_DATA_CHANNEL_RELIABLE_UNORDERED,
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT,
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED,
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED,
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED
+    };
+    size_t bufferLength;
+    size_t i;
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    channelOpenMessage.priority = 0xBEEF;
+    channelOpenMessage.numRetransmissions = 11;
+    channelOpenMessage.maxLifetimeInMilliseconds = 22;
+    channelOpenMessage.pChannelName = &( channelName[ 0 ] );
+    channelOpenMessage.channelNameLength = sizeof( channelName ) - 1;
+
+    for( i = 0; i < 6; i++ )
+    {
+        channelOpenMessage.channelType = channelTypes[ i ];
+        bufferLength = sizeof( serializedMessages[ i ] );
+
+        result = Dcep_SerializeChannelOpenMessage( &( ctx ),
+                                                   &( channelOpenMessage ),
+                                                   &( serializedMessages[ i ][ 0 ] ),
+                                                   &( bufferLength ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+        entries[ i ].pDcepMessage = &( serializedMessages[ i ][ 0 ] );
+        entries[ i ].dcepMessageLength = bufferLength;
+        entries[ i ].streamId = ( uint16_t ) ( i * 2 );
+    }
+
+    memset( &( results[ 0 ] ), 0, sizeof( results ) );
+
+    result = Dcep_DeserializeBatch( &( ctx ),
+                                    &( entries[ 0 ] ),
+                                    6,
+                                    &( results[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    for( i = 0; i < 6; i++ )
+    {
+        memset( &( expectedMessage ), 0, sizeof( expectedMessage ) );
+
+        result = Dcep_DeserializeChannelOpenMessage( &( ctx ),
+                                                     entries[ i ].pDcepMessage,
+                                                     entries[ i ].dcepMessageLength,
+                                                     &( expectedMessage ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, results[ i ].result );
+        TEST_ASSERT_EQUAL( DCEP_MESSAGE_DATA_CHANNEL_OPEN, results[ i ].messageType );
+        TEST_ASSERT_EQUAL_MEMORY( &( expectedMessage ),
+                                  &( results[ i ].channelOpenMessage ),
+                                  sizeof( expectedMessage ) );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/* ==============================  Test Cases for Channel Open Message Length ============================== */
+
+/**
+ * @brief Validate Dcep_GetChannelOpenMessageLength returns the exact length
+ * needed by Dcep_SerializeChannelOpenMessage.
+ */
+void test_dcepGetChannelOpenMessageLength( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage = { 0 };
+    size_t messageLength = 0;
+    size_t bufferLength;
+    uint8_t channelName[] = "test-channel";
+    uint8_t protocol[] = "test-protocol";
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    channelOpenMessage.channelType = DCEP_DATA_CHANNEL_RELIABLE;
+    channelOpenMessage.pChannelName = &( channelName[ 0 ] );
+    channelOpenMessage.channelNameLength = sizeof( channelName ) - 1;
+    channelOpenMessage.pProtocol = &( protocol[ 0 ] );
+    channelOpenMessage.protocolLength = sizeof( protocol ) - 1;
+
+    result = Dcep_GetChannelOpenMessageLength( &( ctx ),
+                                               &( channelOpenMessage ),
+                                               &( messageLength ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_HEADER_LENGTH + ( sizeof( channelName ) - 1 ) + ( sizeof( protocol ) - 1 ),
+                       messageLength );
+
+    /* A buffer of exactly the returned length is sufficient. */
+    bufferLength = messageLength;
+    result = Dcep_SerializeChannelOpenMessage( &( ctx ),
+                                               &( channelOpenMessage ),
+                                               &( testBuffer[ 0 ] ),
+                                               &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( messageLength, bufferLength );
+
+    /* Maximum lengths do not overflow. */
+    channelOpenMessage.channelNameLength = UINT16_MAX;
+    channelOpenMessage.protocolLength = UINT16_MAX;
+
+    result = Dcep_GetChannelOpenMessageLength( &( ctx ),
+                                               &( channelOpenMessage ),
+                                               &( messageLength ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_HEADER_LENGTH + UINT16_MAX + UINT16_MAX, messageLength );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_GetChannelOpenMessageLength with bad parameters.
+ */
+void test_dcepGetChannelOpenMessageLength_BadParams( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage = { 0 };
+    size_t messageLength = 0;
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Test with NULL context. */
+    result = Dcep_GetChannelOpenMessageLength( NULL,
+                                               &( channelOpenMessage ),
+                                               &( messageLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL channel open message. */
+    result = Dcep_GetChannelOpenMessageLength( &( ctx ),
+                                               NULL,
+                                               &( messageLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL message length. */
+    result = Dcep_GetChannelOpenMessageLength( &( ctx ),
+                                               &( channelOpenMessage ),
+                                               NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_SerializeChannelOpenMessage does not write to the
+ * buffer when it is too small for the whole message.
+ */
+void test_dcepSerializeChannelOpenMessage_OutOfMemory_NoPartialWrite( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage = { 0 };
+    size_t bufferLength;
+    uint8_t channelName[] = "short";
+    uint8_t protocol[] = "very-long-protocol-name";
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    channelOpenMessage.channelType = DCEP_DATA_CHANNEL_RELIABLE;
+    channelOpenMessage.priority = 0x1234;
+    channelOpenMessage.pChannelName = &( channelName[ 0 ] );
+    channelOpenMessage.channelNameLength = sizeof( channelName ) - 1;
+    channelOpenMessage.pProtocol = &( protocol[ 0 ] );
+    channelOpenMessage.protocolLength = sizeof( protocol ) - 1;
+
+    bufferLength = DCEP_HEADER_LENGTH + ( sizeof( channelName ) - 1 ) + ( sizeof( protocol ) - 1 ) - 1;
+
+    result = Dcep_SerializeChannelOpenMessage( &( ctx ),
+                                               &( channelOpenMessage ),
+                                               &( testBuffer[ 0 ] ),
+                                               &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL( DCEP_HEADER_LENGTH + ( sizeof( channelName ) - 1 ) + ( sizeof( protocol ) - 1 ) - 1,
+                       bufferLength );
+    TEST_ASSERT_EACH_EQUAL_UINT8( 0,
+                                  &( testBuffer[ 0 ] ),
+                                  MAX_BUFFER_LENGTH );
+}
+
+/*-----------------------------------------------------------*/
+
+/* ==============================  Test Cases for Prepared Channel Open Messages ============================== */
+
+/**
+ * @brief Validate that a prepared message patched with new priority and
+ * reliability parameter matches a freshly serialized message for all
+ * channel types.
+ */
+void test_dcepSerializePreparedChannelOpenMessage( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage = { 0 };
+    DcepPreparedChannelOpenMessage_t preparedMessage;
+    uint8_t templateBuffer[ 64 ];
+    uint8_t expectedBuffer[ 64 ];
+    size_t expectedLength;
+    size_t bufferLength;
+    uint8_t channelName[] = "telemetry";
+    uint8_t protocol[] = "cbor";
+    DcepChannelType_t channelTypes[] =
+    {
+        DCEP_DATA_CHANNEL_RELIABLE,
+        DCEP_DATA_CHANNEL_RELIABLE_UNORDERED,
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT,
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED,
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED,
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED
+    };
+    size_t i;
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    channelOpenMessage.pChannelName = &( channelName[ 0 ] );
+    channelOpenMessage.channelNameLength = sizeof( channelName ) - 1;
+    channelOpenMessage.pProtocol = &( protocol[ 0 ] );
+    channelOpenMessage.protocolLength = sizeof( protocol ) - 1;
+
+    for( i = 0; i < ( sizeof( channelTypes ) / sizeof( channelTypes[ 0 ] ) ); i++ )
+    {
+        /* Prepare with one set of values. */
+        channelOpenMessage.channelType = channelTypes[ i ];
+        channelOpenMessage.priority = 1;
+        channelOpenMessage.numRetransmissions = 1;
+        channelOpenMessage.maxLifetimeInMilliseconds = 1;
+
+        result = Dcep_PrepareChannelOpenMessage( &( ctx ),
+                                                 &( channelOpenMessage ),
+                                                 &( templateBuffer[ 0 ] ),
+                                                 sizeof( templateBuffer ),
+                                                 &( preparedMessage ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+        /* Serialize from scratch with another set of values. */
+        channelOpenMessage.priority = 0x4321;
+        channelOpenMessage.numRetransmissions = 0x01020304;
+        channelOpenMessage.maxLifetimeInMilliseconds = 0x01020304;
+        expectedLength = sizeof( expectedBuffer );
+
+        result = Dcep_SerializeChannelOpenMessage( &( ctx ),
+                                                   &( channelOpenMessage ),
+                                                   &( expectedBuffer[ 0 ] ),
+                                                   &( expectedLength ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+        /* Patch the template with the same values. */
+        memset( &( testBuffer[ 0 ] ), 0xAA, sizeof( testBuffer ) );
+        bufferLength = MAX_BUFFER_LENGTH;
+
+        result = Dcep_SerializePreparedChannelOpenMessage( &( ctx ),
+                                                           &( preparedMessage ),
+                                                           0x4321,
+                                                           0x01020304,
+                                                           &( testBuffer[ 0 ] ),
+                                                           &( bufferLength ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( expectedLength, bufferLength );
+        TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedBuffer[ 0 ] ),
+                                       &( testBuffer[ 0 ] ),
+                                       expectedLength );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that serializing a prepared message does not modify the
+ * template.
+ */
+void test_dcepSerializePreparedChannelOpenMessage_TemplateUnchanged( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage = { 0 };
+    DcepPreparedChannelOpenMessage_t preparedMessage;
+    uint8_t templateBuffer[ DCEP_HEADER_LENGTH ];
+    uint8_t templateCopy[ DCEP_HEADER_LENGTH ];
+    size_t bufferLength = MAX_BUFFER_LENGTH;
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    channelOpenMessage.channelType = DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT;
+    channelOpenMessage.priority = 7;
+    channelOpenMessage.numRetransmissions = 9;
+
+    result = Dcep_PrepareChannelOpenMessage( &( ctx ),
+                                             &( channelOpenMessage ),
+                                             &( templateBuffer[ 0 ] ),
+                                             sizeof( templateBuffer ),
+                                             &( preparedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( templateBuffer[ 0 ] ), preparedMessage.pTemplate );
+    TEST_ASSERT_EQUAL( DCEP_HEADER_LENGTH, preparedMessage.templateLength );
+
+    memcpy( &( templateCopy[ 0 ] ), &( templateBuffer[ 0 ] ), sizeof( templateBuffer ) );
+
+    result = Dcep_SerializePreparedChannelOpenMessage( &( ctx ),
+                                                       &( preparedMessage ),
+                                                       100,
+                                                       200,
+                                                       &( testBuffer[ 0 ] ),
+                                                       &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( templateCopy[ 0 ] ),
+                                   &( templateBuffer[ 0 ] ),
+                                   sizeof( templateBuffer ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_PrepareChannelOpenMessage with bad parameters and a
+ * template buffer that is too small.
+ */
+void test_dcepPrepareChannelOpenMessage_BadParams( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage = { 0 };
+    DcepPreparedChannelOpenMessage_t preparedMessage;
+    uint8_t templateBuffer[ DCEP_HEADER_LENGTH + 2 ];
+    uint8_t channelName[] = "abc";
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    channelOpenMessage.channelType = DCEP_DATA_CHANNEL_RELIABLE;
+    channelOpenMessage.pChannelName = &( channelName[ 0 ] );
+    channelOpenMessage.channelNameLength = sizeof( channelName ) - 1;
+
+    /* Test with NULL prepared message. */
+    result = Dcep_PrepareChannelOpenMessage( &( ctx ),
+                                             &( channelOpenMessage ),
+                                             &( templateBuffer[ 0 ] ),
+                                             sizeof( templateBuffer ),
+                                             NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL context. */
+    result = Dcep_PrepareChannelOpenMessage( NULL,
+                                             &( channelOpenMessage ),
+                                             &( templateBuffer[ 0 ] ),
+                                             sizeof( templateBuffer ),
+                                             &( preparedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL channel open message. */
+    result = Dcep_PrepareChannelOpenMessage( &( ctx ),
+                                             NULL,
+                                             &( templateBuffer[ 0 ] ),
+                                             sizeof( templateBuffer ),
+                                             &( preparedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL template buffer. */
+    result = Dcep_PrepareChannelOpenMessage( &( ctx ),
+                                             &( channelOpenMessage ),
+                                             NULL,
+                                             sizeof( templateBuffer ),
+                                             &( preparedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with template buffer shorter than the header. */
+    result = Dcep_PrepareChannelOpenMessage( &( ctx ),
+                                             &( channelOpenMessage ),
+                                             &( templateBuffer[ 0 ] ),
+                                             DCEP_HEADER_LENGTH - 1,
+                                             &( preparedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with template buffer too small for the label. */
+    result = Dcep_PrepareChannelOpenMessage( &( ctx ),
+                                             &( channelOpenMessage ),
+                                             &( templateBuffer[ 0 ] ),
+                                             sizeof( templateBuffer ),
+                                             &( preparedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_SerializePreparedChannelOpenMessage with bad
+ * parameters and an output buffer that is too small.
+ */
+void test_dcepSerializePreparedChannelOpenMessage_BadParams( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage = { 0 };
+    DcepPreparedChannelOpenMessage_t preparedMessage;
+    DcepPreparedChannelOpenMessage_t invalidPreparedMessage;
+    uint8_t templateBuffer[ DCEP_HEADER_LENGTH ];
+    size_t bufferLength = MAX_BUFFER_LENGTH;
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    channelOpenMessage.channelType = DCEP_DATA_CHANNEL_RELIABLE;
+
+    result = Dcep_PrepareChannelOpenMessage( &( ctx ),
+                                             &( channelOpenMessage ),
+                                             &( templateBuffer[ 0 ] ),
+                                             sizeof( templateBuffer ),
+                                             &( preparedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Test with NULL context. */
+    result = Dcep_SerializePreparedChannelOpenMessage( NULL,
+                                                       &( preparedMessage ),
+                                                       0,
+                                                       0,
+                                                       &( testBuffer[ 0 ] ),
+                                                       &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL prepared message. */
+    result = Dcep_SerializePreparedChannelOpenMessage( &( ctx ),
+                                                       NULL,
+                                                       0,
+                                                       0,
+                                                       &( testBuffer[ 0 ] ),
+                                                       &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with prepared message without a template. */
+    invalidPreparedMessage = preparedMessage;
+    invalidPreparedMessage.pTemplate = NULL;
+    result = Dcep_SerializePreparedChannelOpenMessage( &( ctx ),
+                                                       &( invalidPreparedMessage ),
+                                                       0,
+                                                       0,
+                                                       &( testBuffer[ 0 ] ),
+                                                       &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with prepared message shorter than a header. */
+    invalidPreparedMessage = preparedMessage;
+    invalidPreparedMessage.templateLength = DCEP_HEADER_LENGTH - 1;
+    result = Dcep_SerializePreparedChannelOpenMessage( &( ctx ),
+                                                       &( invalidPreparedMessage ),
+                                                       0,
+                                                       0,
+                                                       &( testBuffer[ 0 ] ),
+                                                       &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL buffer. */
+    result = Dcep_SerializePreparedChannelOpenMessage( &( ctx ),
+                                                       &( preparedMessage ),
+                                                       0,
+                                                       0,
+                                                       NULL,
+                                                       &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL buffer length. */
+    result = Dcep_SerializePreparedChannelOpenMessage( &( ctx ),
+                                                       &( preparedMessage ),
+                                                       0,
+                                                       0,
+                                                       &( testBuffer[ 0 ] ),
+                                                       NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with buffer too small. */
+    bufferLength = DCEP_HEADER_LENGTH - 1;
+    result = Dcep_SerializePreparedChannelOpenMessage( &( ctx ),
+                                                       &( preparedMessage ),
+                                                       0,
+                                                       0,
+                                                       &( testBuffer[ 0 ] ),
+                                                       &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/* ==============================  Test Cases for Streaming Channel Open Message Deserialization ============================== */
+
+/**
+ * @brief Validate streaming deserialization when the whole message arrives
+ * in a single chunk followed by trailing bytes.
+ */
+void test_dcepStreamingParserFeed_SingleChunk( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepStreamingParser_t parser;
+    DcepStreamingParserOutput_t output;
+    uint8_t message[] = { 0x03, 0x01, 0x00, 0x10, 0x00, 0x00, 0x00, 0x05,
+                          0x00, 0x04, 0x00, 0x03, 't', 'e', 's', 't',
+                          'p', 'r', 'o', 0xAA, 0xBB };
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_STREAMING_PARSER_STATE_HEADER, parser.state );
+
+    result = Dcep_StreamingParserFeed( &( ctx ),
+                                       &( parser ),
+                                       &( message[ 0 ] ),
+                                       sizeof( message ),
+                                       &( output ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, output.headerDecoded );
+    TEST_ASSERT_EQUAL( 1, output.messageComplete );
+    TEST_ASSERT_EQUAL( sizeof( message ) - 2, output.consumedLength );
+    TEST_ASSERT_EQUAL_PTR( &( message[ 12 ] ), output.labelSegment.pBase );
+    TEST_ASSERT_EQUAL( 4, output.labelSegment.length );
+    TEST_ASSERT_EQUAL_PTR( &( message[ 16 ] ), output.protocolSegment.pBase );
+    TEST_ASSERT_EQUAL( 3, output.protocolSegment.length );
+
+    TEST_ASSERT_EQUAL( DCEP_STREAMING_PARSER_STATE_COMPLETE, parser.state );
+    TEST_ASSERT_EQUAL( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT, parser.channelOpenMessage.channelType );
+    TEST_ASSERT_EQUAL( 0x0010, parser.channelOpenMessage.priority );
+    TEST_ASSERT_EQUAL( 5, parser.channelOpenMessage.numRetransmissions );
+    TEST_ASSERT_EQUAL( 4, parser.channelOpenMessage.channelNameLength );
+    TEST_ASSERT_EQUAL( 3, parser.channelOpenMessage.protocolLength );
+    TEST_ASSERT_NULL( parser.channelOpenMessage.pChannelName );
+    TEST_ASSERT_NULL( parser.channelOpenMessage.pProtocol );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate streaming deserialization when the message arrives one
+ * byte at a time.
+ */
+void test_dcepStreamingParserFeed_ByteByByte( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepStreamingParser_t parser;
+    DcepStreamingParserOutput_t output;
+    uint8_t message[] = { 0x03, 0x02, 0x00, 0x20, 0x00, 0x00, 0x03, 0xE8,
+                          0x00, 0x04, 0x00, 0x03, 't', 'e', 's', 't',
+                          'p', 'r', 'o' };
+    uint8_t label[ 4 ];
+    uint8_t protocol[ 3 ];
+    size_t labelLength = 0, protocolLength = 0, i;
+    size_t headerDecodedCount = 0;
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    for( i = 0; i < sizeof( message ); i++ )
+    {
+        result = Dcep_StreamingParserFeed( &( ctx ),
+                                           &( parser ),
+                                           &( message[ i ] ),
+                                           1,
+                                           &( output ) );
+
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( 1, output.consumedLength );
+        TEST_ASSERT_EQUAL( ( i == sizeof( message ) - 1 ) ? 1 : 0, output.messageComplete );
+
+        headerDecodedCount += output.headerDecoded;
+
+        if( output.labelSegment.length > 0 )
+        {
+            TEST_ASSERT_EQUAL( 1, output.labelSegment.length );
+            label[ labelLength++ ] = output.labelSegment.pBase[ 0 ];
+        }
+
+        if( output.protocolSegment.length > 0 )
+        {
+            TEST_ASSERT_EQUAL( 1, output.protocolSegment.length );
+            protocol[ protocolLength++ ] = output.protocolSegment.pBase[ 0 ];
+        }
+    }
+
+    TEST_ASSERT_EQUAL( 1, headerDecodedCount );
+    TEST_ASSERT_EQUAL( 4, labelLength );
+    TEST_ASSERT_EQUAL( 3, protocolLength );
+    TEST_ASSERT_EQUAL_MEMORY( "test", &( label[ 0 ] ), 4 );
+    TEST_ASSERT_EQUAL_MEMORY( "pro", &( protocol[ 0 ] ), 3 );
+    TEST_ASSERT_EQUAL( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED, parser.channelOpenMessage.channelType );
+    TEST_ASSERT_EQUAL( 1000, parser.channelOpenMessage.maxLifetimeInMilliseconds );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate streaming deserialization when the header, label and
+ * protocol are each split across chunk boundaries.
+ */
+void test_dcepStreamingParserFeed_SplitChunks( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepStreamingParser_t parser;
+    DcepStreamingParserOutput_t output;
+    uint8_t message[] = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                          0x00, 0x04, 0x00, 0x03, 't', 'e', 's', 't',
+                          'p', 'r', 'o' };
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* First chunk contains part of the header. */
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( message[ 0 ] ), 5, &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, output.headerDecoded );
+    TEST_ASSERT_EQUAL( 5, output.consumedLength );
+    TEST_ASSERT_EQUAL( 0, output.labelSegment.length );
+    TEST_ASSERT_EQUAL( DCEP_STREAMING_PARSER_STATE_HEADER, parser.state );
+
+    /* Second chunk completes the header and contains part of the label. */
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( message[ 5 ] ), 9, &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, output.headerDecoded );
+    TEST_ASSERT_EQUAL( 9, output.consumedLength );
+    TEST_ASSERT_EQUAL_PTR( &( message[ 12 ] ), output.labelSegment.pBase );
+    TEST_ASSERT_EQUAL( 2, output.labelSegment.length );
+    TEST_ASSERT_EQUAL( 0, output.protocolSegment.length );
+    TEST_ASSERT_EQUAL( DCEP_STREAMING_PARSER_STATE_LABEL, parser.state );
+
+    /* Third chunk completes the label and contains part of the protocol. */
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( message[ 14 ] ), 3, &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, output.headerDecoded );
+    TEST_ASSERT_EQUAL_PTR( &( message[ 14 ] ), output.labelSegment.pBase );
+    TEST_ASSERT_EQUAL( 2, output.labelSegment.length );
+    TEST_ASSERT_EQUAL_PTR( &( message[ 16 ] ), output.protocolSegment.pBase );
+    TEST_ASSERT_EQUAL( 1, output.protocolSegment.length );
+    TEST_ASSERT_EQUAL( 0, output.messageComplete );
+    TEST_ASSERT_EQUAL( DCEP_STREAMING_PARSER_STATE_PROTOCOL, parser.state );
+
+    /* An empty chunk makes no progress. */
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( message[ 17 ] ), 0, &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, output.consumedLength );
+    TEST_ASSERT_EQUAL( 0, output.protocolSegment.length );
+
+    /* Last chunk completes the protocol. */
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( message[ 17 ] ), 2, &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( message[ 17 ] ), output.protocolSegment.pBase );
+    TEST_ASSERT_EQUAL( 2, output.protocolSegment.length );
+    TEST_ASSERT_EQUAL( 1, output.messageComplete );
+    TEST_ASSERT_EQUAL( DCEP_STREAMING_PARSER_STATE_COMPLETE, parser.state );
+    TEST_ASSERT_EQUAL( DCEP_DATA_CHANNEL_RELIABLE, parser.channelOpenMessage.channelType );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate streaming deserialization of a message with an empty
+ * label and protocol.
+ */
+void test_dcepStreamingParserFeed_EmptyNameAndProtocol( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepStreamingParser_t parser;
+    DcepStreamingParserOutput_t output;
+    uint8_t message[] = { 0x03, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                          0x00, 0x00, 0x00, 0x00 };
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( message[ 0 ] ), sizeof( message ), &( output ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, output.headerDecoded );
+    TEST_ASSERT_EQUAL( 1, output.messageComplete );
+    TEST_ASSERT_EQUAL( sizeof( message ), output.consumedLength );
+    TEST_ASSERT_EQUAL( 0, output.labelSegment.length );
+    TEST_ASSERT_EQUAL( 0, output.protocolSegment.length );
+    TEST_ASSERT_EQUAL( DCEP_DATA_CHANNEL_RELIABLE_UNORDERED, parser.channelOpenMessage.channelType );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate streaming deserialization of malformed headers.
+ */
+void test_dcepStreamingParserFeed_MalformedMessage( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepStreamingParser_t parser;
+    DcepStreamingParserOutput_t output;
+    uint8_t ackMessage[] = { 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                             0x00, 0x00, 0x00, 0x00 };
+    uint8_t invalidChannelTypeMessage[] = { 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                            0x00, 0x00, 0x00, 0x00 };
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Test with wrong message type. */
+    result = Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( ackMessage[ 0 ] ), sizeof( ackMessage ), &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+    TEST_ASSERT_EQUAL( DCEP_STREAMING_PARSER_STATE_ERROR, parser.state );
+
+    /* Feeding a parser in the error state is rejected. */
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( ackMessage[ 0 ] ), sizeof( ackMessage ), &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with invalid channel type. */
+    result = Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamingParserFeed( &( ctx ),
+                                       &( parser ),
+                                       &( invalidChannelTypeMessage[ 0 ] ),
+                                       sizeof( invalidChannelTypeMessage ),
+                                       &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+    TEST_ASSERT_EQUAL( DCEP_STREAMING_PARSER_STATE_ERROR, parser.state );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate streaming deserialization with bad parameters.
+ */
+void test_dcepStreamingParser_BadParams( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepStreamingParser_t parser;
+    DcepStreamingParserOutput_t output;
+    uint8_t message[] = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                          0x00, 0x00, 0x00, 0x00 };
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Test init with NULL context. */
+    result = Dcep_StreamingParserInit( NULL, &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test init with NULL parser. */
+    result = Dcep_StreamingParserInit( &( ctx ), NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Test feed with NULL context. */
+    result = Dcep_StreamingParserFeed( NULL, &( parser ), &( message[ 0 ] ), sizeof( message ), &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test feed with NULL parser. */
+    result = Dcep_StreamingParserFeed( &( ctx ), NULL, &( message[ 0 ] ), sizeof( message ), &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test feed with NULL chunk. */
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), NULL, sizeof( message ), &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test feed with NULL output. */
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( message[ 0 ] ), sizeof( message ), NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test feed after the message is complete. */
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( message[ 0 ] ), sizeof( message ), &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, output.messageComplete );
+
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( message[ 0 ] ), sizeof( message ), &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/* ==============================  Test Cases for Payload Classification ============================== */
+
+/**
+ * @brief Validate Dcep_ClassifyPayload for DCEP payloads.
+ */
+void test_dcepClassifyPayload_Dcep( void )
+{
+    uint8_t openMessage[] = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    uint8_t ackMessage[] = { 0x02 };
+    uint8_t unknownMessage[] = { 0x01 };
+    uint8_t largeMessageType[] = { 0xFF };
+
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_DATA_CHANNEL_OPEN,
+                       Dcep_ClassifyPayload( DCEP_PPID_DCEP, &( openMessage[ 0 ] ), sizeof( openMessage ) ) );
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_DATA_CHANNEL_ACK,
+                       Dcep_ClassifyPayload( DCEP_PPID_DCEP, &( ackMessage[ 0 ] ), sizeof( ackMessage ) ) );
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_INVALID,
+                       Dcep_ClassifyPayload( DCEP_PPID_DCEP, &( unknownMessage[ 0 ] ), sizeof( unknownMessage ) ) );
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_INVALID,
+                       Dcep_ClassifyPayload( DCEP_PPID_DCEP, &( largeMessageType[ 0 ] ), sizeof( largeMessageType ) ) );
+
+    /* Empty DCEP payloads. */
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_INVALID,
+                       Dcep_ClassifyPayload( DCEP_PPID_DCEP, &( ackMessage[ 0 ] ), 0 ) );
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_INVALID,
+                       Dcep_ClassifyPayload( DCEP_PPID_DCEP, NULL, sizeof( ackMessage ) ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ClassifyPayload for user data payloads.
+ */
+void test_dcepClassifyPayload_UserData( void )
+{
+    uint8_t payload[] = { 0x03, 'a', 'b' };
+    uint8_t emptyPayload[] = { 0x00 };
+
+    /* The first byte of user data does not matter. */
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_STRING,
+                       Dcep_ClassifyPayload( DCEP_PPID_STRING, &( payload[ 0 ] ), sizeof( payload ) ) );
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_STRING,
+                       Dcep_ClassifyPayload( DCEP_PPID_STRING, &( payload[ 1 ] ), sizeof( payload ) - 1 ) );
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_BINARY,
+                       Dcep_ClassifyPayload( DCEP_PPID_BINARY, &( payload[ 0 ] ), sizeof( payload ) ) );
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_BINARY,
+                       Dcep_ClassifyPayload( DCEP_PPID_BINARY, &( emptyPayload[ 0 ] ), sizeof( emptyPayload ) ) );
+
+    /* String and binary payloads cannot be empty. */
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_INVALID,
+                       Dcep_ClassifyPayload( DCEP_PPID_STRING, &( payload[ 0 ] ), 0 ) );
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_INVALID,
+                       Dcep_ClassifyPayload( DCEP_PPID_BINARY, NULL, 0 ) );
+
+    /* The payload of the empty PPIDs is ignored. */
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_STRING_EMPTY,
+                       Dcep_ClassifyPayload( DCEP_PPID_STRING_EMPTY, &( emptyPayload[ 0 ] ), sizeof( emptyPayload ) ) );
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_STRING_EMPTY,
+                       Dcep_ClassifyPayload( DCEP_PPID_STRING_EMPTY, NULL, 0 ) );
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_BINARY_EMPTY,
+                       Dcep_ClassifyPayload( DCEP_PPID_BINARY_EMPTY, &( emptyPayload[ 0 ] ), sizeof( emptyPayload ) ) );
+    TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_BINARY_EMPTY,
+                       Dcep_ClassifyPayload( DCEP_PPID_BINARY_EMPTY, NULL, 0 ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Dcep_ClassifyPayload rejects deprecated and unknown
+ * PPIDs.
+ */
+void test_dcepClassifyPayload_InvalidPpid( void )
+{
+    uint8_t ackMessage[] = { 0x02 };
+    uint32_t invalidPpids[] = { 0, 49, 52, 54, 55, 58, 0xFFFFFFFFUL };
+    size_t i;
+
+    for( i = 0; i < sizeof( invalidPpids ) / sizeof( invalidPpids[ 0 ] ); i++ )
+    {
+        TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_INVALID,
+                           Dcep_ClassifyPayload( invalidPpids[ i ], &( ackMessage[ 0 ] ), sizeof( ackMessage ) ) );
+        TEST_ASSERT_EQUAL( DCEP_PAYLOAD_CLASS_INVALID,
+                           Dcep_ClassifyPayload( invalidPpids[ i ], NULL, 0 ) );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/* ==============================  Test Cases for Wire Byte Descriptors ============================== */
+
+/**
+ * @brief Validate the descriptor of every wire byte.
+ */
+void test_dcepWireByteDescriptors( void )
+{
+    uint32_t wireByte;
+    uint8_t descriptor, expectedDescriptor;
+
+    for( wireByte = 0; wireByte < 256; wireByte++ )
+    {
+        descriptor = DCEP_GET_DESCRIPTOR( wireByte );
+
+        switch( wireByte )
+        {
+            case DCEP_DATA_CHANNEL_RELIABLE:
+                expectedDescriptor = DCEP_DESCRIPTOR_CHANNEL_TYPE_VALID;
+                break;
+
+            case DCEP_DATA_CHANNEL_RELIABLE_UNORDERED:
+                expectedDescriptor = DCEP_DESCRIPTOR_CHANNEL_TYPE_VALID | DCEP_DESCRIPTOR_UNORDERED;
+                break;
+
+            case DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT:
+                expectedDescriptor = DCEP_DESCRIPTOR_CHANNEL_TYPE_VALID | DCEP_DESCRIPTOR_REXMIT;
+                break;
+
+            case DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED:
+                expectedDescriptor = DCEP_DESCRIPTOR_CHANNEL_TYPE_VALID | DCEP_DESCRIPTOR_REXMIT | DCEP_DESCRIPTOR_UNORDERED;
+                break;
+
+            /* Also DCEP_MESSAGE_DATA_CHANNEL_ACK. */
+            case DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED:
+                expectedDescriptor = DCEP_DESCRIPTOR_CHANNEL_TYPE_VALID | DCEP_DESCRIPTOR_TIMED | DCEP_DESCRIPTOR_MESSAGE_TYPE_VALID;
+                break;
+
+            case DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED:
+                expectedDescriptor = DCEP_DESCRIPTOR_CHANNEL_TYPE_VALID | DCEP_DESCRIPTOR_TIMED | DCEP_DESCRIPTOR_UNORDERED;
+                break;
+
+            case DCEP_MESSAGE_DATA_CHANNEL_OPEN:
+                expectedDescriptor = DCEP_DESCRIPTOR_MESSAGE_TYPE_VALID;
+                break;
+
+            default:
+                expectedDescriptor = 0;
+                break;
+        }
+
+        TEST_ASSERT_EQUAL_HEX8( expectedDescriptor, descriptor );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that deserialization sets the reliability parameter that
+ * does not apply to the channel type to 0.
+ */
+void test_dcepDeserializeChannelOpenMessage_UnusedReliabilityParameter( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage;
+    uint8_t message[] = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00 };
+    uint8_t channelTypes[] = { 0x00, 0x80, 0x01, 0x81, 0x02, 0x82 };
+    size_t i;
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    for( i = 0; i < sizeof( channelTypes ); i++ )
+    {
+        message[ 1 ] = channelTypes[ i ];
+        memset( &( channelOpenMessage ), 0xFF, sizeof( channelOpenMessage ) );
+
+        result = Dcep_DeserializeChannelOpenMessage( &( ctx ), &( message[ 0 ] ), sizeof( message ), &( channelOpenMessage ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+        TEST_ASSERT_EQUAL( ( ( channelTypes[ i ] & 0x7F ) == 0x01 ) ? 256 : 0, channelOpenMessage.numRetransmissions );
+        TEST_ASSERT_EQUAL( ( ( channelTypes[ i ] & 0x7F ) == 0x02 ) ? 256 : 0, channelOpenMessage.maxLifetimeInMilliseconds );
+    }
+}
+
+/*-----------------------------------------------------------*/
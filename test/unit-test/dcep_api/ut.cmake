@@ -81,3 +81,39 @@ create_test(${utest_name}
             "${test_include_directories}"
         )
 
+
+# ===============  Compile-time endianness variant of the same tests  ===============
+
+include( TestBigEndian )
+test_big_endian( DCEP_IS_BIG_ENDIAN )
+
+if( DCEP_IS_BIG_ENDIAN )
+    set( static_endianness_define "DCEP_HOST_ENDIANNESS=DCEP_ENDIANNESS_BIG" )
+else()
+    set( static_endianness_define "DCEP_HOST_ENDIANNESS=DCEP_ENDIANNESS_LITTLE" )
+endif()
+
+set(static_endianness_real_name "${project_name}_static_endianness_real")
+
+create_real_library(${static_endianness_real_name}
+                    "${real_source_files}"
+                    "${real_include_directories}"
+                    "${mock_dependency}"
+        )
+
+target_compile_definitions(${static_endianness_real_name} PUBLIC
+                           ${static_endianness_define}
+        )
+
+set(static_endianness_utest_name "${project_name}_static_endianness_utest")
+
+create_test(${static_endianness_utest_name}
+            ${utest_source}
+            "lib${static_endianness_real_name}.a"
+            "${static_endianness_real_name}"
+            "${test_include_directories}"
+        )
+
+target_compile_definitions(${static_endianness_utest_name} PUBLIC
+                           ${static_endianness_define}
+        )
@@ -0,0 +1,249 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "dcep_api.h"
+#include "dcep_arena.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define ARENA_MEMORY_LENGTH    16
+
+uint8_t arenaMemory[ ARENA_MEMORY_LENGTH ];
+DcepArena_t arena;
+
+void setUp( void )
+{
+    DcepResult_t result;
+
+    memset( &( arenaMemory[ 0 ] ), 0xA5, sizeof( arenaMemory ) );
+
+    result = Dcep_ArenaInit( &( arena ), &( arenaMemory[ 0 ] ), sizeof( arenaMemory ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases for Initialization ============================== */
+
+/**
+ * @brief Validate Dcep_ArenaInit with bad parameters.
+ */
+void test_dcepArenaInit_BadParams( void )
+{
+    DcepResult_t result;
+
+    result = Dcep_ArenaInit( NULL, &( arenaMemory[ 0 ] ), sizeof( arenaMemory ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ArenaInit( &( arena ), NULL, sizeof( arenaMemory ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* An empty arena does not need memory. */
+    result = Dcep_ArenaInit( &( arena ), NULL, 0 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, arena.size );
+    TEST_ASSERT_EQUAL( 0, arena.used );
+}
+
+/* ==============================  Test Cases for Allocation ============================== */
+
+/**
+ * @brief Validate that allocations are carved out of the slab in order until
+ * it is full, and that Dcep_ArenaReset releases all of them.
+ */
+void test_dcepArenaAllocate( void )
+{
+    DcepResult_t result;
+    uint8_t * pAllocation = NULL;
+
+    result = Dcep_ArenaAllocate( &( arena ), 10, &( pAllocation ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( arenaMemory[ 0 ] ), pAllocation );
+
+    result = Dcep_ArenaAllocate( &( arena ), 6, &( pAllocation ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( arenaMemory[ 10 ] ), pAllocation );
+    TEST_ASSERT_EQUAL( ARENA_MEMORY_LENGTH, arena.used );
+
+    pAllocation = NULL;
+    result = Dcep_ArenaAllocate( &( arena ), 1, &( pAllocation ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_NULL( pAllocation );
+
+    result = Dcep_ArenaReset( &( arena ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, arena.used );
+
+    result = Dcep_ArenaAllocate( &( arena ), ARENA_MEMORY_LENGTH, &( pAllocation ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( arenaMemory[ 0 ] ), pAllocation );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ArenaAllocate and Dcep_ArenaReset with bad parameters.
+ */
+void test_dcepArenaAllocate_BadParams( void )
+{
+    DcepResult_t result;
+    uint8_t * pAllocation = NULL;
+
+    result = Dcep_ArenaAllocate( NULL, 1, &( pAllocation ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ArenaAllocate( &( arena ), 1, NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ArenaReset( NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/* ==============================  Test Cases for Message Copies ============================== */
+
+/**
+ * @brief Validate that a deserialized message no longer refers to the
+ * received buffer once copied into the arena.
+ */
+void test_dcepArenaCopyChannelOpenMessage( void )
+{
+    DcepResult_t result;
+    DcepContext_t ctx;
+    DcepChannelOpenMessage_t channelOpenMessage, copiedMessage;
+    uint8_t receiveBuffer[] =
+    {
+        DCEP_MESSAGE_DATA_CHANNEL_OPEN,            /* Message Type: 0x03. */
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT, /* Channel Type: 0x01. */
+        0x12, 0x34,                                /* Priority: 0x1234. */
+        0x00, 0x00, 0x00, 0x05,                    /* Reliability parameter: 5. */
+        0x00, 0x04,                                /* Channel name length: 4. */
+        0x00, 0x04,                                /* Protocol length: 4. */
+        0x74, 0x65, 0x73, 0x74,                    /* Channel name: "test". */
+        0x63, 0x68, 0x61, 0x74                     /* Protocol: "chat". */
+    };
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_DeserializeChannelOpenMessage( &( ctx ), &( receiveBuffer[ 0 ] ), sizeof( receiveBuffer ), &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_ArenaCopyChannelOpenMessage( &( arena ), &( channelOpenMessage ), &( copiedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 8, arena.used );
+
+    /* Recycle the receive buffer. */
+    memset( &( receiveBuffer[ 0 ] ), 0, sizeof( receiveBuffer ) );
+
+    TEST_ASSERT_EQUAL( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT, copiedMessage.channelType );
+    TEST_ASSERT_EQUAL( 0x1234, copiedMessage.priority );
+    TEST_ASSERT_EQUAL( 5, copiedMessage.numRetransmissions );
+    TEST_ASSERT_EQUAL_PTR( &( arenaMemory[ 0 ] ), copiedMessage.pChannelName );
+    TEST_ASSERT_EQUAL( 4, copiedMessage.channelNameLength );
+    TEST_ASSERT_EQUAL_MEMORY( "test", copiedMessage.pChannelName, 4 );
+    TEST_ASSERT_EQUAL_PTR( &( arenaMemory[ 4 ] ), copiedMessage.pProtocol );
+    TEST_ASSERT_EQUAL( 4, copiedMessage.protocolLength );
+    TEST_ASSERT_EQUAL_MEMORY( "chat", copiedMessage.pProtocol, 4 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate an in-place copy and that empty fields stay NULL without
+ * using arena space.
+ */
+void test_dcepArenaCopyChannelOpenMessage_InPlace( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t channelOpenMessage;
+    uint8_t channelName[] = { 'a', 'b', 'c' };
+
+    memset( &( channelOpenMessage ), 0, sizeof( channelOpenMessage ) );
+    channelOpenMessage.pChannelName = &( channelName[ 0 ] );
+    channelOpenMessage.channelNameLength = sizeof( channelName );
+
+    result = Dcep_ArenaCopyChannelOpenMessage( &( arena ), &( channelOpenMessage ), &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( &( arenaMemory[ 0 ] ), channelOpenMessage.pChannelName );
+    TEST_ASSERT_EQUAL_MEMORY( "abc", channelOpenMessage.pChannelName, 3 );
+    TEST_ASSERT_NULL( channelOpenMessage.pProtocol );
+    TEST_ASSERT_EQUAL( 3, arena.used );
+
+    channelOpenMessage.pChannelName = NULL;
+    channelOpenMessage.channelNameLength = 0;
+
+    result = Dcep_ArenaCopyChannelOpenMessage( &( arena ), &( channelOpenMessage ), &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_NULL( channelOpenMessage.pChannelName );
+    TEST_ASSERT_NULL( channelOpenMessage.pProtocol );
+    TEST_ASSERT_EQUAL( 3, arena.used );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a copy that does not fit leaves the arena and the
+ * destination unchanged.
+ */
+void test_dcepArenaCopyChannelOpenMessage_OutOfMemory( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t channelOpenMessage, copiedMessage, untouchedMessage;
+    uint8_t field[ ARENA_MEMORY_LENGTH ] = { 0 };
+
+    memset( &( channelOpenMessage ), 0, sizeof( channelOpenMessage ) );
+    channelOpenMessage.pChannelName = &( field[ 0 ] );
+    channelOpenMessage.channelNameLength = ARENA_MEMORY_LENGTH / 2;
+    channelOpenMessage.pProtocol = &( field[ 0 ] );
+    channelOpenMessage.protocolLength = ( ARENA_MEMORY_LENGTH / 2 ) + 1;
+
+    memset( &( copiedMessage ), 0x5A, sizeof( copiedMessage ) );
+    memcpy( &( untouchedMessage ), &( copiedMessage ), sizeof( copiedMessage ) );
+
+    result = Dcep_ArenaCopyChannelOpenMessage( &( arena ), &( channelOpenMessage ), &( copiedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL( 0, arena.used );
+    TEST_ASSERT_EQUAL_MEMORY( &( untouchedMessage ), &( copiedMessage ), sizeof( copiedMessage ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ArenaCopyChannelOpenMessage with bad parameters.
+ */
+void test_dcepArenaCopyChannelOpenMessage_BadParams( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t channelOpenMessage, copiedMessage;
+
+    memset( &( channelOpenMessage ), 0, sizeof( channelOpenMessage ) );
+
+    result = Dcep_ArenaCopyChannelOpenMessage( NULL, &( channelOpenMessage ), &( copiedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ArenaCopyChannelOpenMessage( &( arena ), NULL, &( copiedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ArenaCopyChannelOpenMessage( &( arena ), &( channelOpenMessage ), NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    channelOpenMessage.channelNameLength = 1;
+    result = Dcep_ArenaCopyChannelOpenMessage( &( arena ), &( channelOpenMessage ), &( copiedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    channelOpenMessage.channelNameLength = 0;
+    channelOpenMessage.protocolLength = 1;
+    result = Dcep_ArenaCopyChannelOpenMessage( &( arena ), &( channelOpenMessage ), &( copiedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    TEST_ASSERT_EQUAL( 0, arena.used );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,240 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "dcep_channel_pool.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define POOL_CAPACITY        4
+
+/* Room for the pool, one block in front of it and alignment to a cache
+ * line. */
+#define POOL_MEMORY_LENGTH   ( ( POOL_CAPACITY + 1 ) * 4 * DCEP_CACHE_LINE_SIZE )
+
+uint8_t poolMemory[ POOL_MEMORY_LENGTH ];
+uint8_t * pAlignedMemory;
+DcepChannelPool_t pool;
+
+void setUp( void )
+{
+    memset( &( poolMemory[ 0 ] ), 0xA5, sizeof( poolMemory ) );
+    memset( &( pool ), 0, sizeof( pool ) );
+
+    /* Leave one block in front of the pool to test pointers before it. */
+    pAlignedMemory = &( poolMemory[ DCEP_CHANNEL_POOL_BLOCK_SIZE +
+                                    ( ( DCEP_CACHE_LINE_SIZE - ( ( uintptr_t ) &( poolMemory[ 0 ] ) % DCEP_CACHE_LINE_SIZE ) ) % DCEP_CACHE_LINE_SIZE ) ] );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Helpers ============================== */
+
+static void InitPool( void )
+{
+    DcepResult_t result;
+    size_t memorySize = 0;
+
+    result = Dcep_ChannelPoolGetMemorySize( POOL_CAPACITY, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_ChannelPoolInit( &( pool ), pAlignedMemory, memorySize, POOL_CAPACITY );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+}
+
+/* ==============================  Test Cases for Initialization ============================== */
+
+/**
+ * @brief Validate that blocks are whole cache lines.
+ */
+void test_dcepChannelPoolGetMemorySize( void )
+{
+    DcepResult_t result;
+    size_t memorySize = 0;
+
+    TEST_ASSERT_EQUAL( 0, DCEP_CHANNEL_POOL_BLOCK_SIZE % DCEP_CACHE_LINE_SIZE );
+    TEST_ASSERT_GREATER_OR_EQUAL( sizeof( DcepChannel_t ), DCEP_CHANNEL_POOL_BLOCK_SIZE );
+    TEST_ASSERT_LESS_THAN( sizeof( DcepChannel_t ) + DCEP_CACHE_LINE_SIZE, DCEP_CHANNEL_POOL_BLOCK_SIZE );
+
+    result = Dcep_ChannelPoolGetMemorySize( 10, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 10 * DCEP_CHANNEL_POOL_BLOCK_SIZE, memorySize );
+
+    result = Dcep_ChannelPoolGetMemorySize( DCEP_CHANNEL_POOL_MAX_CAPACITY, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ChannelPoolGetMemorySize and Dcep_ChannelPoolInit
+ * with bad parameters.
+ */
+void test_dcepChannelPoolInit_BadParams( void )
+{
+    DcepResult_t result;
+    size_t memorySize = 0;
+
+    result = Dcep_ChannelPoolGetMemorySize( POOL_CAPACITY, NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ChannelPoolGetMemorySize( 0, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ChannelPoolGetMemorySize( DCEP_CHANNEL_POOL_MAX_CAPACITY + 1, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ChannelPoolInit( NULL, pAlignedMemory, POOL_MEMORY_LENGTH / 2, POOL_CAPACITY );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ChannelPoolInit( &( pool ), NULL, POOL_MEMORY_LENGTH / 2, POOL_CAPACITY );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Memory not aligned to a cache line. */
+    result = Dcep_ChannelPoolInit( &( pool ), pAlignedMemory + 8, POOL_MEMORY_LENGTH / 2, POOL_CAPACITY );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ChannelPoolInit( &( pool ), pAlignedMemory, POOL_MEMORY_LENGTH / 2, 0 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Dcep_ChannelPoolInit fails up front when the memory
+ * cannot hold the requested capacity.
+ */
+void test_dcepChannelPoolInit_OutOfMemory( void )
+{
+    DcepResult_t result;
+
+    result = Dcep_ChannelPoolInit( &( pool ), pAlignedMemory, ( POOL_CAPACITY * DCEP_CHANNEL_POOL_BLOCK_SIZE ) - 1, POOL_CAPACITY );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+}
+
+/* ==============================  Test Cases for Allocation ============================== */
+
+/**
+ * @brief Validate that every block can be allocated, that blocks are cache
+ * line aligned and zeroed, and that allocation fails once the pool is empty.
+ */
+void test_dcepChannelPoolAllocate( void )
+{
+    DcepResult_t result;
+    DcepChannel_t * pChannels[ POOL_CAPACITY ];
+    DcepChannel_t * pChannel = NULL;
+    size_t i;
+
+    InitPool();
+    TEST_ASSERT_EQUAL( POOL_CAPACITY, pool.freeCount );
+
+    for( i = 0; i < POOL_CAPACITY; i++ )
+    {
+        result = Dcep_ChannelPoolAllocate( &( pool ), &( pChannels[ i ] ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        TEST_ASSERT_EQUAL_PTR( pAlignedMemory + ( i * DCEP_CHANNEL_POOL_BLOCK_SIZE ), pChannels[ i ] );
+        TEST_ASSERT_EQUAL( 0, ( uintptr_t ) pChannels[ i ] % DCEP_CACHE_LINE_SIZE );
+        TEST_ASSERT_EQUAL( DCEP_CHANNEL_STATE_CLOSED, pChannels[ i ]->state );
+        TEST_ASSERT_EQUAL( 0, pChannels[ i ]->streamId );
+        TEST_ASSERT_NULL( pChannels[ i ]->channelOpenMessage.pChannelName );
+    }
+
+    TEST_ASSERT_EQUAL( 0, pool.freeCount );
+
+    result = Dcep_ChannelPoolAllocate( &( pool ), &( pChannel ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_NULL( pChannel );
+
+    /* The most recently freed block is reused first. */
+    result = Dcep_ChannelPoolFree( &( pool ), pChannels[ 2 ] );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, pool.freeCount );
+
+    pChannels[ 2 ]->streamId = 7;
+
+    result = Dcep_ChannelPoolAllocate( &( pool ), &( pChannel ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_PTR( pChannels[ 2 ], pChannel );
+    TEST_ASSERT_EQUAL( 0, pChannel->streamId );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ChannelPoolAllocate with bad parameters.
+ */
+void test_dcepChannelPoolAllocate_BadParams( void )
+{
+    DcepResult_t result;
+    DcepChannel_t * pChannel = NULL;
+
+    InitPool();
+
+    result = Dcep_ChannelPoolAllocate( NULL, &( pChannel ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ChannelPoolAllocate( &( pool ), NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    TEST_ASSERT_EQUAL( POOL_CAPACITY, pool.freeCount );
+}
+
+/* ==============================  Test Cases for Free ============================== */
+
+/**
+ * @brief Validate that Dcep_ChannelPoolFree rejects pointers that are not
+ * blocks of the pool and blocks that are already free.
+ */
+void test_dcepChannelPoolFree_BadParams( void )
+{
+    DcepResult_t result;
+    DcepChannel_t * pChannel = NULL;
+    DcepChannel_t outsideChannel;
+
+    InitPool();
+
+    result = Dcep_ChannelPoolAllocate( &( pool ), &( pChannel ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_ChannelPoolFree( NULL, pChannel );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ChannelPoolFree( &( pool ), NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ChannelPoolFree( &( pool ), &( outsideChannel ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Before the first block. */
+    result = Dcep_ChannelPoolFree( &( pool ), ( DcepChannel_t * ) ( pAlignedMemory - DCEP_CHANNEL_POOL_BLOCK_SIZE ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Past the last block. */
+    result = Dcep_ChannelPoolFree( &( pool ), ( DcepChannel_t * ) ( pAlignedMemory + ( POOL_CAPACITY * DCEP_CHANNEL_POOL_BLOCK_SIZE ) ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Inside a block. */
+    result = Dcep_ChannelPoolFree( &( pool ), ( DcepChannel_t * ) ( pAlignedMemory + 8 ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Block that was never allocated. */
+    result = Dcep_ChannelPoolFree( &( pool ), ( DcepChannel_t * ) ( pAlignedMemory + DCEP_CHANNEL_POOL_BLOCK_SIZE ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_INVALID_STATE, result );
+
+    result = Dcep_ChannelPoolFree( &( pool ), pChannel );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Double free. */
+    result = Dcep_ChannelPoolFree( &( pool ), pChannel );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_INVALID_STATE, result );
+
+    TEST_ASSERT_EQUAL( POOL_CAPACITY, pool.freeCount );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,764 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "dcep_channel_registry.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+/* Large enough for a registry of DCEP_CHANNEL_REGISTRY_MAX_CAPACITY. */
+#define REGISTRY_MEMORY_WORDS    ( ( DCEP_CHANNEL_REGISTRY_MAX_CAPACITY * 48 ) / sizeof( uint64_t ) )
+
+#define NUM_LABELS               15
+#define MAX_LABEL_LENGTH         16
+
+uint64_t registryMemory[ REGISTRY_MEMORY_WORDS ];
+uint32_t labelIndexMemory[ 2 * DCEP_CHANNEL_REGISTRY_MAX_CAPACITY ];
+uint8_t labels[ NUM_LABELS ][ MAX_LABEL_LENGTH ];
+DcepChannelRegistry_t registry;
+DcepChannelOpenMessage_t channelOpenMessage;
+
+void setUp( void )
+{
+    memset( &( registryMemory[ 0 ] ), 0xA5, sizeof( registryMemory ) );
+    memset( &( registry ), 0, sizeof( registry ) );
+    memset( &( channelOpenMessage ), 0, sizeof( channelOpenMessage ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Helpers ============================== */
+
+static void InitRegistry( size_t capacity )
+{
+    DcepResult_t result;
+
+    result = Dcep_ChannelRegistryInit( &( registry ),
+                                       &( registryMemory[ 0 ] ),
+                                       sizeof( registryMemory ),
+                                       capacity );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+}
+
+static void EnableLabelIndex( void )
+{
+    DcepResult_t result;
+
+    result = Dcep_ChannelRegistryEnableLabelIndex( &( registry ),
+                                                   &( labelIndexMemory[ 0 ] ),
+                                                   sizeof( labelIndexMemory ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+}
+
+/* Inserts channel i with stream id streamId and label "label-i". */
+static void InsertLabeledChannel( size_t i,
+                                  uint16_t streamId )
+{
+    DcepResult_t result;
+    int length;
+
+    length = snprintf( ( char * ) &( labels[ i ][ 0 ] ), MAX_LABEL_LENGTH, "label-%u", ( unsigned int ) i );
+
+    channelOpenMessage.pChannelName = &( labels[ i ][ 0 ] );
+    channelOpenMessage.channelNameLength = ( uint16_t ) length;
+
+    result = Dcep_ChannelRegistryInsert( &( registry ), streamId, DCEP_CHANNEL_STATE_OPEN, &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+}
+
+static DcepResult_t FindByLabel( size_t i,
+                                 uint16_t * pStreamId )
+{
+    return Dcep_ChannelRegistryFindByLabel( &( registry ),
+                                            &( labels[ i ][ 0 ] ),
+                                            strlen( ( const char * ) &( labels[ i ][ 0 ] ) ),
+                                            pStreamId );
+}
+
+/* ==============================  Test Cases for Initialization ============================== */
+
+/**
+ * @brief Validate Dcep_ChannelRegistryGetMemorySize happy path.
+ */
+void test_dcepChannelRegistryGetMemorySize( void )
+{
+    DcepResult_t result;
+    size_t memorySize = 0;
+
+    result = Dcep_ChannelRegistryGetMemorySize( 64, &( memorySize ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 64 * ( sizeof( DcepChannelRegistryLabel_t ) + 10 ), memorySize );
+
+    result = Dcep_ChannelRegistryGetMemorySize( DCEP_CHANNEL_REGISTRY_MAX_CAPACITY, &( memorySize ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_LESS_OR_EQUAL( sizeof( registryMemory ), memorySize );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ChannelRegistryGetMemorySize with bad parameters.
+ */
+void test_dcepChannelRegistryGetMemorySize_BadParams( void )
+{
+    DcepResult_t result;
+    size_t memorySize = 0;
+
+    /* Test with NULL memory size. */
+    result = Dcep_ChannelRegistryGetMemorySize( 64, NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with capacity too small. */
+    result = Dcep_ChannelRegistryGetMemorySize( 1, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with capacity too large. */
+    result = Dcep_ChannelRegistryGetMemorySize( DCEP_CHANNEL_REGISTRY_MAX_CAPACITY * 2, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with capacity not a power of two. */
+    result = Dcep_ChannelRegistryGetMemorySize( 48, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ChannelRegistryInit happy path.
+ */
+void test_dcepChannelRegistryInit( void )
+{
+    size_t i;
+
+    InitRegistry( 16 );
+
+    TEST_ASSERT_EQUAL( 16, registry.capacity );
+    TEST_ASSERT_EQUAL( 0, registry.count );
+    TEST_ASSERT_EQUAL( 12, registry.hashShift );
+
+    for( i = 0; i < registry.capacity; i++ )
+    {
+        TEST_ASSERT_EQUAL( DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID, registry.pStreamIds[ i ] );
+        TEST_ASSERT_EQUAL( DCEP_CHANNEL_STATE_CLOSED, registry.pStates[ i ] );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ChannelRegistryInit with bad parameters.
+ */
+void test_dcepChannelRegistryInit_BadParams( void )
+{
+    DcepResult_t result;
+    size_t memorySize = 0;
+
+    /* Test with NULL registry. */
+    result = Dcep_ChannelRegistryInit( NULL, &( registryMemory[ 0 ] ), sizeof( registryMemory ), 16 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL memory. */
+    result = Dcep_ChannelRegistryInit( &( registry ), NULL, sizeof( registryMemory ), 16 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with misaligned memory. */
+    result = Dcep_ChannelRegistryInit( &( registry ), ( ( uint8_t * ) &( registryMemory[ 0 ] ) ) + 1, sizeof( registryMemory ) - 1, 16 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with invalid capacity. */
+    result = Dcep_ChannelRegistryInit( &( registry ), &( registryMemory[ 0 ] ), sizeof( registryMemory ), 12 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with memory too small. */
+    result = Dcep_ChannelRegistryGetMemorySize( 16, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_ChannelRegistryInit( &( registry ), &( registryMemory[ 0 ] ), memorySize - 1, 16 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+}
+
+/* ==============================  Test Cases for Insertion and Lookup ============================== */
+
+/**
+ * @brief Validate that an inserted channel can be found and read back.
+ */
+void test_dcepChannelRegistryInsert( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t readMessage;
+    DcepChannelState_t state;
+    size_t index = 0;
+    const uint8_t label[] = "chat";
+    const uint8_t protocol[] = "json";
+
+    InitRegistry( 64 );
+
+    channelOpenMessage.channelType = DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED;
+    channelOpenMessage.priority = 256;
+    channelOpenMessage.numRetransmissions = 7;
+    channelOpenMessage.pChannelName = &( label[ 0 ] );
+    channelOpenMessage.channelNameLength = 4;
+    channelOpenMessage.pProtocol = &( protocol[ 0 ] );
+    channelOpenMessage.protocolLength = 4;
+
+    result = Dcep_ChannelRegistryInsert( &( registry ), 3, DCEP_CHANNEL_STATE_OPENING, &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, registry.count );
+
+    result = Dcep_ChannelRegistryFind( &( registry ), 3, &( index ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, registry.pStreamIds[ index ] );
+    TEST_ASSERT_EQUAL( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED, registry.pChannelTypes[ index ] );
+    TEST_ASSERT_EQUAL( 256, registry.pPriorities[ index ] );
+    TEST_ASSERT_EQUAL( 7, registry.pReliabilityParameters[ index ] );
+
+    result = Dcep_ChannelRegistryGetState( &( registry ), 3, &( state ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_CHANNEL_STATE_OPENING, state );
+
+    result = Dcep_ChannelRegistryGetChannel( &( registry ), 3, &( readMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED, readMessage.channelType );
+    TEST_ASSERT_EQUAL( 256, readMessage.priority );
+    TEST_ASSERT_EQUAL( 7, readMessage.numRetransmissions );
+    TEST_ASSERT_EQUAL( 0, readMessage.maxLifetimeInMilliseconds );
+    TEST_ASSERT_EQUAL_PTR( &( label[ 0 ] ), readMessage.pChannelName );
+    TEST_ASSERT_EQUAL( 4, readMessage.channelNameLength );
+    TEST_ASSERT_EQUAL_PTR( &( protocol[ 0 ] ), readMessage.pProtocol );
+    TEST_ASSERT_EQUAL( 4, readMessage.protocolLength );
+
+    /* A channel that was never inserted is not found. */
+    result = Dcep_ChannelRegistryFind( &( registry ), 5, &( index ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+    result = Dcep_ChannelRegistryGetState( &( registry ), 5, &( state ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+    result = Dcep_ChannelRegistryGetChannel( &( registry ), 5, &( readMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the reliability parameter is stored according to the
+ * channel type.
+ */
+void test_dcepChannelRegistryInsert_ReliabilityParameter( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t readMessage;
+    DcepChannelType_t channelTypes[] = { DCEP_DATA_CHANNEL_RELIABLE,
+                                         DCEP_DATA_CHANNEL_RELIABLE_UNORDERED,
+                                         DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT,
+                                         DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED,
+                                         DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED,
+                                         DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED };
+    uint32_t expectedRetransmissions[] = { 0, 0, 11, 11, 0, 0 };
+    uint32_t expectedLifetimes[] = { 0, 0, 0, 0, 22, 22 };
+    uint16_t i;
+
+    InitRegistry( 16 );
+
+    channelOpenMessage.numRetransmissions = 11;
+    channelOpenMessage.maxLifetimeInMilliseconds = 22;
+
+    for( i = 0; i < sizeof( channelTypes ) / sizeof( channelTypes[ 0 ] ); i++ )
+    {
+        channelOpenMessage.channelType = channelTypes[ i ];
+
+        result = Dcep_ChannelRegistryInsert( &( registry ), i, DCEP_CHANNEL_STATE_OPEN, &( channelOpenMessage ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+        result = Dcep_ChannelRegistryGetChannel( &( registry ), i, &( readMessage ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( channelTypes[ i ], readMessage.channelType );
+        TEST_ASSERT_EQUAL( expectedRetransmissions[ i ], readMessage.numRetransmissions );
+        TEST_ASSERT_EQUAL( expectedLifetimes[ i ], readMessage.maxLifetimeInMilliseconds );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that inserting a registered stream id fails and leaves the
+ * existing channel unchanged.
+ */
+void test_dcepChannelRegistryInsert_AlreadyExists( void )
+{
+    DcepResult_t result;
+    DcepChannelState_t state;
+
+    InitRegistry( 16 );
+
+    result = Dcep_ChannelRegistryInsert( &( registry ), 10, DCEP_CHANNEL_STATE_OPEN, &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_ChannelRegistryInsert( &( registry ), 10, DCEP_CHANNEL_STATE_OPENING, &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_ALREADY_EXISTS, result );
+    TEST_ASSERT_EQUAL( 1, registry.count );
+
+    result = Dcep_ChannelRegistryGetState( &( registry ), 10, &( state ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_CHANNEL_STATE_OPEN, state );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a full registry rejects new channels.
+ */
+void test_dcepChannelRegistryInsert_OutOfMemory( void )
+{
+    DcepResult_t result;
+    uint16_t i;
+
+    InitRegistry( 8 );
+
+    for( i = 0; i < 7; i++ )
+    {
+        result = Dcep_ChannelRegistryInsert( &( registry ), ( uint16_t ) ( i * 1024 ), DCEP_CHANNEL_STATE_OPEN, &( channelOpenMessage ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    }
+
+    result = Dcep_ChannelRegistryInsert( &( registry ), 1, DCEP_CHANNEL_STATE_OPEN, &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL( 7, registry.count );
+
+    /* A missing stream id is still reported as not found when full. */
+    result = Dcep_ChannelRegistryRemove( &( registry ), 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a registry of the maximum capacity holds every usable
+ * stream id of an association.
+ */
+void test_dcepChannelRegistry_AllStreamIds( void )
+{
+    DcepResult_t result;
+    size_t index = 0;
+    uint32_t streamId;
+
+    InitRegistry( DCEP_CHANNEL_REGISTRY_MAX_CAPACITY );
+
+    for( streamId = 0; streamId < DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID; streamId++ )
+    {
+        channelOpenMessage.priority = ( uint16_t ) streamId;
+
+        result = Dcep_ChannelRegistryInsert( &( registry ), ( uint16_t ) streamId, DCEP_CHANNEL_STATE_OPEN, &( channelOpenMessage ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    }
+
+    TEST_ASSERT_EQUAL( DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID, registry.count );
+
+    for( streamId = 0; streamId < DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID; streamId++ )
+    {
+        result = Dcep_ChannelRegistryFind( &( registry ), ( uint16_t ) streamId, &( index ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( streamId, registry.pPriorities[ index ] );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ChannelRegistryInsert and lookups with bad parameters.
+ */
+void test_dcepChannelRegistry_BadParams( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t readMessage;
+    DcepChannelState_t state;
+    size_t index = 0;
+
+    InitRegistry( 16 );
+
+    /* Test insert with NULL registry. */
+    result = Dcep_ChannelRegistryInsert( NULL, 1, DCEP_CHANNEL_STATE_OPEN, &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test insert with NULL channel open message. */
+    result = Dcep_ChannelRegistryInsert( &( registry ), 1, DCEP_CHANNEL_STATE_OPEN, NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test insert with the reserved stream id. */
+    result = Dcep_ChannelRegistryInsert( &( registry ), DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID, DCEP_CHANNEL_STATE_OPEN, &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test find with NULL registry. */
+    result = Dcep_ChannelRegistryFind( NULL, 1, &( index ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test find with NULL index. */
+    result = Dcep_ChannelRegistryFind( &( registry ), 1, NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test find with the reserved stream id. */
+    result = Dcep_ChannelRegistryFind( &( registry ), DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID, &( index ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test get state with NULL state. */
+    result = Dcep_ChannelRegistryGetState( &( registry ), 1, NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test get state with NULL registry. */
+    result = Dcep_ChannelRegistryGetState( NULL, 1, &( state ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test set state with NULL registry. */
+    result = Dcep_ChannelRegistrySetState( NULL, 1, DCEP_CHANNEL_STATE_OPEN );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test get channel with NULL channel open message. */
+    result = Dcep_ChannelRegistryGetChannel( &( registry ), 1, NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test get channel with NULL registry. */
+    result = Dcep_ChannelRegistryGetChannel( NULL, 1, &( readMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test remove with NULL registry. */
+    result = Dcep_ChannelRegistryRemove( NULL, 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/* ==============================  Test Cases for State Updates and Removal ============================== */
+
+/**
+ * @brief Validate Dcep_ChannelRegistrySetState.
+ */
+void test_dcepChannelRegistrySetState( void )
+{
+    DcepResult_t result;
+    DcepChannelState_t state;
+
+    InitRegistry( 16 );
+
+    result = Dcep_ChannelRegistryInsert( &( registry ), 4, DCEP_CHANNEL_STATE_OPENING, &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_ChannelRegistrySetState( &( registry ), 4, DCEP_CHANNEL_STATE_OPEN );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_ChannelRegistryGetState( &( registry ), 4, &( state ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_CHANNEL_STATE_OPEN, state );
+
+    result = Dcep_ChannelRegistrySetState( &( registry ), 6, DCEP_CHANNEL_STATE_OPEN );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that removing channels in any order keeps every remaining
+ * channel reachable, including when probe runs wrap around the table.
+ */
+void test_dcepChannelRegistryRemove( void )
+{
+    DcepResult_t result;
+    size_t index = 0;
+    uint16_t streamIds[ 15 ];
+    uint8_t removed[ 15 ];
+    /* Removal order visits the middle, start and end of probe runs. */
+    const uint8_t removalOrder[ 15 ] = { 7, 0, 14, 3, 11, 1, 13, 5, 9, 2, 12, 4, 10, 6, 8 };
+    size_t i, j;
+
+    InitRegistry( 16 );
+
+    memset( &( removed[ 0 ] ), 0, sizeof( removed ) );
+
+    /* Stream ids that differ only in their low bits and ids that differ only
+     * in their high bits, so that probe runs collide and wrap. */
+    for( i = 0; i < 15; i++ )
+    {
+        streamIds[ i ] = ( i < 8 ) ? ( uint16_t ) ( i * 4096 ) : ( uint16_t ) ( i - 7 );
+
+        channelOpenMessage.priority = ( uint16_t ) i;
+
+        result = Dcep_ChannelRegistryInsert( &( registry ), streamIds[ i ], DCEP_CHANNEL_STATE_OPEN, &( channelOpenMessage ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    }
+
+    for( i = 0; i < 15; i++ )
+    {
+        result = Dcep_ChannelRegistryRemove( &( registry ), streamIds[ removalOrder[ i ] ] );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        removed[ removalOrder[ i ] ] = 1;
+
+        TEST_ASSERT_EQUAL( 14 - i, registry.count );
+
+        for( j = 0; j < 15; j++ )
+        {
+            result = Dcep_ChannelRegistryFind( &( registry ), streamIds[ j ], &( index ) );
+
+            if( removed[ j ] != 0 )
+            {
+                TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+            }
+            else
+            {
+                TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+                TEST_ASSERT_EQUAL( j, registry.pPriorities[ index ] );
+            }
+        }
+    }
+
+    for( i = 0; i < registry.capacity; i++ )
+    {
+        TEST_ASSERT_EQUAL( DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID, registry.pStreamIds[ i ] );
+    }
+
+    /* Removing a channel twice fails. */
+    result = Dcep_ChannelRegistryRemove( &( registry ), streamIds[ 0 ] );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/* ==============================  Test Cases for the Label Index ============================== */
+
+/**
+ * @brief Validate Dcep_ChannelRegistryGetLabelIndexMemorySize and
+ * Dcep_ChannelRegistryEnableLabelIndex with bad parameters.
+ */
+void test_dcepChannelRegistryEnableLabelIndex_BadParams( void )
+{
+    DcepResult_t result;
+    size_t memorySize = 0;
+
+    result = Dcep_ChannelRegistryGetLabelIndexMemorySize( 64, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 64 * 6, memorySize );
+
+    result = Dcep_ChannelRegistryGetLabelIndexMemorySize( DCEP_CHANNEL_REGISTRY_MAX_CAPACITY, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_LESS_OR_EQUAL( sizeof( labelIndexMemory ), memorySize );
+
+    result = Dcep_ChannelRegistryGetLabelIndexMemorySize( 64, NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ChannelRegistryGetLabelIndexMemorySize( 1, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ChannelRegistryGetLabelIndexMemorySize( 48, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ChannelRegistryGetLabelIndexMemorySize( 2 * DCEP_CHANNEL_REGISTRY_MAX_CAPACITY, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    InitRegistry( 16 );
+
+    result = Dcep_ChannelRegistryEnableLabelIndex( NULL, &( labelIndexMemory[ 0 ] ), sizeof( labelIndexMemory ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ChannelRegistryEnableLabelIndex( &( registry ), NULL, sizeof( labelIndexMemory ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with misaligned memory. */
+    result = Dcep_ChannelRegistryEnableLabelIndex( &( registry ), ( ( uint8_t * ) &( labelIndexMemory[ 0 ] ) ) + 1, sizeof( labelIndexMemory ) - 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with memory too small. */
+    result = Dcep_ChannelRegistryEnableLabelIndex( &( registry ), &( labelIndexMemory[ 0 ] ), ( 16 * 6 ) - 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+
+    TEST_ASSERT_NULL( registry.labelIndex.pHashes );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ChannelRegistryFindByLabel without a label index, with
+ * an index built from the channels already registered, and with channels
+ * inserted after the index is enabled.
+ */
+void test_dcepChannelRegistryFindByLabel( void )
+{
+    DcepResult_t result;
+    uint16_t streamId = 0;
+    const uint8_t unknownLabel[] = "label-15";
+    size_t pass, i;
+
+    InitRegistry( 16 );
+
+    for( i = 0; i < 8; i++ )
+    {
+        InsertLabeledChannel( i, ( uint16_t ) ( 2 * i ) );
+    }
+
+    for( pass = 0; pass < 2; pass++ )
+    {
+        for( i = 0; i < 8; i++ )
+        {
+            result = FindByLabel( i, &( streamId ) );
+            TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+            TEST_ASSERT_EQUAL( 2 * i, streamId );
+        }
+
+        result = Dcep_ChannelRegistryFindByLabel( &( registry ), &( unknownLabel[ 0 ] ), 8, &( streamId ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+        /* Prefix of "label-1". */
+        result = Dcep_ChannelRegistryFindByLabel( &( registry ), &( labels[ 1 ][ 0 ] ), 6, &( streamId ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+        result = Dcep_ChannelRegistryFindByLabel( &( registry ), NULL, 0, &( streamId ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+        EnableLabelIndex();
+    }
+
+    for( i = 8; i < NUM_LABELS; i++ )
+    {
+        InsertLabeledChannel( i, ( uint16_t ) ( 2 * i ) );
+    }
+
+    for( i = 0; i < NUM_LABELS; i++ )
+    {
+        result = FindByLabel( i, &( streamId ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( 2 * i, streamId );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that channels sharing a label, or with an empty label, are
+ * found with and without a label index.
+ */
+void test_dcepChannelRegistryFindByLabel_SharedLabel( void )
+{
+    DcepResult_t result;
+    uint16_t streamId = 0;
+    size_t pass;
+
+    InitRegistry( 16 );
+
+    InsertLabeledChannel( 0, 1 );
+    InsertLabeledChannel( 0, 3 );
+
+    channelOpenMessage.pChannelName = NULL;
+    channelOpenMessage.channelNameLength = 0;
+    result = Dcep_ChannelRegistryInsert( &( registry ), 5, DCEP_CHANNEL_STATE_OPEN, &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    for( pass = 0; pass < 2; pass++ )
+    {
+        result = FindByLabel( 0, &( streamId ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        TEST_ASSERT_TRUE( ( streamId == 1 ) || ( streamId == 3 ) );
+
+        result = Dcep_ChannelRegistryFindByLabel( &( registry ), NULL, 0, &( streamId ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( 5, streamId );
+
+        EnableLabelIndex();
+    }
+
+    /* The other channel with the label is still found. */
+    result = Dcep_ChannelRegistryRemove( &( registry ), 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = FindByLabel( 0, &( streamId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, streamId );
+
+    result = Dcep_ChannelRegistryRemove( &( registry ), 3 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = FindByLabel( 0, &( streamId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that removing channels in any order keeps the label index
+ * in step with the registry when every index slot but one is used.
+ */
+void test_dcepChannelRegistryFindByLabel_Remove( void )
+{
+    DcepResult_t result;
+    uint16_t streamId = 0;
+    uint8_t removed[ NUM_LABELS ];
+    const uint8_t removalOrder[ NUM_LABELS ] = { 7, 0, 14, 3, 11, 1, 13, 5, 9, 2, 12, 4, 10, 6, 8 };
+    size_t i, j;
+
+    InitRegistry( 16 );
+    EnableLabelIndex();
+
+    memset( &( removed[ 0 ] ), 0, sizeof( removed ) );
+
+    for( i = 0; i < NUM_LABELS; i++ )
+    {
+        InsertLabeledChannel( i, ( uint16_t ) ( 100 + i ) );
+    }
+
+    for( i = 0; i < NUM_LABELS; i++ )
+    {
+        result = Dcep_ChannelRegistryRemove( &( registry ), ( uint16_t ) ( 100 + removalOrder[ i ] ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        removed[ removalOrder[ i ] ] = 1;
+
+        for( j = 0; j < NUM_LABELS; j++ )
+        {
+            result = FindByLabel( j, &( streamId ) );
+
+            if( removed[ j ] != 0 )
+            {
+                TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+            }
+            else
+            {
+                TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+                TEST_ASSERT_EQUAL( 100 + j, streamId );
+            }
+        }
+    }
+
+    for( i = 0; i < registry.capacity; i++ )
+    {
+        TEST_ASSERT_EQUAL( DCEP_CHANNEL_REGISTRY_EMPTY_STREAM_ID, registry.labelIndex.pStreamIds[ i ] );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ChannelRegistryFindByLabel with bad parameters.
+ */
+void test_dcepChannelRegistryFindByLabel_BadParams( void )
+{
+    DcepResult_t result;
+    uint16_t streamId = 0;
+
+    InitRegistry( 16 );
+    InsertLabeledChannel( 0, 1 );
+
+    result = Dcep_ChannelRegistryFindByLabel( NULL, &( labels[ 0 ][ 0 ] ), 7, &( streamId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ChannelRegistryFindByLabel( &( registry ), NULL, 7, &( streamId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ChannelRegistryFindByLabel( &( registry ), &( labels[ 0 ][ 0 ] ), 7, NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,592 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "dcep_api.h"
+#include "dcep_state_machine.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define MAX_BUFFER_LENGTH       1024
+#define REGISTRY_CAPACITY       16
+#define REGISTRY_MEMORY_WORDS   ( ( REGISTRY_CAPACITY * 48 ) / sizeof( uint64_t ) )
+
+uint8_t testBuffer[ MAX_BUFFER_LENGTH ];
+uint64_t registryMemory[ REGISTRY_MEMORY_WORDS ];
+DcepContext_t ctx;
+DcepChannelOpenMessage_t channelOpenMessage;
+DcepMetrics_t metrics;
+
+/* DATA_CHANNEL_OPEN, reliable, label "test", protocol "p". */
+uint8_t channelOpenMessageBuffer[] = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                       0x00, 0x04, 0x00, 0x01, 't', 'e', 's', 't', 'p' };
+const uint8_t label[] = "test";
+const uint8_t protocol[] = "p";
+
+void setUp( void )
+{
+    DcepResult_t result;
+
+    memset( &( testBuffer[ 0 ] ), 0, sizeof( testBuffer ) );
+    memset( &( metrics ), 0xA5, sizeof( metrics ) );
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    memset( &( channelOpenMessage ), 0, sizeof( channelOpenMessage ) );
+    channelOpenMessage.channelType = DCEP_DATA_CHANNEL_RELIABLE;
+    channelOpenMessage.pChannelName = &( label[ 0 ] );
+    channelOpenMessage.channelNameLength = 4;
+    channelOpenMessage.pProtocol = &( protocol[ 0 ] );
+    channelOpenMessage.protocolLength = 1;
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Helpers ============================== */
+
+static void GetMetrics( void )
+{
+    DcepResult_t result;
+
+    result = Dcep_GetMetrics( &( ctx ), &( metrics ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+}
+
+static uint16_t RejectHeaderBlock( DcepHeaderBlock_t * pBlock,
+                                   size_t numHeaders )
+{
+    ( void ) pBlock;
+    ( void ) numHeaders;
+
+    return 0;
+}
+
+/* ==============================  Test Cases for Dcep_GetMetrics ============================== */
+
+/**
+ * @brief Validate Dcep_GetMetrics and Dcep_ResetMetrics bad parameter handling.
+ */
+void test_dcepGetMetrics_BadParams( void )
+{
+    DcepResult_t result;
+
+    result = Dcep_GetMetrics( NULL, &( metrics ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_GetMetrics( &( ctx ), NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ResetMetrics( NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Dcep_Init and Dcep_ResetMetrics clear all counters.
+ */
+void test_dcepResetMetrics( void )
+{
+    DcepResult_t result;
+    DcepMetrics_t zeroMetrics;
+    size_t bufferLength = sizeof( testBuffer );
+
+    memset( &( zeroMetrics ), 0, sizeof( zeroMetrics ) );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL_MEMORY( &( zeroMetrics ), &( metrics ), sizeof( metrics ) );
+
+    result = Dcep_SerializeChannelAckMessage( &( ctx ), &( testBuffer[ 0 ] ), &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 1, metrics.channelAckMessagesSerialized );
+
+    result = Dcep_ResetMetrics( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL_MEMORY( &( zeroMetrics ), &( metrics ), sizeof( metrics ) );
+}
+
+/* ==============================  Test Cases for Serialization ============================== */
+
+/**
+ * @brief Validate the counters updated by the serialization functions.
+ */
+void test_dcepMetrics_Serialize( void )
+{
+    DcepResult_t result;
+    DcepPreparedChannelOpenMessage_t preparedMessage;
+    DcepIoVec_t ioVecs[ DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS ];
+    size_t ioVecCount = DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS;
+    uint8_t templateBuffer[ 32 ];
+    size_t bufferLength = sizeof( testBuffer );
+
+    result = Dcep_SerializeChannelOpenMessage( &( ctx ),
+                                               &( channelOpenMessage ),
+                                               &( testBuffer[ 0 ] ),
+                                               &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_SerializeChannelOpenMessageIoVec( &( ctx ),
+                                                    &( channelOpenMessage ),
+                                                    &( testBuffer[ 0 ] ),
+                                                    DCEP_HEADER_LENGTH,
+                                                    &( ioVecs[ 0 ] ),
+                                                    &( ioVecCount ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    bufferLength = sizeof( testBuffer );
+    result = Dcep_SerializeChannelAckMessage( &( ctx ), &( testBuffer[ 0 ] ), &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Preparing a template is not counted. */
+    result = Dcep_PrepareChannelOpenMessage( &( ctx ),
+                                             &( channelOpenMessage ),
+                                             &( templateBuffer[ 0 ] ),
+                                             sizeof( templateBuffer ),
+                                             &( preparedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 2, metrics.channelOpenMessagesSerialized );
+    TEST_ASSERT_EQUAL( 1, metrics.channelAckMessagesSerialized );
+    TEST_ASSERT_EQUAL( 17 + 17 + 1, metrics.bytesSerialized );
+
+    bufferLength = sizeof( testBuffer );
+    result = Dcep_SerializePreparedChannelOpenMessage( &( ctx ),
+                                                       &( preparedMessage ),
+                                                       1,
+                                                       0,
+                                                       &( testBuffer[ 0 ] ),
+                                                       &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 3, metrics.channelOpenMessagesSerialized );
+    TEST_ASSERT_EQUAL( 17 + 17 + 1 + 17, metrics.bytesSerialized );
+    TEST_ASSERT_EQUAL( 0, metrics.outOfMemory );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that failed serializations only count as out of memory.
+ */
+void test_dcepMetrics_SerializeOutOfMemory( void )
+{
+    DcepResult_t result;
+    DcepPreparedChannelOpenMessage_t preparedMessage;
+    uint8_t templateBuffer[ 32 ];
+    size_t bufferLength = DCEP_HEADER_LENGTH;
+
+    result = Dcep_SerializeChannelOpenMessage( &( ctx ),
+                                               &( channelOpenMessage ),
+                                               &( testBuffer[ 0 ] ),
+                                               &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+
+    result = Dcep_PrepareChannelOpenMessage( &( ctx ),
+                                             &( channelOpenMessage ),
+                                             &( templateBuffer[ 0 ] ),
+                                             DCEP_HEADER_LENGTH,
+                                             &( preparedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+
+    result = Dcep_PrepareChannelOpenMessage( &( ctx ),
+                                             &( channelOpenMessage ),
+                                             &( templateBuffer[ 0 ] ),
+                                             sizeof( templateBuffer ),
+                                             &( preparedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    bufferLength = DCEP_HEADER_LENGTH;
+    result = Dcep_SerializePreparedChannelOpenMessage( &( ctx ),
+                                                       &( preparedMessage ),
+                                                       1,
+                                                       0,
+                                                       &( testBuffer[ 0 ] ),
+                                                       &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+
+    /* Bad parameters are not counted. */
+    bufferLength = 0;
+    result = Dcep_SerializeChannelAckMessage( &( ctx ), &( testBuffer[ 0 ] ), &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_PrepareChannelOpenMessage( &( ctx ),
+                                             NULL,
+                                             &( templateBuffer[ 0 ] ),
+                                             sizeof( templateBuffer ),
+                                             &( preparedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 3, metrics.outOfMemory );
+    TEST_ASSERT_EQUAL( 0, metrics.channelOpenMessagesSerialized );
+    TEST_ASSERT_EQUAL( 0, metrics.channelAckMessagesSerialized );
+    TEST_ASSERT_EQUAL( 0, metrics.bytesSerialized );
+}
+
+/**
+ * @brief Validate that Dcep_SerializeChannelAckBatch counts every ACK.
+ */
+void test_dcepMetrics_SerializeChannelAckBatch( void )
+{
+    DcepResult_t result;
+    uint16_t streamIds[] = { 0, 2, 4 };
+    DcepAckBatchEntry_t entries[ 3 ];
+    size_t bufferLength = sizeof( testBuffer );
+
+    result = Dcep_SerializeChannelAckBatch( &( ctx ), &( streamIds[ 0 ] ), 3, &( testBuffer[ 0 ] ), &( bufferLength ), &( entries[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Failed calls are not counted. */
+    bufferLength = 2;
+    result = Dcep_SerializeChannelAckBatch( &( ctx ), &( streamIds[ 0 ] ), 3, &( testBuffer[ 0 ] ), &( bufferLength ), &( entries[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 3, metrics.channelAckMessagesSerialized );
+    TEST_ASSERT_EQUAL( 3, metrics.bytesSerialized );
+}
+
+/*-----------------------------------------------------------*/
+
+/* ==============================  Test Cases for Deserialization ============================== */
+
+/**
+ * @brief Validate the counters updated by Dcep_DeserializeChannelOpenMessage
+ * and Dcep_GetMessageType.
+ */
+void test_dcepMetrics_Deserialize( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t decodedMessage;
+    DcepMessageType_t messageType;
+    uint8_t ackMessage[] = { 0x02 };
+    uint8_t unknownMessage[] = { 0x05 };
+
+    result = Dcep_GetMessageType( &( ctx ),
+                                  &( channelOpenMessageBuffer[ 0 ] ),
+                                  sizeof( channelOpenMessageBuffer ),
+                                  &( messageType ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_MESSAGE_DATA_CHANNEL_OPEN, messageType );
+
+    result = Dcep_DeserializeChannelOpenMessage( &( ctx ),
+                                                 &( channelOpenMessageBuffer[ 0 ] ),
+                                                 sizeof( channelOpenMessageBuffer ),
+                                                 &( decodedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_GetMessageType( &( ctx ),
+                                  &( ackMessage[ 0 ] ),
+                                  sizeof( ackMessage ),
+                                  &( messageType ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_MESSAGE_DATA_CHANNEL_ACK, messageType );
+
+    result = Dcep_GetMessageType( &( ctx ),
+                                  &( unknownMessage[ 0 ] ),
+                                  sizeof( unknownMessage ),
+                                  &( messageType ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 1, metrics.channelOpenMessagesDeserialized );
+    TEST_ASSERT_EQUAL( 1, metrics.channelAckMessagesDeserialized );
+    TEST_ASSERT_EQUAL( 17 + 1, metrics.bytesDeserialized );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedMessageType );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that malformed messages are counted by failed check.
+ */
+void test_dcepMetrics_DeserializeMalformed( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t decodedMessage;
+    uint8_t message[ sizeof( channelOpenMessageBuffer ) ];
+
+    /* Invalid channel type. */
+    memcpy( &( message[ 0 ] ), &( channelOpenMessageBuffer[ 0 ] ), sizeof( message ) );
+    message[ 1 ] = 0x03;
+    result = Dcep_DeserializeChannelOpenMessage( &( ctx ), &( message[ 0 ] ), sizeof( message ), &( decodedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    /* Label overrun. */
+    result = Dcep_DeserializeChannelOpenMessage( &( ctx ), &( channelOpenMessageBuffer[ 0 ] ), 15, &( decodedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    /* Protocol overrun. */
+    result = Dcep_DeserializeChannelOpenMessage( &( ctx ), &( channelOpenMessageBuffer[ 0 ] ), 16, &( decodedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 1, metrics.malformedChannelType );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedLabelOverrun );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedProtocolOverrun );
+    TEST_ASSERT_EQUAL( 0, metrics.channelOpenMessagesDeserialized );
+    TEST_ASSERT_EQUAL( 0, metrics.bytesDeserialized );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the counters updated by Dcep_InitChannelOpenView.
+ */
+void test_dcepMetrics_InitChannelOpenView( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenView_t view;
+    uint8_t message[ sizeof( channelOpenMessageBuffer ) ];
+
+    result = Dcep_InitChannelOpenView( &( ctx ), &( channelOpenMessageBuffer[ 0 ] ), sizeof( channelOpenMessageBuffer ), &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    memcpy( &( message[ 0 ] ), &( channelOpenMessageBuffer[ 0 ] ), sizeof( message ) );
+    message[ 1 ] = 0x03;
+    result = Dcep_InitChannelOpenView( &( ctx ), &( message[ 0 ] ), sizeof( message ), &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    result = Dcep_InitChannelOpenView( &( ctx ), &( channelOpenMessageBuffer[ 0 ] ), 15, &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    result = Dcep_InitChannelOpenView( &( ctx ), &( channelOpenMessageBuffer[ 0 ] ), 16, &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 1, metrics.channelOpenMessagesDeserialized );
+    TEST_ASSERT_EQUAL( 17, metrics.bytesDeserialized );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedChannelType );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedLabelOverrun );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedProtocolOverrun );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the counters updated by
+ * Dcep_DeserializeAndRouteChannelOpenMessage, whether or not the protocol is
+ * registered.
+ */
+void test_dcepMetrics_DeserializeAndRoute( void )
+{
+    DcepResult_t result;
+    DcepProtocolTable_t protocolTable;
+    DcepProtocolHandler_t protocolHandler;
+    DcepChannelOpenMessage_t decodedMessage;
+    uint16_t handlerId = 0;
+    const uint8_t otherProtocol[] = "q";
+
+    protocolHandler.pProtocol = &( protocol[ 0 ] );
+    protocolHandler.protocolLength = 1;
+    protocolHandler.handlerId = 7;
+
+    result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandler ), 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_DeserializeAndRouteChannelOpenMessage( &( ctx ),
+                                                         &( protocolTable ),
+                                                         &( channelOpenMessageBuffer[ 0 ] ),
+                                                         sizeof( channelOpenMessageBuffer ),
+                                                         &( decodedMessage ),
+                                                         &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 7, handlerId );
+
+    protocolHandler.pProtocol = &( otherProtocol[ 0 ] );
+
+    result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandler ), 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_DeserializeAndRouteChannelOpenMessage( &( ctx ),
+                                                         &( protocolTable ),
+                                                         &( channelOpenMessageBuffer[ 0 ] ),
+                                                         sizeof( channelOpenMessageBuffer ),
+                                                         &( decodedMessage ),
+                                                         &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_PROTOCOL_TABLE_NO_HANDLER, handlerId );
+
+    /* Label overrun. */
+    result = Dcep_DeserializeAndRouteChannelOpenMessage( &( ctx ),
+                                                         &( protocolTable ),
+                                                         &( channelOpenMessageBuffer[ 0 ] ),
+                                                         15,
+                                                         &( decodedMessage ),
+                                                         &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 2, metrics.channelOpenMessagesDeserialized );
+    TEST_ASSERT_EQUAL( 17 + 17, metrics.bytesDeserialized );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedLabelOverrun );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the counters updated by Dcep_DeserializeBatch.
+ */
+void test_dcepMetrics_DeserializeBatch( void )
+{
+    DcepResult_t result;
+    DcepBatchEntry_t entries[ 6 ];
+    DcepBatchResult_t results[ 6 ];
+    uint8_t ackMessage[] = { 0x02 };
+    uint8_t unknownMessage[] = { 0x05 };
+
+    memset( &( entries[ 0 ] ), 0, sizeof( entries ) );
+
+    /* Valid, decoded by the header block kernel. */
+    entries[ 0 ].pDcepMessage = &( channelOpenMessageBuffer[ 0 ] );
+    entries[ 0 ].dcepMessageLength = sizeof( channelOpenMessageBuffer );
+    entries[ 1 ].pDcepMessage = &( ackMessage[ 0 ] );
+    entries[ 1 ].dcepMessageLength = sizeof( ackMessage );
+    /* Truncated header. */
+    entries[ 2 ].pDcepMessage = &( channelOpenMessageBuffer[ 0 ] );
+    entries[ 2 ].dcepMessageLength = DCEP_HEADER_LENGTH - 1;
+    entries[ 3 ].pDcepMessage = &( unknownMessage[ 0 ] );
+    entries[ 3 ].dcepMessageLength = sizeof( unknownMessage );
+    /* Label overrun. */
+    entries[ 4 ].pDcepMessage = &( channelOpenMessageBuffer[ 0 ] );
+    entries[ 4 ].dcepMessageLength = 15;
+    /* Bad parameter, not counted. */
+    entries[ 5 ].pDcepMessage = NULL;
+
+    result = Dcep_DeserializeBatch( &( ctx ), &( entries[ 0 ] ), 6, &( results[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 1, metrics.channelOpenMessagesDeserialized );
+    TEST_ASSERT_EQUAL( 1, metrics.channelAckMessagesDeserialized );
+    TEST_ASSERT_EQUAL( 17 + 1, metrics.bytesDeserialized );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedTruncatedHeader );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedMessageType );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedLabelOverrun );
+
+    /* Entries rejected by the kernel are counted on the per-message path. */
+    ctx.validateHeaderBlockFn = RejectHeaderBlock;
+
+    result = Dcep_DeserializeBatch( &( ctx ), &( entries[ 0 ] ), 1, &( results[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, results[ 0 ].result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 2, metrics.channelOpenMessagesDeserialized );
+    TEST_ASSERT_EQUAL( 17 + 1 + 17, metrics.bytesDeserialized );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the counters updated by the streaming parser.
+ */
+void test_dcepMetrics_StreamingParser( void )
+{
+    DcepResult_t result;
+    DcepStreamingParser_t parser;
+    DcepStreamingParserOutput_t output;
+    uint8_t ackHeader[ DCEP_HEADER_LENGTH ] = { 0x02 };
+
+    result = Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( channelOpenMessageBuffer[ 0 ] ), 14, &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, output.messageComplete );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 0, metrics.channelOpenMessagesDeserialized );
+
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( channelOpenMessageBuffer[ 14 ] ), 3, &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, output.messageComplete );
+
+    result = Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( ackHeader[ 0 ] ), sizeof( ackHeader ), &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 1, metrics.channelOpenMessagesDeserialized );
+    TEST_ASSERT_EQUAL( 17, metrics.bytesDeserialized );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedMessageType );
+}
+
+/* ==============================  Test Cases for Dcep_ProcessMessage ============================== */
+
+/**
+ * @brief Validate the counters updated by Dcep_ProcessMessage.
+ */
+void test_dcepMetrics_ProcessMessage( void )
+{
+    DcepResult_t result;
+    DcepChannelRegistry_t registry;
+    DcepProcessedMessage_t processedMessage;
+    uint8_t ackBuffer[ 4 ];
+    size_t ackBufferLength;
+    uint8_t ackMessage[] = { 0x02 };
+    uint8_t unknownMessage[] = { 0x05 };
+
+    result = Dcep_ChannelRegistryInit( &( registry ),
+                                       &( registryMemory[ 0 ] ),
+                                       sizeof( registryMemory ),
+                                       REGISTRY_CAPACITY );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    ackBufferLength = sizeof( ackBuffer );
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 1,
+                                  &( channelOpenMessageBuffer[ 0 ] ), sizeof( channelOpenMessageBuffer ),
+                                  &( ackBuffer[ 0 ] ), &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* No channel is opening on stream 3, the ACK is still counted. */
+    ackBufferLength = sizeof( ackBuffer );
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 3,
+                                  &( ackMessage[ 0 ] ), sizeof( ackMessage ),
+                                  &( ackBuffer[ 0 ] ), &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+    ackBufferLength = 0;
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 5,
+                                  &( channelOpenMessageBuffer[ 0 ] ), sizeof( channelOpenMessageBuffer ),
+                                  &( ackBuffer[ 0 ] ), &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+
+    ackBufferLength = sizeof( ackBuffer );
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 5,
+                                  &( channelOpenMessageBuffer[ 0 ] ), DCEP_HEADER_LENGTH - 1,
+                                  &( ackBuffer[ 0 ] ), &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 5,
+                                  &( unknownMessage[ 0 ] ), sizeof( unknownMessage ),
+                                  &( ackBuffer[ 0 ] ), &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 1, metrics.channelOpenMessagesDeserialized );
+    TEST_ASSERT_EQUAL( 1, metrics.channelAckMessagesDeserialized );
+    TEST_ASSERT_EQUAL( 17 + 1, metrics.bytesDeserialized );
+    TEST_ASSERT_EQUAL( 1, metrics.channelAckMessagesSerialized );
+    TEST_ASSERT_EQUAL( 1, metrics.bytesSerialized );
+    TEST_ASSERT_EQUAL( 1, metrics.outOfMemory );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedTruncatedHeader );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedMessageType );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,247 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "dcep_api.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define MAX_BUFFER_LENGTH    1024
+
+uint8_t testBuffer[ MAX_BUFFER_LENGTH ];
+DcepContext_t ctx;
+DcepLatencyHistogram_t histogram;
+DcepProfile_t profile;
+
+void setUp( void )
+{
+    DcepResult_t result;
+
+    memset( &( testBuffer[ 0 ] ), 0, sizeof( testBuffer ) );
+    memset( &( histogram ), 0, sizeof( histogram ) );
+    memset( &( profile ), 0xA5, sizeof( profile ) );
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases for Latency Histograms ============================== */
+
+/**
+ * @brief Validate that latencies are recorded in log2 buckets.
+ */
+void test_dcepLatencyHistogramRecord( void )
+{
+    Dcep_LatencyHistogramRecord( &( histogram ), 0 );
+    Dcep_LatencyHistogramRecord( &( histogram ), 1 );
+    Dcep_LatencyHistogramRecord( &( histogram ), 2 );
+    Dcep_LatencyHistogramRecord( &( histogram ), 3 );
+    Dcep_LatencyHistogramRecord( &( histogram ), 1024 );
+    Dcep_LatencyHistogramRecord( &( histogram ), 2047 );
+    Dcep_LatencyHistogramRecord( &( histogram ), 0x80000000UL );
+    Dcep_LatencyHistogramRecord( &( histogram ), ( uint64_t ) 1 << 40 );
+
+    TEST_ASSERT_EQUAL( 2, histogram.buckets[ 0 ] );
+    TEST_ASSERT_EQUAL( 2, histogram.buckets[ 1 ] );
+    TEST_ASSERT_EQUAL( 0, histogram.buckets[ 2 ] );
+    TEST_ASSERT_EQUAL( 2, histogram.buckets[ 10 ] );
+    TEST_ASSERT_EQUAL( 2, histogram.buckets[ DCEP_LATENCY_HISTOGRAM_BUCKETS - 1 ] );
+
+    TEST_ASSERT_EQUAL( 8, histogram.count );
+    TEST_ASSERT_EQUAL_UINT64( 0 + 1 + 2 + 3 + 1024 + 2047 + 0x80000000ULL + ( ( uint64_t ) 1 << 40 ),
+                              histogram.totalTicks );
+    TEST_ASSERT_EQUAL_UINT64( ( uint64_t ) 1 << 40, histogram.maxTicks );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate quantiles on an empty histogram.
+ */
+void test_dcepLatencyHistogramGetQuantile_Empty( void )
+{
+    TEST_ASSERT_EQUAL_UINT64( 0, Dcep_LatencyHistogramGetQuantile( NULL, 500000 ) );
+    TEST_ASSERT_EQUAL_UINT64( 0, Dcep_LatencyHistogramGetQuantile( &( histogram ), 500000 ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a quantile reports the end of its bucket, capped at the
+ * longest recorded latency.
+ */
+void test_dcepLatencyHistogramGetQuantile( void )
+{
+    size_t i;
+
+    /* 999 calls in [ 4, 8 ) and one slow call. */
+    for( i = 0; i < 999; i++ )
+    {
+        Dcep_LatencyHistogramRecord( &( histogram ), 5 );
+    }
+
+    Dcep_LatencyHistogramRecord( &( histogram ), 5000 );
+
+    TEST_ASSERT_EQUAL_UINT64( 7, Dcep_LatencyHistogramGetQuantile( &( histogram ), 0 ) );
+    TEST_ASSERT_EQUAL_UINT64( 7, Dcep_LatencyHistogramGetQuantile( &( histogram ), 500000 ) );
+    TEST_ASSERT_EQUAL_UINT64( 7, Dcep_LatencyHistogramGetQuantile( &( histogram ), 999000 ) );
+    TEST_ASSERT_EQUAL_UINT64( 5000, Dcep_LatencyHistogramGetQuantile( &( histogram ), 999001 ) );
+    TEST_ASSERT_EQUAL_UINT64( 5000, Dcep_LatencyHistogramGetQuantile( &( histogram ), 1000000 ) );
+    TEST_ASSERT_EQUAL_UINT64( 5000, Dcep_LatencyHistogramGetQuantile( &( histogram ), 2000000 ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the last bucket reports the longest recorded latency.
+ */
+void test_dcepLatencyHistogramGetQuantile_LastBucket( void )
+{
+    Dcep_LatencyHistogramRecord( &( histogram ), 3 );
+    Dcep_LatencyHistogramRecord( &( histogram ), ( uint64_t ) 1 << 40 );
+
+    TEST_ASSERT_EQUAL_UINT64( 3, Dcep_LatencyHistogramGetQuantile( &( histogram ), 500000 ) );
+    TEST_ASSERT_EQUAL_UINT64( ( uint64_t ) 1 << 40, Dcep_LatencyHistogramGetQuantile( &( histogram ), 1000000 ) );
+}
+
+/* ==============================  Test Cases for Dcep_GetProfile ============================== */
+
+/**
+ * @brief Validate Dcep_GetProfile and Dcep_ResetProfile bad parameter handling.
+ */
+void test_dcepGetProfile_BadParams( void )
+{
+    DcepResult_t result;
+
+    result = Dcep_GetProfile( NULL, &( profile ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_GetProfile( &( ctx ), NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ResetProfile( NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that every public function records one latency per call,
+ * including failed calls, and that Dcep_ResetProfile clears them.
+ */
+void test_dcepProfile_AllFunctions( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t channelOpenMessage;
+    DcepPreparedChannelOpenMessage_t preparedMessage;
+    DcepIoVec_t ioVecs[ DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS ];
+    size_t ioVecCount = DCEP_CHANNEL_OPEN_MESSAGE_MAX_IOVECS;
+    DcepStreamingParser_t parser;
+    DcepStreamingParserOutput_t output;
+    DcepMessageType_t messageType;
+    DcepBatchEntry_t batchEntry;
+    DcepBatchResult_t batchResult;
+    DcepChannelOpenView_t view;
+    DcepAckBatchEntry_t ackBatchEntry;
+    DcepProtocolTable_t protocolTable;
+    DcepProtocolHandler_t protocolHandler = { NULL, 0, 1 };
+    uint16_t streamId = 1;
+    uint16_t handlerId;
+    DcepProfile_t zeroProfile;
+    uint8_t templateBuffer[ 32 ];
+    uint8_t serializedMessage[ 32 ];
+    size_t serializedMessageLength = sizeof( serializedMessage );
+    size_t bufferLength;
+    size_t i;
+
+    memset( &( zeroProfile ), 0, sizeof( zeroProfile ) );
+    memset( &( channelOpenMessage ), 0, sizeof( channelOpenMessage ) );
+    channelOpenMessage.channelType = DCEP_DATA_CHANNEL_RELIABLE;
+
+    result = Dcep_GetProfile( &( ctx ), &( profile ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_MEMORY( &( zeroProfile ), &( profile ), sizeof( profile ) );
+
+    result = Dcep_SerializeChannelOpenMessage( &( ctx ), &( channelOpenMessage ), &( serializedMessage[ 0 ] ), &( serializedMessageLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_GetChannelOpenMessageLength( &( ctx ), &( channelOpenMessage ), &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_SerializeChannelOpenMessageIoVec( &( ctx ), &( channelOpenMessage ), &( testBuffer[ 0 ] ), DCEP_HEADER_LENGTH, &( ioVecs[ 0 ] ), &( ioVecCount ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_PrepareChannelOpenMessage( &( ctx ), &( channelOpenMessage ), &( templateBuffer[ 0 ] ), sizeof( templateBuffer ), &( preparedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    bufferLength = sizeof( testBuffer );
+    result = Dcep_SerializePreparedChannelOpenMessage( &( ctx ), &( preparedMessage ), 1, 0, &( testBuffer[ 0 ] ), &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Failed calls are recorded too. */
+    bufferLength = 0;
+    result = Dcep_SerializeChannelAckMessage( &( ctx ), &( testBuffer[ 0 ] ), &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    bufferLength = sizeof( testBuffer );
+    result = Dcep_SerializeChannelAckBatch( &( ctx ), &( streamId ), 1, &( testBuffer[ 0 ] ), &( bufferLength ), &( ackBatchEntry ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_DeserializeChannelOpenMessage( &( ctx ), &( serializedMessage[ 0 ] ), serializedMessageLength, &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandler ), 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_DeserializeAndRouteChannelOpenMessage( &( ctx ), &( protocolTable ), &( serializedMessage[ 0 ] ), serializedMessageLength, &( channelOpenMessage ), &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, handlerId );
+
+    result = Dcep_InitChannelOpenView( &( ctx ), &( serializedMessage[ 0 ] ), serializedMessageLength, &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( serializedMessage[ 0 ] ), serializedMessageLength, &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_GetMessageType( &( ctx ), &( serializedMessage[ 0 ] ), serializedMessageLength, &( messageType ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    batchEntry.pDcepMessage = &( serializedMessage[ 0 ] );
+    batchEntry.dcepMessageLength = serializedMessageLength;
+    batchEntry.streamId = 1;
+    result = Dcep_DeserializeBatch( &( ctx ), &( batchEntry ), 1, &( batchResult ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Calls without a context are not recorded. */
+    result = Dcep_GetMessageType( NULL, &( serializedMessage[ 0 ] ), serializedMessageLength, &( messageType ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_GetProfile( &( ctx ), &( profile ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    for( i = 0; i < DCEP_PROFILED_FUNCTION_COUNT; i++ )
+    {
+        TEST_ASSERT_EQUAL( 1, profile.histograms[ i ].count );
+        TEST_ASSERT_EQUAL_UINT64( profile.histograms[ i ].maxTicks, profile.histograms[ i ].totalTicks );
+    }
+
+    result = Dcep_ResetProfile( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_GetProfile( &( ctx ), &( profile ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL_MEMORY( &( zeroProfile ), &( profile ), sizeof( profile ) );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,207 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "dcep_protocol_table.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define MAX_PROTOCOL_LENGTH    16
+
+uint8_t protocols[ DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS ][ MAX_PROTOCOL_LENGTH ];
+DcepProtocolHandler_t protocolHandlers[ DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS ];
+DcepProtocolTable_t protocolTable;
+
+void setUp( void )
+{
+    size_t i;
+    int length;
+
+    /* "proto-0", "proto-1", ... with handler ids 100, 101, ... */
+    for( i = 0; i < DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS; i++ )
+    {
+        length = snprintf( ( char * ) &( protocols[ i ][ 0 ] ), MAX_PROTOCOL_LENGTH, "proto-%u", ( unsigned int ) i );
+
+        protocolHandlers[ i ].pProtocol = &( protocols[ i ][ 0 ] );
+        protocolHandlers[ i ].protocolLength = ( uint16_t ) length;
+        protocolHandlers[ i ].handlerId = ( uint16_t ) ( 100 + i );
+    }
+
+    memset( &( protocolTable ), 0, sizeof( protocolTable ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases for Lookup ============================== */
+
+/**
+ * @brief Validate that every registered protocol is found, for every number
+ * of protocols, and that each one is found in its own slot.
+ */
+void test_dcepProtocolTableLookup_AllSizes( void )
+{
+    DcepResult_t result;
+    uint16_t handlerId;
+    size_t numHandlers, i;
+
+    for( numHandlers = 1; numHandlers <= DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS; numHandlers++ )
+    {
+        result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandlers[ 0 ] ), numHandlers );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        TEST_ASSERT_GREATER_OR_EQUAL( 2 * numHandlers, protocolTable.slotMask + 1 );
+        TEST_ASSERT_LESS_THAN( 4 * numHandlers, protocolTable.slotMask + 1 );
+
+        for( i = 0; i < DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS; i++ )
+        {
+            handlerId = 0;
+            result = Dcep_ProtocolTableLookup( &( protocolTable ),
+                                               protocolHandlers[ i ].pProtocol,
+                                               protocolHandlers[ i ].protocolLength,
+                                               &( handlerId ) );
+
+            if( i < numHandlers )
+            {
+                TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+                TEST_ASSERT_EQUAL( 100 + i, handlerId );
+            }
+            else
+            {
+                TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+                TEST_ASSERT_EQUAL( 0, handlerId );
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a protocol must match exactly, and that the empty
+ * protocol can be registered.
+ */
+void test_dcepProtocolTableLookup_ExactMatch( void )
+{
+    DcepResult_t result;
+    uint16_t handlerId = 0;
+    const uint8_t longerProtocol[] = "proto-10";
+
+    result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandlers[ 0 ] ), 3 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Prefix of "proto-1". */
+    result = Dcep_ProtocolTableLookup( &( protocolTable ), &( protocols[ 1 ][ 0 ] ), 6, &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+    result = Dcep_ProtocolTableLookup( &( protocolTable ), &( longerProtocol[ 0 ] ), 8, &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+    result = Dcep_ProtocolTableLookup( &( protocolTable ), NULL, 0, &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+    /* Register the empty protocol in place of "proto-2". */
+    protocolHandlers[ 2 ].pProtocol = NULL;
+    protocolHandlers[ 2 ].protocolLength = 0;
+
+    result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandlers[ 0 ] ), 3 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_ProtocolTableLookup( &( protocolTable ), NULL, 0, &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 102, handlerId );
+
+    result = Dcep_ProtocolTableLookup( &( protocolTable ), &( protocols[ 2 ][ 0 ] ), protocolHandlers[ 1 ].protocolLength, &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ProtocolTableLookup with bad parameters.
+ */
+void test_dcepProtocolTableLookup_BadParams( void )
+{
+    DcepResult_t result;
+    uint16_t handlerId = 0;
+
+    result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandlers[ 0 ] ), 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_ProtocolTableLookup( NULL, &( protocols[ 0 ][ 0 ] ), 7, &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ProtocolTableLookup( &( protocolTable ), NULL, 7, &( handlerId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ProtocolTableLookup( &( protocolTable ), &( protocols[ 0 ][ 0 ] ), 7, NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/* ==============================  Test Cases for Init ============================== */
+
+/**
+ * @brief Validate Dcep_ProtocolTableInit with bad parameters.
+ */
+void test_dcepProtocolTableInit_BadParams( void )
+{
+    DcepResult_t result;
+
+    result = Dcep_ProtocolTableInit( NULL, &( protocolHandlers[ 0 ] ), 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ProtocolTableInit( &( protocolTable ), NULL, 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandlers[ 0 ] ), 0 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandlers[ 0 ] ), DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS + 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Reserved handler id. */
+    protocolHandlers[ 1 ].handlerId = DCEP_PROTOCOL_TABLE_NO_HANDLER;
+    result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandlers[ 0 ] ), 2 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Protocol bytes missing. */
+    protocolHandlers[ 1 ].handlerId = 101;
+    protocolHandlers[ 1 ].pProtocol = NULL;
+    result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandlers[ 0 ] ), 2 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a protocol can not be registered twice.
+ */
+void test_dcepProtocolTableInit_Duplicate( void )
+{
+    DcepResult_t result;
+    uint8_t duplicateProtocol[ MAX_PROTOCOL_LENGTH ];
+
+    /* Same bytes at a different address. */
+    memcpy( &( duplicateProtocol[ 0 ] ), &( protocols[ 0 ][ 0 ] ), MAX_PROTOCOL_LENGTH );
+    protocolHandlers[ 3 ].pProtocol = &( duplicateProtocol[ 0 ] );
+    protocolHandlers[ 3 ].protocolLength = protocolHandlers[ 0 ].protocolLength;
+
+    result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandlers[ 0 ] ), 4 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_ALREADY_EXISTS, result );
+
+    /* Two empty protocols. */
+    protocolHandlers[ 0 ].pProtocol = NULL;
+    protocolHandlers[ 0 ].protocolLength = 0;
+    protocolHandlers[ 3 ].pProtocol = &( duplicateProtocol[ 0 ] );
+    protocolHandlers[ 3 ].protocolLength = 0;
+
+    result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandlers[ 0 ] ), 4 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_ALREADY_EXISTS, result );
+}
+
+/*-----------------------------------------------------------*/
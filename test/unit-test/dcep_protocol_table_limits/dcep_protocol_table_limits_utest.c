@@ -0,0 +1,92 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "dcep_protocol_table.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+/* This target builds the protocol table with DCEP_PROTOCOL_TABLE_MAX_DISPLACEMENT
+ * set to 1 and DCEP_PROTOCOL_TABLE_MAX_SEEDS set to 2 (see ut.cmake), so
+ * that every collision of two protocols exhausts the displacements of a seed. */
+
+#define MAX_PROTOCOL_LENGTH    16
+
+uint8_t protocols[ DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS ][ MAX_PROTOCOL_LENGTH ];
+DcepProtocolHandler_t protocolHandlers[ DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS ];
+DcepProtocolTable_t protocolTable;
+
+void setUp( void )
+{
+    size_t i;
+    int length;
+
+    /* "proto-0", "proto-1", ... with handler ids 100, 101, ... */
+    for( i = 0; i < DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS; i++ )
+    {
+        length = snprintf( ( char * ) &( protocols[ i ][ 0 ] ), MAX_PROTOCOL_LENGTH, "proto-%u", ( unsigned int ) i );
+
+        protocolHandlers[ i ].pProtocol = &( protocols[ i ][ 0 ] );
+        protocolHandlers[ i ].protocolLength = ( uint16_t ) length;
+        protocolHandlers[ i ].handlerId = ( uint16_t ) ( 100 + i );
+    }
+
+    memset( &( protocolTable ), 0, sizeof( protocolTable ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases for Init ============================== */
+
+/**
+ * @brief Validate that Dcep_ProtocolTableInit tries the next seed when no
+ * displacement places a bucket, that a table built with a later seed finds
+ * every protocol, and that DCEP_RESULT_OUT_OF_MEMORY is returned once the
+ * seeds run out.
+ */
+void test_dcepProtocolTableInit_Collisions( void )
+{
+    DcepResult_t result;
+    uint16_t handlerId;
+    size_t numHandlers, i;
+    size_t numRetried = 0, numOutOfMemory = 0;
+
+    for( numHandlers = 1; numHandlers <= DCEP_PROTOCOL_TABLE_MAX_PROTOCOLS; numHandlers++ )
+    {
+        result = Dcep_ProtocolTableInit( &( protocolTable ), &( protocolHandlers[ 0 ] ), numHandlers );
+
+        if( result == DCEP_RESULT_OK )
+        {
+            for( i = 0; i < numHandlers; i++ )
+            {
+                handlerId = 0;
+                result = Dcep_ProtocolTableLookup( &( protocolTable ),
+                                                   protocolHandlers[ i ].pProtocol,
+                                                   protocolHandlers[ i ].protocolLength,
+                                                   &( handlerId ) );
+                TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+                TEST_ASSERT_EQUAL( 100 + i, handlerId );
+            }
+
+            TEST_ASSERT_LESS_THAN( 2, protocolTable.seed );
+            numRetried += ( protocolTable.seed > 0 ) ? 1U : 0U;
+        }
+        else
+        {
+            TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+            numOutOfMemory++;
+        }
+    }
+
+    TEST_ASSERT_GREATER_THAN( 0, numRetried );
+    TEST_ASSERT_GREATER_THAN( 0, numOutOfMemory );
+}
+
+/*-----------------------------------------------------------*/
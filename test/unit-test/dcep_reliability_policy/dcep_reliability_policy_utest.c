@@ -0,0 +1,237 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "dcep_reliability_policy.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define NUM_MESSAGES    37
+
+DcepChannelOpenMessage_t channelOpenMessage;
+DcepReliabilityPolicy_t policy;
+
+void setUp( void )
+{
+    memset( &( channelOpenMessage ), 0, sizeof( channelOpenMessage ) );
+    memset( &( policy ), 0, sizeof( policy ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Helpers ============================== */
+
+static void InitPolicy( DcepChannelType_t channelType,
+                        uint32_t numRetransmissions,
+                        uint32_t maxLifetimeInMilliseconds )
+{
+    DcepResult_t result;
+
+    channelOpenMessage.channelType = channelType;
+    channelOpenMessage.numRetransmissions = numRetransmissions;
+    channelOpenMessage.maxLifetimeInMilliseconds = maxLifetimeInMilliseconds;
+
+    result = Dcep_ReliabilityPolicyInit( &( policy ), &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+}
+
+/* ==============================  Test Cases for Init ============================== */
+
+/**
+ * @brief Validate that only the limit of the channel type is taken from the
+ * DATA_CHANNEL_OPEN message.
+ */
+void test_dcepReliabilityPolicyInit( void )
+{
+    InitPolicy( DCEP_DATA_CHANNEL_RELIABLE, 5, 3000 );
+    TEST_ASSERT_EQUAL_HEX32( 0xFFFFFFFF, policy.maxRetransmissions );
+    TEST_ASSERT_EQUAL_HEX32( 0xFFFFFFFF, policy.maxLifetimeInMilliseconds );
+
+    InitPolicy( DCEP_DATA_CHANNEL_RELIABLE_UNORDERED, 5, 3000 );
+    TEST_ASSERT_EQUAL_HEX32( 0xFFFFFFFF, policy.maxRetransmissions );
+    TEST_ASSERT_EQUAL_HEX32( 0xFFFFFFFF, policy.maxLifetimeInMilliseconds );
+
+    InitPolicy( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT, 5, 3000 );
+    TEST_ASSERT_EQUAL( 5, policy.maxRetransmissions );
+    TEST_ASSERT_EQUAL_HEX32( 0xFFFFFFFF, policy.maxLifetimeInMilliseconds );
+
+    InitPolicy( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED, 0, 3000 );
+    TEST_ASSERT_EQUAL( 0, policy.maxRetransmissions );
+    TEST_ASSERT_EQUAL_HEX32( 0xFFFFFFFF, policy.maxLifetimeInMilliseconds );
+
+    InitPolicy( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED, 5, 3000 );
+    TEST_ASSERT_EQUAL_HEX32( 0xFFFFFFFF, policy.maxRetransmissions );
+    TEST_ASSERT_EQUAL( 3000, policy.maxLifetimeInMilliseconds );
+
+    InitPolicy( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED, 5, 0 );
+    TEST_ASSERT_EQUAL_HEX32( 0xFFFFFFFF, policy.maxRetransmissions );
+    TEST_ASSERT_EQUAL( 0, policy.maxLifetimeInMilliseconds );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ReliabilityPolicyInit with bad parameters.
+ */
+void test_dcepReliabilityPolicyInit_BadParams( void )
+{
+    DcepResult_t result;
+
+    result = Dcep_ReliabilityPolicyInit( NULL, &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ReliabilityPolicyInit( &( policy ), NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with unknown channel types. */
+    channelOpenMessage.channelType = ( DcepChannelType_t ) 0x03;
+    result = Dcep_ReliabilityPolicyInit( &( policy ), &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    channelOpenMessage.channelType = ( DcepChannelType_t ) 0x100;
+    result = Dcep_ReliabilityPolicyInit( &( policy ), &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/* ==============================  Test Cases for ShouldAbandon ============================== */
+
+/**
+ * @brief Validate the abandon decision at the limits of each channel type,
+ * including when the clock wraps around.
+ */
+void test_dcepReliabilityPolicyShouldAbandon( void )
+{
+    InitPolicy( DCEP_DATA_CHANNEL_RELIABLE, 0, 0 );
+    TEST_ASSERT_EQUAL( 0, Dcep_ReliabilityPolicyShouldAbandon( &( policy ), 0, 1000000, 0x7FFFFFFF ) );
+
+    /* Up to two retransmissions. */
+    InitPolicy( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT, 2, 0 );
+    TEST_ASSERT_EQUAL( 0, Dcep_ReliabilityPolicyShouldAbandon( &( policy ), 0, 0, 0x7FFFFFFF ) );
+    TEST_ASSERT_EQUAL( 0, Dcep_ReliabilityPolicyShouldAbandon( &( policy ), 0, 1, 0x7FFFFFFF ) );
+    TEST_ASSERT_EQUAL( 1, Dcep_ReliabilityPolicyShouldAbandon( &( policy ), 0, 2, 0 ) );
+    TEST_ASSERT_EQUAL( 1, Dcep_ReliabilityPolicyShouldAbandon( &( policy ), 0, 3, 0 ) );
+
+    /* No retransmissions at all. */
+    InitPolicy( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT, 0, 0 );
+    TEST_ASSERT_EQUAL( 1, Dcep_ReliabilityPolicyShouldAbandon( &( policy ), 0, 0, 0 ) );
+
+    /* Up to 100 ms after the message was first sent. */
+    InitPolicy( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED, 0, 100 );
+    TEST_ASSERT_EQUAL( 0, Dcep_ReliabilityPolicyShouldAbandon( &( policy ), 1000, 1000000, 1100 ) );
+    TEST_ASSERT_EQUAL( 1, Dcep_ReliabilityPolicyShouldAbandon( &( policy ), 1000, 0, 1101 ) );
+    TEST_ASSERT_EQUAL( 0, Dcep_ReliabilityPolicyShouldAbandon( &( policy ), 0xFFFFFFF0, 0, 0x00000050 ) );
+    TEST_ASSERT_EQUAL( 1, Dcep_ReliabilityPolicyShouldAbandon( &( policy ), 0xFFFFFFF0, 0, 0x00000080 ) );
+}
+
+/* ==============================  Test Cases for Sweep ============================== */
+
+/**
+ * @brief Validate that a sweep gives the same decision as
+ * Dcep_ReliabilityPolicyShouldAbandon for every message and every channel
+ * type.
+ */
+void test_dcepReliabilityPolicySweep( void )
+{
+    DcepResult_t result;
+    const DcepChannelType_t channelTypes[] =
+    {
+        DCEP_DATA_CHANNEL_RELIABLE,
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT,
+        DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED
+    };
+    uint32_t sendTimesMs[ NUM_MESSAGES ];
+    uint32_t numRetransmissions[ NUM_MESSAGES ];
+    uint8_t abandoned[ NUM_MESSAGES ];
+    const uint32_t currentTimeMs = 10;
+    size_t numAbandoned, expectedAbandoned, t, i;
+
+    /* Messages sent every 10 ms up to now, across a wrap of the clock, and
+     * retransmitted up to four times. */
+    for( i = 0; i < NUM_MESSAGES; i++ )
+    {
+        sendTimesMs[ i ] = currentTimeMs - ( uint32_t ) ( 10 * ( NUM_MESSAGES - 1 - i ) );
+        numRetransmissions[ i ] = ( uint32_t ) ( i % 5 );
+    }
+
+    for( t = 0; t < ( sizeof( channelTypes ) / sizeof( channelTypes[ 0 ] ) ); t++ )
+    {
+        InitPolicy( channelTypes[ t ], 3, 150 );
+        memset( &( abandoned[ 0 ] ), 0xA5, sizeof( abandoned ) );
+        numAbandoned = 0xA5;
+        expectedAbandoned = 0;
+
+        result = Dcep_ReliabilityPolicySweep( &( policy ),
+                                              currentTimeMs,
+                                              &( sendTimesMs[ 0 ] ),
+                                              &( numRetransmissions[ 0 ] ),
+                                              NUM_MESSAGES,
+                                              &( abandoned[ 0 ] ),
+                                              &( numAbandoned ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+        for( i = 0; i < NUM_MESSAGES; i++ )
+        {
+            TEST_ASSERT_EQUAL( Dcep_ReliabilityPolicyShouldAbandon( &( policy ),
+                                                                    sendTimesMs[ i ],
+                                                                    numRetransmissions[ i ],
+                                                                    currentTimeMs ),
+                               abandoned[ i ] );
+            expectedAbandoned += abandoned[ i ];
+        }
+
+        TEST_ASSERT_EQUAL( expectedAbandoned, numAbandoned );
+    }
+
+    /* Reliable: none, rexmit: counts 3 and 4, timed: all but the last 16. */
+    TEST_ASSERT_EQUAL( NUM_MESSAGES - 16, numAbandoned );
+
+    /* An empty queue. */
+    result = Dcep_ReliabilityPolicySweep( &( policy ),
+                                          currentTimeMs,
+                                          &( sendTimesMs[ 0 ] ),
+                                          &( numRetransmissions[ 0 ] ),
+                                          0,
+                                          &( abandoned[ 0 ] ),
+                                          &( numAbandoned ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, numAbandoned );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ReliabilityPolicySweep with bad parameters.
+ */
+void test_dcepReliabilityPolicySweep_BadParams( void )
+{
+    DcepResult_t result;
+    uint32_t sendTimesMs[ 1 ] = { 0 };
+    uint32_t numRetransmissions[ 1 ] = { 0 };
+    uint8_t abandoned[ 1 ];
+    size_t numAbandoned = 0;
+
+    InitPolicy( DCEP_DATA_CHANNEL_RELIABLE, 0, 0 );
+
+    result = Dcep_ReliabilityPolicySweep( NULL, 0, sendTimesMs, numRetransmissions, 1, abandoned, &( numAbandoned ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ReliabilityPolicySweep( &( policy ), 0, NULL, numRetransmissions, 1, abandoned, &( numAbandoned ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ReliabilityPolicySweep( &( policy ), 0, sendTimesMs, NULL, 1, abandoned, &( numAbandoned ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ReliabilityPolicySweep( &( policy ), 0, sendTimesMs, numRetransmissions, 1, NULL, &( numAbandoned ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_ReliabilityPolicySweep( &( policy ), 0, sendTimesMs, numRetransmissions, 1, abandoned, NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,247 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "dcep_api.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define MAX_KERNELS    3
+
+DcepValidateHeaderBlock_t kernels[ MAX_KERNELS ];
+size_t numKernels;
+DcepHeaderBlock_t headerBlock;
+
+void setUp( void )
+{
+    numKernels = 0;
+    kernels[ numKernels++ ] = Dcep_ValidateHeaderBlockScalar;
+
+    #if defined( DCEP_SIMD_X86 )
+        __builtin_cpu_init();
+
+        if( __builtin_cpu_supports( "sse4.1" ) )
+        {
+            kernels[ numKernels++ ] = Dcep_ValidateHeaderBlockSse41;
+        }
+
+        if( __builtin_cpu_supports( "avx2" ) )
+        {
+            kernels[ numKernels++ ] = Dcep_ValidateHeaderBlockAvx2;
+        }
+    #endif
+
+    memset( &( headerBlock ), 0, sizeof( headerBlock ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Helpers ============================== */
+
+static void SetHeader( DcepHeaderBlock_t * pBlock,
+                       size_t index,
+                       uint8_t messageType,
+                       uint8_t channelType,
+                       uint16_t priority,
+                       uint32_t reliabilityParameter,
+                       uint16_t labelLength,
+                       uint16_t protocolLength,
+                       uint32_t messageLength )
+{
+    uint8_t networkPriority[ 2 ];
+    uint8_t networkReliabilityParameter[ 4 ];
+    uint8_t networkLabelLength[ 2 ];
+    uint8_t networkProtocolLength[ 2 ];
+
+    networkPriority[ 0 ] = ( uint8_t ) ( priority >> 8 );
+    networkPriority[ 1 ] = ( uint8_t ) priority;
+    networkReliabilityParameter[ 0 ] = ( uint8_t ) ( reliabilityParameter >> 24 );
+    networkReliabilityParameter[ 1 ] = ( uint8_t ) ( reliabilityParameter >> 16 );
+    networkReliabilityParameter[ 2 ] = ( uint8_t ) ( reliabilityParameter >> 8 );
+    networkReliabilityParameter[ 3 ] = ( uint8_t ) reliabilityParameter;
+    networkLabelLength[ 0 ] = ( uint8_t ) ( labelLength >> 8 );
+    networkLabelLength[ 1 ] = ( uint8_t ) labelLength;
+    networkProtocolLength[ 0 ] = ( uint8_t ) ( protocolLength >> 8 );
+    networkProtocolLength[ 1 ] = ( uint8_t ) protocolLength;
+
+    pBlock->messageType[ index ] = messageType;
+    pBlock->channelType[ index ] = channelType;
+    memcpy( &( pBlock->priority[ index ] ), &( networkPriority[ 0 ] ), 2 );
+    memcpy( &( pBlock->reliabilityParameter[ index ] ), &( networkReliabilityParameter[ 0 ] ), 4 );
+    memcpy( &( pBlock->labelLength[ index ] ), &( networkLabelLength[ 0 ] ), 2 );
+    memcpy( &( pBlock->protocolLength[ index ] ), &( networkProtocolLength[ 0 ] ), 2 );
+    pBlock->messageLength[ index ] = messageLength;
+}
+
+/* ==============================  Test Cases for Header Block Kernels ============================== */
+
+/**
+ * @brief Validate that every kernel converts fields to host byte order.
+ */
+void test_dcepValidateHeaderBlock_ByteOrder( void )
+{
+    DcepHeaderBlock_t block;
+    uint16_t validMask;
+    size_t k, i;
+
+    for( k = 0; k < numKernels; k++ )
+    {
+        memset( &( block ), 0, sizeof( block ) );
+
+        for( i = 0; i < DCEP_HEADER_BLOCK_SIZE; i++ )
+        {
+            SetHeader( &( block ),
+                       i,
+                       DCEP_MESSAGE_DATA_CHANNEL_OPEN,
+                       DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT,
+                       ( uint16_t ) ( 0x0100 + i ),
+                       ( uint32_t ) ( 0x01020300 + i ),
+                       ( uint16_t ) ( 0x0010 + i ),
+                       ( uint16_t ) ( 0x0200 + i ),
+                       0x1000 );
+        }
+
+        validMask = kernels[ k ]( &( block ), DCEP_HEADER_BLOCK_SIZE );
+
+        TEST_ASSERT_EQUAL_HEX16( 0xFFFF, validMask );
+
+        for( i = 0; i < DCEP_HEADER_BLOCK_SIZE; i++ )
+        {
+            TEST_ASSERT_EQUAL( 0x0100 + i, block.priority[ i ] );
+            TEST_ASSERT_EQUAL( 0x01020300 + i, block.reliabilityParameter[ i ] );
+            TEST_ASSERT_EQUAL( 0x0010 + i, block.labelLength[ i ] );
+            TEST_ASSERT_EQUAL( 0x0200 + i, block.protocolLength[ i ] );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that every kernel accepts all channel types and rejects
+ * invalid message types, channel types and lengths.
+ */
+void test_dcepValidateHeaderBlock_Validity( void )
+{
+    DcepHeaderBlock_t block;
+    uint16_t validMask;
+    size_t k;
+
+    for( k = 0; k < numKernels; k++ )
+    {
+        memset( &( block ), 0, sizeof( block ) );
+
+        /* Valid headers, one per channel type. */
+        SetHeader( &( block ), 0, DCEP_MESSAGE_DATA_CHANNEL_OPEN, DCEP_DATA_CHANNEL_RELIABLE, 0, 0, 0, 0, 12 );
+        SetHeader( &( block ), 1, DCEP_MESSAGE_DATA_CHANNEL_OPEN, DCEP_DATA_CHANNEL_RELIABLE_UNORDERED, 0, 0, 0, 0, 12 );
+        SetHeader( &( block ), 2, DCEP_MESSAGE_DATA_CHANNEL_OPEN, DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT, 0, 0, 0, 0, 12 );
+        SetHeader( &( block ), 3, DCEP_MESSAGE_DATA_CHANNEL_OPEN, DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED, 0, 0, 0, 0, 12 );
+        SetHeader( &( block ), 4, DCEP_MESSAGE_DATA_CHANNEL_OPEN, DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED, 0, 0, 0, 0, 12 );
+        SetHeader( &( block ), 5, DCEP_MESSAGE_DATA_CHANNEL_OPEN, DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED_UNORDERED, 0, 0, 0, 0, 12 );
+
+        /* Invalid message types. */
+        SetHeader( &( block ), 6, DCEP_MESSAGE_DATA_CHANNEL_ACK, DCEP_DATA_CHANNEL_RELIABLE, 0, 0, 0, 0, 12 );
+        SetHeader( &( block ), 7, 0xFF, DCEP_DATA_CHANNEL_RELIABLE, 0, 0, 0, 0, 12 );
+
+        /* Invalid channel types. */
+        SetHeader( &( block ), 8, DCEP_MESSAGE_DATA_CHANNEL_OPEN, 0x03, 0, 0, 0, 0, 12 );
+        SetHeader( &( block ), 9, DCEP_MESSAGE_DATA_CHANNEL_OPEN, 0x83, 0, 0, 0, 0, 12 );
+        SetHeader( &( block ), 10, DCEP_MESSAGE_DATA_CHANNEL_OPEN, 0x7F, 0, 0, 0, 0, 12 );
+
+        /* Label and protocol exactly fit. */
+        SetHeader( &( block ), 11, DCEP_MESSAGE_DATA_CHANNEL_OPEN, DCEP_DATA_CHANNEL_RELIABLE, 0, 0, 0xFFFF, 0xFFFF, 12 + 0xFFFF + 0xFFFF );
+
+        /* Label overrun. */
+        SetHeader( &( block ), 12, DCEP_MESSAGE_DATA_CHANNEL_OPEN, DCEP_DATA_CHANNEL_RELIABLE, 0, 0, 5, 0, 16 );
+
+        /* Protocol overrun. */
+        SetHeader( &( block ), 13, DCEP_MESSAGE_DATA_CHANNEL_OPEN, DCEP_DATA_CHANNEL_RELIABLE, 0, 0, 2, 3, 16 );
+
+        /* Length above 2^31 must compare as unsigned. */
+        SetHeader( &( block ), 14, DCEP_MESSAGE_DATA_CHANNEL_OPEN, DCEP_DATA_CHANNEL_RELIABLE, 0, 0, 2, 3, 0x80000000UL );
+
+        /* Slot 15 is left zero. */
+
+        validMask = kernels[ k ]( &( block ), DCEP_HEADER_BLOCK_SIZE );
+
+        TEST_ASSERT_EQUAL_HEX16( 0x483F, validMask );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that every kernel ignores slots beyond numHeaders and
+ * clamps numHeaders to the block size.
+ */
+void test_dcepValidateHeaderBlock_PartialBlock( void )
+{
+    DcepHeaderBlock_t block;
+    uint16_t validMask;
+    size_t k, i;
+
+    for( k = 0; k < numKernels; k++ )
+    {
+        memset( &( block ), 0, sizeof( block ) );
+
+        for( i = 0; i < DCEP_HEADER_BLOCK_SIZE; i++ )
+        {
+            SetHeader( &( block ), i, DCEP_MESSAGE_DATA_CHANNEL_OPEN, DCEP_DATA_CHANNEL_RELIABLE, 0, 0, 0, 0, 12 );
+        }
+
+        validMask = kernels[ k ]( &( block ), 5 );
+        TEST_ASSERT_EQUAL_HEX16( 0x001F, validMask );
+
+        validMask = kernels[ k ]( &( block ), 0 );
+        TEST_ASSERT_EQUAL_HEX16( 0x0000, validMask );
+
+        validMask = kernels[ k ]( &( block ), DCEP_HEADER_BLOCK_SIZE + 1 );
+        TEST_ASSERT_EQUAL_HEX16( 0xFFFF, validMask );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Dcep_SelectValidateHeaderBlockFunction returns a
+ * kernel that agrees with the scalar kernel.
+ */
+void test_dcepSelectValidateHeaderBlockFunction( void )
+{
+    DcepValidateHeaderBlock_t validateFn;
+    DcepHeaderBlock_t scalarBlock;
+    uint16_t scalarMask, selectedMask;
+    size_t i;
+
+    validateFn = Dcep_SelectValidateHeaderBlockFunction();
+    TEST_ASSERT_NOT_NULL( validateFn );
+
+    for( i = 0; i < DCEP_HEADER_BLOCK_SIZE; i++ )
+    {
+        SetHeader( &( headerBlock ),
+                   i,
+                   ( i % 5 ) == 0 ? DCEP_MESSAGE_DATA_CHANNEL_ACK : DCEP_MESSAGE_DATA_CHANNEL_OPEN,
+                   ( uint8_t ) ( ( i * 0x41 ) & 0x83 ),
+                   ( uint16_t ) ( i * 7 ),
+                   ( uint32_t ) ( i * 1000 ),
+                   ( uint16_t ) i,
+                   ( uint16_t ) ( i * 2 ),
+                   ( uint32_t ) ( 12 + ( i * 3 ) - ( i % 2 ) ) );
+    }
+
+    memcpy( &( scalarBlock ), &( headerBlock ), sizeof( headerBlock ) );
+
+    scalarMask = Dcep_ValidateHeaderBlockScalar( &( scalarBlock ), DCEP_HEADER_BLOCK_SIZE );
+    selectedMask = validateFn( &( headerBlock ), DCEP_HEADER_BLOCK_SIZE );
+
+    TEST_ASSERT_EQUAL_HEX16( scalarMask, selectedMask );
+    TEST_ASSERT_EQUAL_MEMORY( &( scalarBlock ), &( headerBlock ), sizeof( headerBlock ) );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,352 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "dcep_state_machine.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define MAX_BUFFER_LENGTH       1024
+#define REGISTRY_CAPACITY       16
+#define REGISTRY_MEMORY_WORDS   ( ( REGISTRY_CAPACITY * 48 ) / sizeof( uint64_t ) )
+
+uint8_t testBuffer[ MAX_BUFFER_LENGTH ];
+uint64_t registryMemory[ REGISTRY_MEMORY_WORDS ];
+DcepContext_t ctx;
+DcepChannelRegistry_t registry;
+
+void setUp( void )
+{
+    DcepResult_t result;
+
+    memset( &( testBuffer[ 0 ] ), 0, sizeof( testBuffer ) );
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_ChannelRegistryInit( &( registry ),
+                                       &( registryMemory[ 0 ] ),
+                                       sizeof( registryMemory ),
+                                       REGISTRY_CAPACITY );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Test Cases for Opening Side ============================== */
+
+/**
+ * @brief Validate the handshake on the side that opens the channel.
+ */
+void test_dcepOpenChannel_Handshake( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t channelOpenMessage;
+    DcepProcessedMessage_t processedMessage;
+    DcepChannelState_t state;
+    size_t bufferLength = sizeof( testBuffer );
+    size_t ackBufferLength;
+    uint8_t ackBuffer[ 4 ];
+    uint8_t ackMessage[] = { 0x02 };
+    uint8_t expectedMessage[] = { 0x03, 0x81, 0x01, 0x00, 0x00, 0x00, 0x00, 0x03,
+                                  0x00, 0x04, 0x00, 0x00, 't', 'e', 's', 't' };
+    const uint8_t label[] = "test";
+
+    memset( &( channelOpenMessage ), 0, sizeof( channelOpenMessage ) );
+    channelOpenMessage.channelType = DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_REXMIT_UNORDERED;
+    channelOpenMessage.priority = 256;
+    channelOpenMessage.numRetransmissions = 3;
+    channelOpenMessage.pChannelName = &( label[ 0 ] );
+    channelOpenMessage.channelNameLength = 4;
+
+    result = Dcep_OpenChannel( &( ctx ),
+                               &( registry ),
+                               2,
+                               &( channelOpenMessage ),
+                               &( testBuffer[ 0 ] ),
+                               &( bufferLength ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( sizeof( expectedMessage ), bufferLength );
+    TEST_ASSERT_EQUAL_UINT8_ARRAY( &( expectedMessage[ 0 ] ), &( testBuffer[ 0 ] ), sizeof( expectedMessage ) );
+
+    result = Dcep_ChannelRegistryGetState( &( registry ), 2, &( state ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_CHANNEL_STATE_OPENING, state );
+
+    /* The peer's ACK opens the channel and nothing is sent in response. */
+    ackBufferLength = sizeof( ackBuffer );
+    result = Dcep_ProcessMessage( &( ctx ),
+                                  &( registry ),
+                                  2,
+                                  &( ackMessage[ 0 ] ),
+                                  sizeof( ackMessage ),
+                                  &( ackBuffer[ 0 ] ),
+                                  &( ackBufferLength ),
+                                  &( processedMessage ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, ackBufferLength );
+    TEST_ASSERT_EQUAL( DCEP_MESSAGE_DATA_CHANNEL_ACK, processedMessage.messageType );
+    TEST_ASSERT_EQUAL( DCEP_CHANNEL_STATE_OPEN, processedMessage.channelState );
+
+    result = Dcep_ChannelRegistryGetState( &( registry ), 2, &( state ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_CHANNEL_STATE_OPEN, state );
+
+    /* A second ACK is unexpected. */
+    ackBufferLength = sizeof( ackBuffer );
+    result = Dcep_ProcessMessage( &( ctx ),
+                                  &( registry ),
+                                  2,
+                                  &( ackMessage[ 0 ] ),
+                                  sizeof( ackMessage ),
+                                  &( ackBuffer[ 0 ] ),
+                                  &( ackBufferLength ),
+                                  &( processedMessage ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_INVALID_STATE, result );
+
+    /* Closing the channel removes it. */
+    result = Dcep_CloseChannel( &( registry ), 2 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_ChannelRegistryGetState( &( registry ), 2, &( state ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+    result = Dcep_CloseChannel( &( registry ), 2 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_OpenChannel failures leave the registry unchanged.
+ */
+void test_dcepOpenChannel_Failures( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t channelOpenMessage;
+    DcepChannelState_t state;
+    size_t bufferLength;
+    const uint8_t label[] = "test";
+
+    memset( &( channelOpenMessage ), 0, sizeof( channelOpenMessage ) );
+    channelOpenMessage.channelType = DCEP_DATA_CHANNEL_RELIABLE;
+    channelOpenMessage.pChannelName = &( label[ 0 ] );
+    channelOpenMessage.channelNameLength = 4;
+
+    /* Buffer too small for the DATA_CHANNEL_OPEN message. */
+    bufferLength = DCEP_HEADER_LENGTH + 3;
+    result = Dcep_OpenChannel( &( ctx ), &( registry ), 4, &( channelOpenMessage ), &( testBuffer[ 0 ] ), &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+    TEST_ASSERT_EQUAL( 0, registry.count );
+
+    result = Dcep_ChannelRegistryGetState( &( registry ), 4, &( state ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+    /* Stream id already in use. */
+    bufferLength = sizeof( testBuffer );
+    result = Dcep_OpenChannel( &( ctx ), &( registry ), 4, &( channelOpenMessage ), &( testBuffer[ 0 ] ), &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    bufferLength = sizeof( testBuffer );
+    result = Dcep_OpenChannel( &( ctx ), &( registry ), 4, &( channelOpenMessage ), &( testBuffer[ 0 ] ), &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_ALREADY_EXISTS, result );
+    TEST_ASSERT_EQUAL( 1, registry.count );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_OpenChannel with bad parameters.
+ */
+void test_dcepOpenChannel_BadParams( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t channelOpenMessage;
+    size_t bufferLength = sizeof( testBuffer );
+
+    memset( &( channelOpenMessage ), 0, sizeof( channelOpenMessage ) );
+
+    /* Test with NULL context. */
+    result = Dcep_OpenChannel( NULL, &( registry ), 4, &( channelOpenMessage ), &( testBuffer[ 0 ] ), &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL registry. */
+    result = Dcep_OpenChannel( &( ctx ), NULL, 4, &( channelOpenMessage ), &( testBuffer[ 0 ] ), &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL channel open message. */
+    result = Dcep_OpenChannel( &( ctx ), &( registry ), 4, NULL, &( testBuffer[ 0 ] ), &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL buffer. */
+    result = Dcep_OpenChannel( &( ctx ), &( registry ), 4, &( channelOpenMessage ), NULL, &( bufferLength ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL buffer length. */
+    result = Dcep_OpenChannel( &( ctx ), &( registry ), 4, &( channelOpenMessage ), &( testBuffer[ 0 ] ), NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    TEST_ASSERT_EQUAL( 0, registry.count );
+}
+
+/* ==============================  Test Cases for Receiving Side ============================== */
+
+/**
+ * @brief Validate that an inbound DATA_CHANNEL_OPEN opens the channel and
+ * produces a DATA_CHANNEL_ACK.
+ */
+void test_dcepProcessMessage_ChannelOpen( void )
+{
+    DcepResult_t result;
+    DcepProcessedMessage_t processedMessage;
+    DcepChannelOpenMessage_t registeredMessage;
+    DcepChannelState_t state;
+    uint8_t ackBuffer[ 4 ] = { 0 };
+    size_t ackBufferLength = sizeof( ackBuffer );
+    uint8_t openMessage[] = { 0x03, 0x02, 0x00, 0x10, 0x00, 0x00, 0x01, 0xF4,
+                              0x00, 0x04, 0x00, 0x03, 't', 'e', 's', 't',
+                              'p', 'r', 'o' };
+
+    result = Dcep_ProcessMessage( &( ctx ),
+                                  &( registry ),
+                                  7,
+                                  &( openMessage[ 0 ] ),
+                                  sizeof( openMessage ),
+                                  &( ackBuffer[ 0 ] ),
+                                  &( ackBufferLength ),
+                                  &( processedMessage ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, ackBufferLength );
+    TEST_ASSERT_EQUAL( DCEP_MESSAGE_DATA_CHANNEL_ACK, ackBuffer[ 0 ] );
+    TEST_ASSERT_EQUAL( DCEP_MESSAGE_DATA_CHANNEL_OPEN, processedMessage.messageType );
+    TEST_ASSERT_EQUAL( DCEP_CHANNEL_STATE_OPEN, processedMessage.channelState );
+    TEST_ASSERT_EQUAL( DCEP_DATA_CHANNEL_PARTIAL_RELIABLE_TIMED, processedMessage.channelOpenMessage.channelType );
+    TEST_ASSERT_EQUAL( 500, processedMessage.channelOpenMessage.maxLifetimeInMilliseconds );
+    TEST_ASSERT_EQUAL_PTR( &( openMessage[ 12 ] ), processedMessage.channelOpenMessage.pChannelName );
+    TEST_ASSERT_EQUAL_PTR( &( openMessage[ 16 ] ), processedMessage.channelOpenMessage.pProtocol );
+
+    result = Dcep_ChannelRegistryGetState( &( registry ), 7, &( state ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_CHANNEL_STATE_OPEN, state );
+
+    result = Dcep_ChannelRegistryGetChannel( &( registry ), 7, &( registeredMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0x0010, registeredMessage.priority );
+    TEST_ASSERT_EQUAL( 500, registeredMessage.maxLifetimeInMilliseconds );
+    TEST_ASSERT_EQUAL( 4, registeredMessage.channelNameLength );
+    TEST_ASSERT_EQUAL( 3, registeredMessage.protocolLength );
+
+    /* A second DATA_CHANNEL_OPEN on the same stream is rejected. */
+    ackBufferLength = sizeof( ackBuffer );
+    result = Dcep_ProcessMessage( &( ctx ),
+                                  &( registry ),
+                                  7,
+                                  &( openMessage[ 0 ] ),
+                                  sizeof( openMessage ),
+                                  &( ackBuffer[ 0 ] ),
+                                  &( ackBufferLength ),
+                                  &( processedMessage ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_ALREADY_EXISTS, result );
+    TEST_ASSERT_EQUAL( 1, registry.count );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that invalid inbound messages do not change the registry.
+ */
+void test_dcepProcessMessage_Failures( void )
+{
+    DcepResult_t result;
+    DcepProcessedMessage_t processedMessage;
+    uint8_t ackBuffer[ 4 ];
+    size_t ackBufferLength;
+    uint8_t openMessage[] = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                              0x00, 0x00, 0x00, 0x00 };
+    uint8_t invalidChannelTypeMessage[] = { 0x03, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                            0x00, 0x00, 0x00, 0x00 };
+    uint8_t ackMessage[] = { 0x02 };
+    uint8_t unknownMessage[] = { 0x7F };
+
+    /* ACK buffer too small. */
+    ackBufferLength = 0;
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 1, &( openMessage[ 0 ] ), sizeof( openMessage ), &( ackBuffer[ 0 ] ), &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+
+    /* DATA_CHANNEL_OPEN shorter than the header. */
+    ackBufferLength = sizeof( ackBuffer );
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 1, &( openMessage[ 0 ] ), DCEP_HEADER_LENGTH - 1, &( ackBuffer[ 0 ] ), &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    /* DATA_CHANNEL_OPEN with an invalid channel type. */
+    ackBufferLength = sizeof( ackBuffer );
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 1, &( invalidChannelTypeMessage[ 0 ] ), sizeof( invalidChannelTypeMessage ), &( ackBuffer[ 0 ] ), &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    /* DATA_CHANNEL_ACK for an unknown channel. */
+    ackBufferLength = sizeof( ackBuffer );
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 1, &( ackMessage[ 0 ] ), sizeof( ackMessage ), &( ackBuffer[ 0 ] ), &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+    /* Unknown message type. */
+    ackBufferLength = sizeof( ackBuffer );
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 1, &( unknownMessage[ 0 ] ), sizeof( unknownMessage ), &( ackBuffer[ 0 ] ), &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    TEST_ASSERT_EQUAL( 0, registry.count );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_ProcessMessage with bad parameters.
+ */
+void test_dcepProcessMessage_BadParams( void )
+{
+    DcepResult_t result;
+    DcepProcessedMessage_t processedMessage;
+    uint8_t ackBuffer[ 4 ];
+    size_t ackBufferLength = sizeof( ackBuffer );
+    uint8_t ackMessage[] = { 0x02 };
+
+    /* Test with NULL context. */
+    result = Dcep_ProcessMessage( NULL, &( registry ), 1, &( ackMessage[ 0 ] ), sizeof( ackMessage ), &( ackBuffer[ 0 ] ), &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL registry. */
+    result = Dcep_ProcessMessage( &( ctx ), NULL, 1, &( ackMessage[ 0 ] ), sizeof( ackMessage ), &( ackBuffer[ 0 ] ), &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL message. */
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 1, NULL, sizeof( ackMessage ), &( ackBuffer[ 0 ] ), &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with zero message length. */
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 1, &( ackMessage[ 0 ] ), 0, &( ackBuffer[ 0 ] ), &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL ACK buffer. */
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 1, &( ackMessage[ 0 ] ), sizeof( ackMessage ), NULL, &( ackBufferLength ), &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL ACK buffer length. */
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 1, &( ackMessage[ 0 ] ), sizeof( ackMessage ), &( ackBuffer[ 0 ] ), NULL, &( processedMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with NULL processed message. */
+    result = Dcep_ProcessMessage( &( ctx ), &( registry ), 1, &( ackMessage[ 0 ] ), sizeof( ackMessage ), &( ackBuffer[ 0 ] ), &( ackBufferLength ), NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,355 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "dcep_stream_id_allocator.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+DcepStreamIdAllocator_t allocator;
+
+void setUp( void )
+{
+    memset( &( allocator ), 0xA5, sizeof( allocator ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Helpers ============================== */
+
+static uint8_t IsStreamIdUsed( uint16_t streamId )
+{
+    return ( uint8_t ) ( ( allocator.usedBits[ streamId / 32 ] >> ( streamId % 32 ) ) & 1U );
+}
+
+/* ==============================  Test Cases for Initialization ============================== */
+
+/**
+ * @brief Validate Dcep_StreamIdAllocatorInit for both DTLS roles.
+ */
+void test_dcepStreamIdAllocatorInit( void )
+{
+    DcepResult_t result;
+
+    result = Dcep_StreamIdAllocatorInit( &( allocator ), DCEP_DTLS_ROLE_CLIENT );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 32768, allocator.freeCount );
+    TEST_ASSERT_EQUAL( 1, IsStreamIdUsed( DCEP_STREAM_ID_RESERVED ) );
+    TEST_ASSERT_EQUAL( 0, IsStreamIdUsed( 0 ) );
+
+    result = Dcep_StreamIdAllocatorInit( &( allocator ), DCEP_DTLS_ROLE_SERVER );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 32767, allocator.freeCount );
+    TEST_ASSERT_EQUAL( 1, IsStreamIdUsed( DCEP_STREAM_ID_RESERVED ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_StreamIdAllocatorInit with bad parameters.
+ */
+void test_dcepStreamIdAllocatorInit_BadParams( void )
+{
+    DcepResult_t result;
+
+    result = Dcep_StreamIdAllocatorInit( NULL, DCEP_DTLS_ROLE_CLIENT );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_StreamIdAllocatorInit( &( allocator ), ( DcepDtlsRole_t ) 2 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/* ==============================  Test Cases for Allocation ============================== */
+
+/**
+ * @brief Validate that the DTLS client allocates even stream ids in order.
+ */
+void test_dcepStreamIdAllocatorAllocate_Client( void )
+{
+    DcepResult_t result;
+    uint16_t streamId = 0, i;
+
+    result = Dcep_StreamIdAllocatorInit( &( allocator ), DCEP_DTLS_ROLE_CLIENT );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    for( i = 0; i < 40; i++ )
+    {
+        result = Dcep_StreamIdAllocatorAllocate( &( allocator ), &( streamId ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( i * 2, streamId );
+        TEST_ASSERT_EQUAL( 1, IsStreamIdUsed( streamId ) );
+    }
+
+    TEST_ASSERT_EQUAL( 32768 - 40, allocator.freeCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the DTLS server allocates odd stream ids in order.
+ */
+void test_dcepStreamIdAllocatorAllocate_Server( void )
+{
+    DcepResult_t result;
+    uint16_t streamId = 0, i;
+
+    result = Dcep_StreamIdAllocatorInit( &( allocator ), DCEP_DTLS_ROLE_SERVER );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    for( i = 0; i < 40; i++ )
+    {
+        result = Dcep_StreamIdAllocatorAllocate( &( allocator ), &( streamId ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( ( i * 2 ) + 1, streamId );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that every stream id of the local parity can be allocated
+ * exactly once and that the reserved stream id is never allocated.
+ */
+void test_dcepStreamIdAllocatorAllocate_Exhaustion( void )
+{
+    DcepResult_t result;
+    uint16_t streamId = 0;
+    uint32_t i;
+
+    result = Dcep_StreamIdAllocatorInit( &( allocator ), DCEP_DTLS_ROLE_SERVER );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    for( i = 0; i < 32767; i++ )
+    {
+        result = Dcep_StreamIdAllocatorAllocate( &( allocator ), &( streamId ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( ( i * 2 ) + 1, streamId );
+    }
+
+    result = Dcep_StreamIdAllocatorAllocate( &( allocator ), &( streamId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+
+    /* A released stream id is handed out again. */
+    result = Dcep_StreamIdAllocatorRelease( &( allocator ), 4001 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamIdAllocatorAllocate( &( allocator ), &( streamId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 4001, streamId );
+
+    result = Dcep_StreamIdAllocatorAllocate( &( allocator ), &( streamId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the search wraps around to free stream ids before the
+ * search hint.
+ */
+void test_dcepStreamIdAllocatorAllocate_WrapAround( void )
+{
+    DcepResult_t result;
+    uint16_t streamId = 0;
+
+    result = Dcep_StreamIdAllocatorInit( &( allocator ), DCEP_DTLS_ROLE_CLIENT );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Use every stream id except 10. */
+    result = Dcep_StreamIdAllocatorReserve( &( allocator ), 0, 10 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamIdAllocatorReserve( &( allocator ), 11, DCEP_STREAM_ID_RESERVED - 11 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, allocator.freeCount );
+
+    allocator.searchHint = 100;
+
+    result = Dcep_StreamIdAllocatorAllocate( &( allocator ), &( streamId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 10, streamId );
+    TEST_ASSERT_EQUAL( 0, allocator.freeCount );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the search finds the only free stream id wherever it
+ * is relative to the search hint: in a later group of words, in a group
+ * tracked by another word of nonFullGroups, and in the group of the search
+ * hint but before it.
+ */
+void test_dcepStreamIdAllocatorAllocate_NonFullWords( void )
+{
+    const uint16_t freeStreamIds[] = { 40000, 10, 65534, 0, 2000 };
+    const size_t searchHints[] = { 100, 5, 0, 2047, 63 };
+    DcepResult_t result;
+    uint16_t streamId = 0;
+    size_t i;
+
+    result = Dcep_StreamIdAllocatorInit( &( allocator ), DCEP_DTLS_ROLE_CLIENT );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamIdAllocatorReserve( &( allocator ), 0, DCEP_STREAM_ID_RESERVED );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, allocator.freeCount );
+
+    for( i = 0; i < DCEP_STREAM_ID_ALLOCATOR_NUM_GROUP_WORDS; i++ )
+    {
+        TEST_ASSERT_EQUAL( 0, allocator.nonFullGroups[ i ] );
+    }
+
+    for( i = 0; i < ( sizeof( searchHints ) / sizeof( searchHints[ 0 ] ) ); i++ )
+    {
+        result = Dcep_StreamIdAllocatorRelease( &( allocator ), freeStreamIds[ i ] );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+        allocator.searchHint = searchHints[ i ];
+
+        result = Dcep_StreamIdAllocatorAllocate( &( allocator ), &( streamId ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        TEST_ASSERT_EQUAL( freeStreamIds[ i ], streamId );
+        TEST_ASSERT_EQUAL( 0, allocator.nonFullWords[ streamId / ( 32 * 32 ) ] );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_StreamIdAllocatorAllocate with bad parameters.
+ */
+void test_dcepStreamIdAllocatorAllocate_BadParams( void )
+{
+    DcepResult_t result;
+    uint16_t streamId = 0;
+
+    result = Dcep_StreamIdAllocatorInit( &( allocator ), DCEP_DTLS_ROLE_CLIENT );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamIdAllocatorAllocate( NULL, &( streamId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_StreamIdAllocatorAllocate( &( allocator ), NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/* ==============================  Test Cases for Release ============================== */
+
+/**
+ * @brief Validate Dcep_StreamIdAllocatorRelease.
+ */
+void test_dcepStreamIdAllocatorRelease( void )
+{
+    DcepResult_t result;
+    uint16_t streamId = 0;
+
+    result = Dcep_StreamIdAllocatorInit( &( allocator ), DCEP_DTLS_ROLE_CLIENT );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamIdAllocatorAllocate( &( allocator ), &( streamId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamIdAllocatorRelease( &( allocator ), streamId );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, IsStreamIdUsed( streamId ) );
+    TEST_ASSERT_EQUAL( 32768, allocator.freeCount );
+
+    /* Releasing a free stream id fails. */
+    result = Dcep_StreamIdAllocatorRelease( &( allocator ), streamId );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+    /* Releasing a reserved stream id of the peer parity does not change the
+     * number of free local stream ids. */
+    result = Dcep_StreamIdAllocatorReserve( &( allocator ), 3, 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 32768, allocator.freeCount );
+
+    result = Dcep_StreamIdAllocatorRelease( &( allocator ), 3 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 32768, allocator.freeCount );
+
+    /* Test with bad parameters. */
+    result = Dcep_StreamIdAllocatorRelease( NULL, 0 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_StreamIdAllocatorRelease( &( allocator ), DCEP_STREAM_ID_RESERVED );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+}
+
+/* ==============================  Test Cases for Bulk Reserve ============================== */
+
+/**
+ * @brief Validate Dcep_StreamIdAllocatorReserve across word boundaries and
+ * over stream ids that are already in use.
+ */
+void test_dcepStreamIdAllocatorReserve( void )
+{
+    DcepResult_t result;
+    uint16_t streamId = 0;
+    uint32_t i;
+
+    result = Dcep_StreamIdAllocatorInit( &( allocator ), DCEP_DTLS_ROLE_CLIENT );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* 0 and 2 are allocated before the reserve. */
+    result = Dcep_StreamIdAllocatorAllocate( &( allocator ), &( streamId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    result = Dcep_StreamIdAllocatorAllocate( &( allocator ), &( streamId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Reserve 1 to 100, which spans four words. */
+    result = Dcep_StreamIdAllocatorReserve( &( allocator ), 1, 100 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    for( i = 0; i < 110; i++ )
+    {
+        TEST_ASSERT_EQUAL( ( i <= 100 ) ? 1 : 0, IsStreamIdUsed( ( uint16_t ) i ) );
+    }
+
+    /* Even ids 0 to 100 are in use. */
+    TEST_ASSERT_EQUAL( 32768 - 51, allocator.freeCount );
+
+    result = Dcep_StreamIdAllocatorAllocate( &( allocator ), &( streamId ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 102, streamId );
+
+    /* An empty range is accepted. */
+    result = Dcep_StreamIdAllocatorReserve( &( allocator ), 500, 0 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 0, IsStreamIdUsed( 500 ) );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate Dcep_StreamIdAllocatorReserve with bad parameters.
+ */
+void test_dcepStreamIdAllocatorReserve_BadParams( void )
+{
+    DcepResult_t result;
+
+    result = Dcep_StreamIdAllocatorInit( &( allocator ), DCEP_DTLS_ROLE_CLIENT );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Test with NULL allocator. */
+    result = Dcep_StreamIdAllocatorReserve( NULL, 0, 1 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with a range that includes the reserved stream id. */
+    result = Dcep_StreamIdAllocatorReserve( &( allocator ), 65530, 6 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with a count large enough to wrap. */
+    result = Dcep_StreamIdAllocatorReserve( &( allocator ), 10, SIZE_MAX );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    TEST_ASSERT_EQUAL( 32768, allocator.freeCount );
+}
+
+/*-----------------------------------------------------------*/
@@ -0,0 +1,348 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "dcep_timer_wheel.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define WHEEL_CAPACITY    64
+
+/* Allocated in setUp with the size given by Dcep_TimerWheelGetMemorySize. */
+uint8_t * pWheelMemory;
+size_t wheelMemorySize;
+DcepTimerWheel_t timerWheel;
+uint16_t expiredStreamIds[ WHEEL_CAPACITY ];
+
+void setUp( void )
+{
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, Dcep_TimerWheelGetMemorySize( WHEEL_CAPACITY, &( wheelMemorySize ) ) );
+
+    pWheelMemory = malloc( wheelMemorySize );
+    TEST_ASSERT_NOT_NULL( pWheelMemory );
+
+    memset( pWheelMemory, 0xA5, wheelMemorySize );
+    memset( &( timerWheel ), 0, sizeof( timerWheel ) );
+    memset( &( expiredStreamIds[ 0 ] ), 0, sizeof( expiredStreamIds ) );
+}
+
+void tearDown( void )
+{
+    free( pWheelMemory );
+    pWheelMemory = NULL;
+}
+
+/* ==============================  Helpers ============================== */
+
+static void InitWheel( uint32_t currentTick )
+{
+    DcepResult_t result;
+
+    result = Dcep_TimerWheelInit( &( timerWheel ),
+                                  pWheelMemory,
+                                  wheelMemorySize,
+                                  WHEEL_CAPACITY,
+                                  currentTick );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+}
+
+static size_t Advance( uint32_t currentTick )
+{
+    DcepResult_t result;
+    size_t numExpired = 0;
+
+    result = Dcep_TimerWheelAdvance( &( timerWheel ),
+                                     currentTick,
+                                     &( expiredStreamIds[ 0 ] ),
+                                     WHEEL_CAPACITY,
+                                     &( numExpired ) );
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    return numExpired;
+}
+
+/* ==============================  Test Cases for Initialization ============================== */
+
+/**
+ * @brief Validate Dcep_TimerWheelGetMemorySize and Dcep_TimerWheelInit.
+ */
+void test_dcepTimerWheelInit( void )
+{
+    DcepResult_t result;
+    size_t memorySize = 0;
+
+    result = Dcep_TimerWheelGetMemorySize( WHEEL_CAPACITY, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( wheelMemorySize, memorySize );
+    TEST_ASSERT_GREATER_OR_EQUAL( WHEEL_CAPACITY * ( sizeof( uint32_t ) + ( 3 * sizeof( uint16_t ) ) ), memorySize );
+
+    result = Dcep_TimerWheelGetMemorySize( WHEEL_CAPACITY, NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_TimerWheelGetMemorySize( 0, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_TimerWheelGetMemorySize( DCEP_TIMER_WHEEL_MAX_CAPACITY + 1, &( memorySize ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_TimerWheelInit( NULL, pWheelMemory, wheelMemorySize, WHEEL_CAPACITY, 0 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_TimerWheelInit( &( timerWheel ), NULL, wheelMemorySize, WHEEL_CAPACITY, 0 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with misaligned memory. */
+    result = Dcep_TimerWheelInit( &( timerWheel ), pWheelMemory + 2, wheelMemorySize, WHEEL_CAPACITY, 0 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_TimerWheelInit( &( timerWheel ), pWheelMemory, wheelMemorySize, 0, 0 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with memory too small. */
+    result = Dcep_TimerWheelInit( &( timerWheel ), pWheelMemory, wheelMemorySize - 1, WHEEL_CAPACITY, 0 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OUT_OF_MEMORY, result );
+
+    InitWheel( 1000 );
+    TEST_ASSERT_EQUAL( 0, timerWheel.count );
+    TEST_ASSERT_EQUAL( 1000, timerWheel.currentTick );
+    TEST_ASSERT_EQUAL( 0, Advance( 5000 ) );
+    TEST_ASSERT_EQUAL( 5000, timerWheel.currentTick );
+}
+
+/* ==============================  Test Cases for Expiry ============================== */
+
+/**
+ * @brief Validate that every timer expires on exactly the tick it was armed
+ * for, on every level of the wheel and when the tick counter wraps around.
+ */
+void test_dcepTimerWheel_ExpiresOnTime( void )
+{
+    DcepResult_t result;
+    const uint32_t startTicks[] = { 0, 37, 4090, 0xFFFFFFF0UL };
+    const uint32_t timeouts[] =
+    {
+        0,     1,     2,     62,     63,     64,     65,     127,    128,
+        4031,  4095,  4096,  4097,   5000,   65536,  262143, 262144, 262145,
+        300000
+    };
+    const size_t numTimeouts = sizeof( timeouts ) / sizeof( timeouts[ 0 ] );
+    uint32_t tick;
+    size_t s, i, numExpired, totalExpired;
+
+    for( s = 0; s < ( sizeof( startTicks ) / sizeof( startTicks[ 0 ] ) ); s++ )
+    {
+        InitWheel( startTicks[ s ] );
+
+        for( i = 0; i < numTimeouts; i++ )
+        {
+            result = Dcep_TimerWheelArm( &( timerWheel ), ( uint16_t ) i, timeouts[ i ] );
+            TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+        }
+
+        TEST_ASSERT_EQUAL( numTimeouts, timerWheel.count );
+
+        totalExpired = 0;
+
+        for( tick = startTicks[ s ]; totalExpired < numTimeouts; tick++ )
+        {
+            numExpired = Advance( tick );
+
+            for( i = 0; i < numExpired; i++ )
+            {
+                TEST_ASSERT_LESS_THAN( numTimeouts, expiredStreamIds[ i ] );
+                TEST_ASSERT_EQUAL_UINT32( startTicks[ s ] + timeouts[ expiredStreamIds[ i ] ], tick );
+            }
+
+            totalExpired += numExpired;
+        }
+
+        TEST_ASSERT_EQUAL( 0, timerWheel.count );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that advancing many ticks at once expires every timer due
+ * by then, and only those.
+ */
+void test_dcepTimerWheelAdvance_Jump( void )
+{
+    DcepResult_t result;
+    size_t numExpired, i;
+    uint16_t expiredMask = 0;
+
+    InitWheel( 500 );
+
+    for( i = 0; i < 8; i++ )
+    {
+        result = Dcep_TimerWheelArm( &( timerWheel ), ( uint16_t ) i, ( uint32_t ) ( 1000 * i ) );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    }
+
+    /* Timeouts above the largest one are clamped. */
+    result = Dcep_TimerWheelArm( &( timerWheel ), 8, 0xFFFFFFFFUL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    numExpired = Advance( 500 + 3500 );
+    TEST_ASSERT_EQUAL( 4, numExpired );
+
+    for( i = 0; i < numExpired; i++ )
+    {
+        expiredMask |= ( uint16_t ) ( 1U << expiredStreamIds[ i ] );
+    }
+
+    TEST_ASSERT_EQUAL_HEX16( 0x000F, expiredMask );
+    TEST_ASSERT_EQUAL( 5, timerWheel.count );
+
+    numExpired = Advance( 500 + 7000 );
+    TEST_ASSERT_EQUAL( 4, numExpired );
+
+    numExpired = Advance( 500 + DCEP_TIMER_WHEEL_MAX_TIMEOUT - 1 );
+    TEST_ASSERT_EQUAL( 0, numExpired );
+
+    numExpired = Advance( 500 + DCEP_TIMER_WHEEL_MAX_TIMEOUT );
+    TEST_ASSERT_EQUAL( 1, numExpired );
+    TEST_ASSERT_EQUAL( 8, expiredStreamIds[ 0 ] );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that at most maxExpired timers expire per call and that
+ * the rest expire on the following calls.
+ */
+void test_dcepTimerWheelAdvance_Batch( void )
+{
+    DcepResult_t result;
+    size_t numExpired = 0, i;
+
+    InitWheel( 0 );
+
+    for( i = 0; i < 10; i++ )
+    {
+        result = Dcep_TimerWheelArm( &( timerWheel ), ( uint16_t ) i, 100 );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    }
+
+    result = Dcep_TimerWheelArm( &( timerWheel ), 10, 200 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_TimerWheelAdvance( &( timerWheel ), 300, &( expiredStreamIds[ 0 ] ), 4, &( numExpired ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 4, numExpired );
+    TEST_ASSERT_EQUAL( 100, timerWheel.currentTick );
+
+    result = Dcep_TimerWheelAdvance( &( timerWheel ), 300, &( expiredStreamIds[ 0 ] ), 4, &( numExpired ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 4, numExpired );
+
+    /* The last two timers due at 100 and the one due at 200. */
+    result = Dcep_TimerWheelAdvance( &( timerWheel ), 300, &( expiredStreamIds[ 0 ] ), 4, &( numExpired ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, numExpired );
+    TEST_ASSERT_EQUAL( 10, expiredStreamIds[ 2 ] );
+    TEST_ASSERT_EQUAL( 300, timerWheel.currentTick );
+    TEST_ASSERT_EQUAL( 0, timerWheel.count );
+}
+
+/* ==============================  Test Cases for Cancel ============================== */
+
+/**
+ * @brief Validate that a cancelled timer does not expire, that the other
+ * timers of its bucket still do, and that arming again replaces a timer.
+ */
+void test_dcepTimerWheelCancel( void )
+{
+    DcepResult_t result;
+    size_t i;
+
+    InitWheel( 0 );
+
+    /* Same bucket, so that the head, middle and tail are unlinked. */
+    for( i = 0; i < 5; i++ )
+    {
+        result = Dcep_TimerWheelArm( &( timerWheel ), ( uint16_t ) i, 5000 );
+        TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    }
+
+    result = Dcep_TimerWheelCancel( &( timerWheel ), 4 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_TimerWheelCancel( &( timerWheel ), 2 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_TimerWheelCancel( &( timerWheel ), 0 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_TimerWheelCancel( &( timerWheel ), 0 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+    result = Dcep_TimerWheelCancel( &( timerWheel ), 7 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+
+    /* Arming again moves the timer of stream 3 later. */
+    result = Dcep_TimerWheelArm( &( timerWheel ), 3, 6000 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 2, timerWheel.count );
+
+    TEST_ASSERT_EQUAL( 1, Advance( 5000 ) );
+    TEST_ASSERT_EQUAL( 1, expiredStreamIds[ 0 ] );
+
+    TEST_ASSERT_EQUAL( 1, Advance( 6000 ) );
+    TEST_ASSERT_EQUAL( 3, expiredStreamIds[ 0 ] );
+
+    result = Dcep_TimerWheelCancel( &( timerWheel ), 3 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_NOT_FOUND, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate the timer wheel functions with bad parameters.
+ */
+void test_dcepTimerWheel_BadParams( void )
+{
+    DcepResult_t result;
+    size_t numExpired = 0;
+
+    InitWheel( 100 );
+
+    result = Dcep_TimerWheelArm( NULL, 0, 10 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_TimerWheelArm( &( timerWheel ), WHEEL_CAPACITY, 10 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_TimerWheelCancel( NULL, 0 );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_TimerWheelCancel( &( timerWheel ), WHEEL_CAPACITY );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_TimerWheelAdvance( NULL, 200, &( expiredStreamIds[ 0 ] ), WHEEL_CAPACITY, &( numExpired ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_TimerWheelAdvance( &( timerWheel ), 200, NULL, WHEEL_CAPACITY, &( numExpired ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_TimerWheelAdvance( &( timerWheel ), 200, &( expiredStreamIds[ 0 ] ), 0, &( numExpired ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    result = Dcep_TimerWheelAdvance( &( timerWheel ), 200, &( expiredStreamIds[ 0 ] ), WHEEL_CAPACITY, NULL );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+
+    /* Test with a tick that went backwards. */
+    result = Dcep_TimerWheelAdvance( &( timerWheel ), 99, &( expiredStreamIds[ 0 ] ), WHEEL_CAPACITY, &( numExpired ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_BAD_PARAM, result );
+    TEST_ASSERT_EQUAL( 100, timerWheel.currentTick );
+}
+
+/*-----------------------------------------------------------*/
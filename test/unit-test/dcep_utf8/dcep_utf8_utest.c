@@ -0,0 +1,609 @@
+/* Unity includes. */
+#include "unity.h"
+
+/* Standard includes. */
+#include <string.h>
+#include <stdint.h>
+
+/* API includes. */
+#include "dcep_api.h"
+
+/* ===========================  EXTERN VARIABLES  =========================== */
+
+#define MAX_VALIDATORS       4
+#define LONG_INPUT_LENGTH    200
+
+DcepValidateUtf8_t validators[ MAX_VALIDATORS ];
+size_t numValidators;
+DcepContext_t ctx;
+DcepMetrics_t metrics;
+
+/* DATA_CHANNEL_OPEN, reliable, label "l" followed by U+00E9, protocol "p". */
+uint8_t channelOpenMessageBuffer[] = { 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+                                       0x00, 0x03, 0x00, 0x01, 'l', 0xC3, 0xA9, 'p' };
+
+#define LABEL_OFFSET       12
+#define PROTOCOL_OFFSET    15
+
+void setUp( void )
+{
+    DcepResult_t result;
+
+    numValidators = 0;
+    validators[ numValidators++ ] = Dcep_ValidateUtf8Scalar;
+
+    #if defined( DCEP_SIMD_X86 )
+        __builtin_cpu_init();
+
+        if( __builtin_cpu_supports( "ssse3" ) )
+        {
+            validators[ numValidators++ ] = Dcep_ValidateUtf8Ssse3;
+        }
+
+        if( __builtin_cpu_supports( "avx2" ) )
+        {
+            validators[ numValidators++ ] = Dcep_ValidateUtf8Avx2;
+        }
+    #elif defined( DCEP_SIMD_NEON )
+        validators[ numValidators++ ] = Dcep_ValidateUtf8Neon;
+    #endif
+
+    result = Dcep_Init( &( ctx ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    channelOpenMessageBuffer[ LABEL_OFFSET + 1 ] = 0xC3;
+    channelOpenMessageBuffer[ LABEL_OFFSET + 2 ] = 0xA9;
+    memset( &( metrics ), 0xA5, sizeof( metrics ) );
+}
+
+void tearDown( void )
+{
+}
+
+/* ==============================  Helpers ============================== */
+
+static void GetMetrics( void )
+{
+    DcepResult_t result;
+
+    result = Dcep_GetMetrics( &( ctx ), &( metrics ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/* Validates pInput with every validator, in one piece and split in two at
+ * every position, and checks that all of them return expectedState. */
+static void AssertValidateUtf8( const uint8_t * pInput,
+                                size_t length,
+                                uint32_t expectedState )
+{
+    uint32_t state;
+    size_t i, split;
+
+    for( i = 0; i < numValidators; i++ )
+    {
+        state = validators[ i ]( DCEP_UTF8_ACCEPT, pInput, length );
+        TEST_ASSERT_EQUAL( expectedState, state );
+
+        for( split = 0; split <= length; split++ )
+        {
+            state = validators[ i ]( DCEP_UTF8_ACCEPT, pInput, split );
+
+            if( state != DCEP_UTF8_REJECT )
+            {
+                state = validators[ i ]( state, &( pInput[ split ] ), length - split );
+            }
+
+            TEST_ASSERT_EQUAL( expectedState, state );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+static void CorruptLabel( void )
+{
+    /* Continuation byte without a lead byte. */
+    channelOpenMessageBuffer[ LABEL_OFFSET + 1 ] = 0xA9;
+}
+
+/* ==============================  Test Cases for the Validators ============================== */
+
+/**
+ * @brief Validate that ASCII and well-formed multi-byte characters are
+ * accepted, including the boundaries of every lead byte range.
+ */
+void test_dcepValidateUtf8_Valid( void )
+{
+    const uint8_t ascii[] = "data-channel/1";
+    const uint8_t twoByte[] = { 0xC2, 0x80, 0xDF, 0xBF };
+    const uint8_t threeByte[] = { 0xE0, 0xA0, 0x80, 0xE1, 0x80, 0x80, 0xED, 0x9F, 0xBF, 0xEF, 0xBF, 0xBF };
+    const uint8_t fourByte[] = { 0xF0, 0x90, 0x80, 0x80, 0xF3, 0xBF, 0xBF, 0xBF, 0xF4, 0x8F, 0xBF, 0xBF };
+    const uint8_t mixed[] = { 'a', 0xC3, 0xA9, 'b', 0xE2, 0x82, 0xAC, 'c', 0xF0, 0x9F, 0x98, 0x80, 0x00, 0x7F };
+
+    AssertValidateUtf8( NULL, 0, DCEP_UTF8_ACCEPT );
+    AssertValidateUtf8( &( ascii[ 0 ] ), sizeof( ascii ) - 1, DCEP_UTF8_ACCEPT );
+    AssertValidateUtf8( &( twoByte[ 0 ] ), sizeof( twoByte ), DCEP_UTF8_ACCEPT );
+    AssertValidateUtf8( &( threeByte[ 0 ] ), sizeof( threeByte ), DCEP_UTF8_ACCEPT );
+    AssertValidateUtf8( &( fourByte[ 0 ] ), sizeof( fourByte ), DCEP_UTF8_ACCEPT );
+    AssertValidateUtf8( &( mixed[ 0 ] ), sizeof( mixed ), DCEP_UTF8_ACCEPT );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that every class of malformed input is rejected.
+ */
+void test_dcepValidateUtf8_Invalid( void )
+{
+    const uint8_t bareContinuation[] = { 'a', 0x80 };
+    const uint8_t overlongTwoByte[] = { 0xC0, 0xAF };
+    const uint8_t overlongC1[] = { 0xC1, 0xBF };
+    const uint8_t overlongThreeByte[] = { 0xE0, 0x9F, 0xBF };
+    const uint8_t surrogate[] = { 0xED, 0xA0, 0x80 };
+    const uint8_t overlongFourByte[] = { 0xF0, 0x8F, 0xBF, 0xBF };
+    const uint8_t aboveMaximum[] = { 0xF4, 0x90, 0x80, 0x80 };
+    const uint8_t invalidLead[] = { 0xF5, 0x80, 0x80, 0x80 };
+    const uint8_t invalidByte[] = { 'a', 0xFF };
+    const uint8_t missingContinuation[] = { 0xE2, 0x82, 'a' };
+
+    AssertValidateUtf8( &( bareContinuation[ 0 ] ), sizeof( bareContinuation ), DCEP_UTF8_REJECT );
+    AssertValidateUtf8( &( overlongTwoByte[ 0 ] ), sizeof( overlongTwoByte ), DCEP_UTF8_REJECT );
+    AssertValidateUtf8( &( overlongC1[ 0 ] ), sizeof( overlongC1 ), DCEP_UTF8_REJECT );
+    AssertValidateUtf8( &( overlongThreeByte[ 0 ] ), sizeof( overlongThreeByte ), DCEP_UTF8_REJECT );
+    AssertValidateUtf8( &( surrogate[ 0 ] ), sizeof( surrogate ), DCEP_UTF8_REJECT );
+    AssertValidateUtf8( &( overlongFourByte[ 0 ] ), sizeof( overlongFourByte ), DCEP_UTF8_REJECT );
+    AssertValidateUtf8( &( aboveMaximum[ 0 ] ), sizeof( aboveMaximum ), DCEP_UTF8_REJECT );
+    AssertValidateUtf8( &( invalidLead[ 0 ] ), sizeof( invalidLead ), DCEP_UTF8_REJECT );
+    AssertValidateUtf8( &( invalidByte[ 0 ] ), sizeof( invalidByte ), DCEP_UTF8_REJECT );
+    AssertValidateUtf8( &( missingContinuation[ 0 ] ), sizeof( missingContinuation ), DCEP_UTF8_REJECT );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that input ending in the middle of a character is neither
+ * accepted nor rejected, and that a bad state is rejected.
+ */
+void test_dcepValidateUtf8_Truncated( void )
+{
+    const uint8_t truncated[] = { 'a', 0xF0, 0x9F, 0x98 };
+    size_t i;
+
+    for( i = 0; i < numValidators; i++ )
+    {
+        TEST_ASSERT_NOT_EQUAL( DCEP_UTF8_ACCEPT, validators[ i ]( DCEP_UTF8_ACCEPT, &( truncated[ 0 ] ), sizeof( truncated ) ) );
+        TEST_ASSERT_NOT_EQUAL( DCEP_UTF8_REJECT, validators[ i ]( DCEP_UTF8_ACCEPT, &( truncated[ 0 ] ), sizeof( truncated ) ) );
+        TEST_ASSERT_EQUAL( DCEP_UTF8_REJECT, validators[ i ]( 0xFFU, &( truncated[ 0 ] ), 1 ) );
+        TEST_ASSERT_EQUAL( DCEP_UTF8_REJECT, validators[ i ]( DCEP_UTF8_REJECT, &( truncated[ 0 ] ), 1 ) );
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate long inputs with a multi-byte character or an invalid byte
+ * at every offset, so that the vector kernels see it in every lane.
+ */
+void test_dcepValidateUtf8_LongInput( void )
+{
+    uint8_t input[ LONG_INPUT_LENGTH ];
+    size_t offset, i;
+
+    for( offset = 0; offset + 2 <= LONG_INPUT_LENGTH; offset++ )
+    {
+        memset( &( input[ 0 ] ), 'x', sizeof( input ) );
+        input[ offset ] = 0xC3;
+        input[ offset + 1 ] = 0xA9;
+
+        for( i = 0; i < numValidators; i++ )
+        {
+            TEST_ASSERT_EQUAL( DCEP_UTF8_ACCEPT, validators[ i ]( DCEP_UTF8_ACCEPT, &( input[ 0 ] ), sizeof( input ) ) );
+        }
+
+        input[ offset ] = 0x80;
+
+        for( i = 0; i < numValidators; i++ )
+        {
+            TEST_ASSERT_EQUAL( DCEP_UTF8_REJECT, validators[ i ]( DCEP_UTF8_ACCEPT, &( input[ 0 ] ), sizeof( input ) ) );
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate long inputs with a character of every length at every
+ * offset, complete, cut short by the end of the input, cut short by ASCII
+ * and split across two calls, so that the vector kernels see it straddle
+ * every vector boundary and end every vector.
+ */
+void test_dcepValidateUtf8_LongInputCharacters( void )
+{
+    const uint8_t characters[][ 4 ] =
+    {
+        { 0xC3, 0xA9 }, { 0xE2, 0x82, 0xAC }, { 0xED, 0x9F, 0xBF }, { 0xF0, 0x9F, 0x98, 0x80 }, { 0xF4, 0x8F, 0xBF, 0xBF }
+    };
+    const size_t characterLengths[] = { 2, 3, 3, 4, 4 };
+    uint8_t input[ LONG_INPUT_LENGTH ];
+    uint32_t state;
+    size_t c, offset, numBytes, i;
+
+    for( c = 0; c < ( sizeof( characterLengths ) / sizeof( characterLengths[ 0 ] ) ); c++ )
+    {
+        for( offset = 0; offset + characterLengths[ c ] <= LONG_INPUT_LENGTH; offset++ )
+        {
+            for( numBytes = 1; numBytes <= characterLengths[ c ]; numBytes++ )
+            {
+                memset( &( input[ 0 ] ), 'x', sizeof( input ) );
+                memcpy( &( input[ offset ] ), &( characters[ c ][ 0 ] ), numBytes );
+
+                for( i = 0; i < numValidators; i++ )
+                {
+                    /* Ends with the character. */
+                    state = validators[ i ]( DCEP_UTF8_ACCEPT, &( input[ 0 ] ), offset + numBytes );
+
+                    if( numBytes == characterLengths[ c ] )
+                    {
+                        TEST_ASSERT_EQUAL( DCEP_UTF8_ACCEPT, state );
+                    }
+                    else
+                    {
+                        TEST_ASSERT_EQUAL( Dcep_ValidateUtf8Scalar( DCEP_UTF8_ACCEPT, &( input[ 0 ] ), offset + numBytes ), state );
+                        TEST_ASSERT_NOT_EQUAL( DCEP_UTF8_ACCEPT, state );
+                        TEST_ASSERT_NOT_EQUAL( DCEP_UTF8_REJECT, state );
+                    }
+
+                    /* Followed by ASCII. */
+                    state = validators[ i ]( DCEP_UTF8_ACCEPT, &( input[ 0 ] ), sizeof( input ) );
+                    TEST_ASSERT_EQUAL( ( numBytes == characterLengths[ c ] ) ? DCEP_UTF8_ACCEPT : DCEP_UTF8_REJECT, state );
+                }
+            }
+
+            /* Split after the lead byte. */
+            for( i = 0; i < numValidators; i++ )
+            {
+                state = validators[ i ]( DCEP_UTF8_ACCEPT, &( input[ 0 ] ), offset + 1 );
+                state = validators[ i ]( state, &( input[ offset + 1 ] ), sizeof( input ) - offset - 1 );
+                TEST_ASSERT_EQUAL( DCEP_UTF8_ACCEPT, state );
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that every class of malformed input is rejected at every
+ * offset of a long input that is otherwise valid.
+ */
+void test_dcepValidateUtf8_LongInputInvalid( void )
+{
+    const uint8_t sequences[][ 5 ] =
+    {
+        { 0x80 },                         /* Bare continuation. */
+        { 0xC3, 0xA9, 0xA9 },             /* Continuation after a complete character. */
+        { 0xF0, 0x9F, 0x98, 0x80, 0x80 }, /* Five byte sequence. */
+        { 0xC0, 0xAF },                   /* Overlong two byte. */
+        { 0xC1, 0xBF },
+        { 0xE0, 0x9F, 0xBF },             /* Overlong three byte. */
+        { 0xED, 0xA0, 0x80 },             /* Surrogate. */
+        { 0xF0, 0x8F, 0xBF, 0xBF },       /* Overlong four byte. */
+        { 0xF4, 0x90, 0x80, 0x80 },       /* Above U+10FFFF. */
+        { 0xF5, 0x80, 0x80, 0x80 },       /* Invalid lead bytes. */
+        { 0xF8, 0x80, 0x80, 0x80 },
+        { 0xFF },
+        { 0xE2, 0x82, 'x' },              /* Missing continuation. */
+        { 0xE2, 0x82, 0xC3, 0xA9 },
+        { 0xF0, 0x9F, 0x98, 0xE2 }
+    };
+    const size_t sequenceLengths[] = { 1, 3, 5, 2, 2, 3, 3, 4, 4, 4, 4, 1, 3, 4, 4 };
+    uint8_t input[ LONG_INPUT_LENGTH ];
+    size_t s, offset, i;
+
+    for( s = 0; s < ( sizeof( sequenceLengths ) / sizeof( sequenceLengths[ 0 ] ) ); s++ )
+    {
+        for( offset = 0; offset + sequenceLengths[ s ] <= LONG_INPUT_LENGTH; offset++ )
+        {
+            memset( &( input[ 0 ] ), 'x', sizeof( input ) );
+            memcpy( &( input[ offset ] ), &( sequences[ s ][ 0 ] ), sequenceLengths[ s ] );
+
+            for( i = 0; i < numValidators; i++ )
+            {
+                TEST_ASSERT_EQUAL( DCEP_UTF8_REJECT, validators[ i ]( DCEP_UTF8_ACCEPT, &( input[ 0 ] ), sizeof( input ) ) );
+            }
+        }
+    }
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Dcep_Init selects one of the validators.
+ */
+void test_dcepSelectValidateUtf8Function( void )
+{
+    size_t i;
+    int found = 0;
+
+    for( i = 0; i < numValidators; i++ )
+    {
+        if( ctx.validateUtf8Fn == validators[ i ] )
+        {
+            found = 1;
+        }
+    }
+
+    TEST_ASSERT_EQUAL( 1, found );
+}
+
+/* ==============================  Test Cases for Strict Deserialization ============================== */
+
+/**
+ * @brief Validate that Dcep_DeserializeChannelOpenMessage accepts a UTF-8
+ * label and rejects one that is not UTF-8.
+ */
+void test_dcepDeserializeChannelOpenMessage_StrictUtf8( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t channelOpenMessage;
+
+    result = Dcep_DeserializeChannelOpenMessage( &( ctx ),
+                                                 &( channelOpenMessageBuffer[ 0 ] ),
+                                                 sizeof( channelOpenMessageBuffer ),
+                                                 &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 3, channelOpenMessage.channelNameLength );
+
+    CorruptLabel();
+
+    result = Dcep_DeserializeChannelOpenMessage( &( ctx ),
+                                                 &( channelOpenMessageBuffer[ 0 ] ),
+                                                 sizeof( channelOpenMessageBuffer ),
+                                                 &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 1, metrics.channelOpenMessagesDeserialized );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedUtf8 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a character may not start in the label and end in the
+ * protocol.
+ */
+void test_dcepDeserializeChannelOpenMessage_StrictUtf8SplitAcrossFields( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t channelOpenMessage;
+
+    /* Label "l\xC3", protocol "\xA9p". */
+    channelOpenMessageBuffer[ 9 ] = 0x02;
+    channelOpenMessageBuffer[ 11 ] = 0x02;
+
+    result = Dcep_DeserializeChannelOpenMessage( &( ctx ),
+                                                 &( channelOpenMessageBuffer[ 0 ] ),
+                                                 sizeof( channelOpenMessageBuffer ),
+                                                 &( channelOpenMessage ) );
+
+    channelOpenMessageBuffer[ 9 ] = 0x03;
+    channelOpenMessageBuffer[ 11 ] = 0x01;
+
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that a message rejected before the UTF-8 check is not
+ * counted as malformed UTF-8.
+ */
+void test_dcepDeserializeChannelOpenMessage_StrictUtf8Overrun( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenMessage_t channelOpenMessage;
+
+    /* Label overrun, with the label ending in the middle of U+00E9. */
+    result = Dcep_DeserializeChannelOpenMessage( &( ctx ),
+                                                 &( channelOpenMessageBuffer[ 0 ] ),
+                                                 LABEL_OFFSET + 2,
+                                                 &( channelOpenMessage ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 1, metrics.malformedLabelOverrun );
+    TEST_ASSERT_EQUAL( 0, metrics.malformedUtf8 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Dcep_DeserializeBatch rejects only the entries that
+ * are not UTF-8.
+ */
+void test_dcepDeserializeBatch_StrictUtf8( void )
+{
+    DcepResult_t result;
+    uint8_t invalidMessage[ sizeof( channelOpenMessageBuffer ) ];
+    DcepBatchEntry_t entries[ 3 ];
+    DcepBatchResult_t results[ 3 ];
+
+    memcpy( &( invalidMessage[ 0 ] ), &( channelOpenMessageBuffer[ 0 ] ), sizeof( invalidMessage ) );
+    invalidMessage[ PROTOCOL_OFFSET ] = 0xC3;
+
+    entries[ 0 ].pDcepMessage = &( channelOpenMessageBuffer[ 0 ] );
+    entries[ 0 ].dcepMessageLength = sizeof( channelOpenMessageBuffer );
+    entries[ 0 ].streamId = 1;
+    entries[ 1 ].pDcepMessage = &( invalidMessage[ 0 ] );
+    entries[ 1 ].dcepMessageLength = sizeof( invalidMessage );
+    entries[ 1 ].streamId = 3;
+    entries[ 2 ] = entries[ 0 ];
+    entries[ 2 ].streamId = 5;
+
+    result = Dcep_DeserializeBatch( &( ctx ), &( entries[ 0 ] ), 3, &( results[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, results[ 0 ].result );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, results[ 1 ].result );
+    TEST_ASSERT_EQUAL( 3, results[ 1 ].streamId );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, results[ 2 ].result );
+    TEST_ASSERT_EQUAL_PTR( &( channelOpenMessageBuffer[ LABEL_OFFSET ] ), results[ 2 ].channelOpenMessage.pChannelName );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 2, metrics.channelOpenMessagesDeserialized );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedUtf8 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the UTF-8 check of Dcep_DeserializeBatch skips the
+ * entries that the header block kernel already rejected.
+ */
+void test_dcepDeserializeBatch_StrictUtf8HeaderRejected( void )
+{
+    DcepResult_t result;
+    uint8_t invalidMessage[ sizeof( channelOpenMessageBuffer ) ];
+    DcepBatchEntry_t entries[ 3 ];
+    DcepBatchResult_t results[ 3 ];
+
+    memcpy( &( invalidMessage[ 0 ] ), &( channelOpenMessageBuffer[ 0 ] ), sizeof( invalidMessage ) );
+    invalidMessage[ PROTOCOL_OFFSET ] = 0xC3;
+
+    entries[ 0 ].pDcepMessage = &( channelOpenMessageBuffer[ 0 ] );
+    entries[ 0 ].dcepMessageLength = sizeof( channelOpenMessageBuffer );
+    entries[ 0 ].streamId = 1;
+    /* Label overrun, with the label ending in the middle of U+00E9. */
+    entries[ 1 ].pDcepMessage = &( channelOpenMessageBuffer[ 0 ] );
+    entries[ 1 ].dcepMessageLength = LABEL_OFFSET + 2;
+    entries[ 1 ].streamId = 3;
+    /* Protocol overrun, and the protocol is not UTF-8. */
+    entries[ 2 ].pDcepMessage = &( invalidMessage[ 0 ] );
+    entries[ 2 ].dcepMessageLength = PROTOCOL_OFFSET;
+    entries[ 2 ].streamId = 5;
+
+    result = Dcep_DeserializeBatch( &( ctx ), &( entries[ 0 ] ), 3, &( results[ 0 ] ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, results[ 0 ].result );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, results[ 1 ].result );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, results[ 2 ].result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 1, metrics.channelOpenMessagesDeserialized );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedLabelOverrun );
+    TEST_ASSERT_EQUAL( 1, metrics.malformedProtocolOverrun );
+    TEST_ASSERT_EQUAL( 0, metrics.malformedUtf8 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that Dcep_InitChannelOpenView rejects a label that is not
+ * UTF-8.
+ */
+void test_dcepInitChannelOpenView_StrictUtf8( void )
+{
+    DcepResult_t result;
+    DcepChannelOpenView_t view;
+
+    result = Dcep_InitChannelOpenView( &( ctx ),
+                                       &( channelOpenMessageBuffer[ 0 ] ),
+                                       sizeof( channelOpenMessageBuffer ),
+                                       &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    CorruptLabel();
+
+    result = Dcep_InitChannelOpenView( &( ctx ),
+                                       &( channelOpenMessageBuffer[ 0 ] ),
+                                       sizeof( channelOpenMessageBuffer ),
+                                       &( view ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 1, metrics.malformedUtf8 );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the streaming parser accepts a character split across
+ * chunks.
+ */
+void test_dcepStreamingParser_StrictUtf8SplitAcrossChunks( void )
+{
+    DcepResult_t result;
+    DcepStreamingParser_t parser;
+    DcepStreamingParserOutput_t output;
+
+    result = Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    /* Header and label up to the middle of "\xC3\xA9". */
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( channelOpenMessageBuffer[ 0 ] ), LABEL_OFFSET + 2, &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( DCEP_STREAMING_PARSER_STATE_LABEL, parser.state );
+
+    result = Dcep_StreamingParserFeed( &( ctx ),
+                                       &( parser ),
+                                       &( channelOpenMessageBuffer[ LABEL_OFFSET + 2 ] ),
+                                       sizeof( channelOpenMessageBuffer ) - ( LABEL_OFFSET + 2 ),
+                                       &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+    TEST_ASSERT_EQUAL( 1, output.messageComplete );
+}
+
+/*-----------------------------------------------------------*/
+
+/**
+ * @brief Validate that the streaming parser rejects an invalid byte, a label
+ * that ends in the middle of a character and an invalid protocol.
+ */
+void test_dcepStreamingParser_StrictUtf8Invalid( void )
+{
+    DcepResult_t result;
+    DcepStreamingParser_t parser;
+    DcepStreamingParserOutput_t output;
+
+    /* Continuation byte without a lead byte. */
+    CorruptLabel();
+
+    result = Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( channelOpenMessageBuffer[ 0 ] ), sizeof( channelOpenMessageBuffer ), &( output ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+    TEST_ASSERT_EQUAL( DCEP_STREAMING_PARSER_STATE_ERROR, parser.state );
+
+    /* Label "l\xC3" ends in the middle of a character. */
+    channelOpenMessageBuffer[ LABEL_OFFSET + 1 ] = 0xC3;
+    channelOpenMessageBuffer[ 9 ] = 0x02;
+
+    result = Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( channelOpenMessageBuffer[ 0 ] ), LABEL_OFFSET + 2, &( output ) );
+    channelOpenMessageBuffer[ 9 ] = 0x03;
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+    TEST_ASSERT_EQUAL( DCEP_STREAMING_PARSER_STATE_ERROR, parser.state );
+
+    /* Protocol that is not UTF-8. */
+    channelOpenMessageBuffer[ LABEL_OFFSET + 2 ] = 0xA9;
+    channelOpenMessageBuffer[ PROTOCOL_OFFSET ] = 0xFF;
+
+    result = Dcep_StreamingParserInit( &( ctx ), &( parser ) );
+    TEST_ASSERT_EQUAL( DCEP_RESULT_OK, result );
+
+    result = Dcep_StreamingParserFeed( &( ctx ), &( parser ), &( channelOpenMessageBuffer[ 0 ] ), sizeof( channelOpenMessageBuffer ), &( output ) );
+    channelOpenMessageBuffer[ PROTOCOL_OFFSET ] = 'p';
+    TEST_ASSERT_EQUAL( DCEP_RESULT_MALFORMED_MESSAGE, result );
+    TEST_ASSERT_EQUAL( DCEP_STREAMING_PARSER_STATE_ERROR, parser.state );
+
+    GetMetrics();
+    TEST_ASSERT_EQUAL( 3, metrics.malformedUtf8 );
+    TEST_ASSERT_EQUAL( 0, metrics.channelOpenMessagesDeserialized );
+}
+
+/*-----------------------------------------------------------*/